@@ -147,6 +147,12 @@ extern "C" {
   // responsiveness of the touch functionality.
   #define GSLC_TOUCH_MAX_EVT    1
 
+  // Define the time budget (in ms) for handling the queued touch and
+  // input events per gslc_Update() call. When non-zero, this replaces
+  // the GSLC_TOUCH_MAX_EVT limit so that all queued events are handled
+  // unless the handling takes longer than the budget.
+  #define GSLC_INPUT_Q_BUDGET_MS  10
+
   // -----------------------------------------------------------------------------
   // Misc
   // -----------------------------------------------------------------------------
@@ -0,0 +1,73 @@
+#!/bin/sh
+#
+# GUIslice rendering benchmark (LINUX, headless)
+# - Builds a set of the LINUX examples with the in-memory framebuffer
+#   driver (DRV_DISP_MEMFB) and replays a touch script against each
+# - Per-frame results are written to <out>/<example>.csv
+# - A summary of all examples is written to <out>/summary.csv
+#
+# Environment overrides:
+# - BENCH_EXAMPLES: Space-separated list of examples to run
+# - BENCH_OUT:      Output directory (default: ./results)
+# - BENCH_CFLAGS:   Compiler flags (default: -O2)
+# - BENCH_CONFIG:   GUIslice config file (default: linux-memfb-default-script.h)
+#
+# Each example <ex> requires a touch script named <ex>.txt in this directory.
+#
+
+set -e
+
+BENCH_DIR=$(cd "$(dirname "$0")" && pwd)
+GSLC_DIR=$(cd "$BENCH_DIR/../../.." && pwd)
+
+EXAMPLES=${BENCH_EXAMPLES:-"ex04_lnx_ctrls ex11_lnx_graph ex24_lnx_tabs ex27_lnx_alpha ex42_lnx_ring"}
+OUT=${BENCH_OUT:-$BENCH_DIR/results}
+CFLAGS=${BENCH_CFLAGS:-"-O2"}
+CONFIG=${BENCH_CONFIG:-$GSLC_DIR/configs/linux-memfb-default-script.h}
+CC=${CC:-gcc}
+
+mkdir -p "$OUT/bin"
+
+SUMMARY="$OUT/summary.csv"
+SUMMARY_HDR=""
+
+for EX in $EXAMPLES; do
+  echo "[Building $EX]"
+  $CC $CFLAGS -o "$OUT/bin/$EX" "$BENCH_DIR/../$EX.c" \
+    "$GSLC_DIR/src/GUIslice.c" "$GSLC_DIR"/src/elem/*.c "$GSLC_DIR/src/GUIslice_drv_memfb.c" \
+    -I "$BENCH_DIR/.." -I "$GSLC_DIR/src" \
+    -DUSER_CONFIG_LOADED -DUSER_CONFIG_INC_FILE "-DUSER_CONFIG_INC_FNAME=\"$CONFIG\"" \
+    -lm
+
+  echo "[Running $EX]"
+  GSLC_TOUCH_SCRIPT="$BENCH_DIR/$EX.txt" GSLC_MEMFB_STATS="$OUT/$EX.csv" \
+    "$OUT/bin/$EX" > "$OUT/$EX.log" 2>&1 || {
+    echo "ERROR: $EX failed (see $OUT/$EX.log)"
+    exit 1
+  }
+
+  # Summarize the per-frame log
+  # - Columns: frame,time_us,pixels,bytes,<driver calls...>
+  # - Reports the mean of each column (and max time) per frame
+  if [ -z "$SUMMARY_HDR" ]; then
+    SUMMARY_HDR=$(head -n 1 "$OUT/$EX.csv" | \
+      sed -e 's/^frame,time_us,/example,frames,time_us_max,time_us,/')
+    echo "$SUMMARY_HDR" > "$SUMMARY"
+  fi
+  awk -F, -v ex="$EX" '
+    NR == 1 { nCols = NF; next }
+    {
+      nFrames++
+      for (i = 2; i <= NF; i++) { anSum[i] += $i }
+      if ($2 > nMax) { nMax = $2 }
+    }
+    END {
+      if (nFrames == 0) { nFrames = 1 }
+      printf "%s,%d,%d", ex, nFrames, nMax
+      for (i = 2; i <= nCols; i++) { printf ",%.1f", anSum[i] / nFrames }
+      printf "\n"
+    }' "$OUT/$EX.csv" >> "$SUMMARY"
+done
+
+echo "[Summary: $SUMMARY]"
+cat "$SUMMARY"
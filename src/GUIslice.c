@@ -51,6 +51,12 @@
   #include <time.h> // for FrameRate reporting
 #endif
 
+#if defined(GSLC_CFG_LINUX)
+  #include <time.h> // for clock_gettime()
+#elif defined(GSLC_CFG_ARD)
+  #include <Arduino.h> // for millis(), micros()
+#endif
+
 #if (GSLC_USE_FLOAT)
   #include <math.h>
 #endif
@@ -167,6 +173,7 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
 
   pGui->nPageMax        = nMaxPage;
   pGui->nPageCnt        = 0;
+  pGui->nPageIndRefLast = 0;
   pGui->asPage          = asPage;
 
   for (nInd = 0; nInd < GSLC_STACK__MAX; nInd++) {
@@ -176,13 +183,35 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
   }
   pGui->bRedrawNeeded      = false;
   pGui->bScreenNeedRedraw  = true;
+  pGui->bScreenNeedRedrawRgn = false;
   pGui->bScreenNeedFlip    = false;
 
   gslc_InvalidateRgnReset(pGui);
 
-   // Clear the event-pending struct
-  pGui->bEventPending = false;
-  pGui->sEventPend.eType = GSLC_EVT_NONE; 
+  // Clear the deferred events and the input event queue
+  pGui->nEventPendHead = 0;
+  pGui->nEventPendCnt = 0;
+  pGui->nInputQHead = 0;
+  pGui->nInputQCnt = 0;
+  pGui->nInputQTouchPress = 0;
+  gslc_InputQueueResetCnt(pGui);
+
+  #if (GSLC_FEATURE_TICK_SCHED)
+  // Clear the tick scheduler
+  for (nInd=0;nInd<GSLC_TICK_SCHED_MAX;nInd++) {
+    pGui->sTickSched.asEntry[nInd].pElemRef = NULL;
+    pGui->sTickSched.asEntry[nInd].nList = GSLC_TICK_LIST_NONE;
+    pGui->sTickSched.asEntry[nInd].nPrev = -1;
+    pGui->sTickSched.asEntry[nInd].nNext = -1;
+  }
+  for (nInd=0;nInd<GSLC_TICK_LIST__MAX;nInd++) {
+    pGui->sTickSched.anHead[nInd] = -1;
+    pGui->sTickSched.anTail[nInd] = -1;
+  }
+  pGui->sTickSched.nTimeLast = gslc_GetTimeMs();
+  pGui->sTickSched.bBusy = false;
+  pGui->sTickSched.bOverflow = false;
+  #endif // GSLC_FEATURE_TICK_SCHED
 
   // Default global element characteristics
   pGui->nRoundRadius = 4;
@@ -255,6 +284,30 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
   pGui->nFrameRateStart = time(NULL);
   #endif
 
+  #if (GSLC_FEATURE_COLLECT_INDEX)
+  pGui->nCollectIndexGen = 0;
+  #endif
+
+  #if (GSLC_TXT_CACHE_EN) || (GSLC_TXT_MEMO_EN)
+  pGui->nTxtGen = 0;
+  #endif
+  gslc_TxtCacheReset(pGui);
+
+  #if (GSLC_PAGE_CACHE_EN)
+  for (nInd=0;nInd<GSLC_PAGE_CACHE_MAX;nInd++) {
+    pGui->asPageCache[nInd].pvSnap = NULL;
+    pGui->asPageCache[nInd].nSnapSize = 0;
+  }
+  pGui->nPageCacheTick = 0;
+  #endif
+  #if (GSLC_POPUP_SAVE_EN)
+  pGui->sPopupSave.pvSnap = NULL;
+  pGui->sPopupSave.nSnapSize = 0;
+  #endif
+  gslc_PageCacheReset(pGui);
+
+  gslc_ResetStats(pGui);
+
   // Initialize the display and touch drivers
   if (bOk) {
     bOk &= gslc_DrvInit(pGui);
@@ -598,6 +651,10 @@ void gslc_Quit(gslc_tsGui* pGui)
 // Main polling loop for GUIslice
 void gslc_Update(gslc_tsGui* pGui)
 {
+  #if (GSLC_STATS_EN)
+  pGui->sStats.nUpdateCnt++;
+  #endif
+
   // The touch handling logic is used by both the touchscreen
   // handler as well as the GPIO/pin/keyboard input controller
   #if !defined(DRV_TOUCH_NONE)
@@ -605,6 +662,7 @@ void gslc_Update(gslc_tsGui* pGui)
   // Check to see if we had a touch initialization error
   // if so, mark this on the display.
   if (pGui->eInitStatTouch == GSLC_INITSTAT_FAIL) {
+    GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_TXT);
     gslc_DrvDrawTxt(pGui,5,5,NULL,(char*)"ERROR: InitTouch",
       GSLC_TXT_DEFAULT, GSLC_COL_RED, GSLC_COL_BLACK);
   }
@@ -612,9 +670,10 @@ void gslc_Update(gslc_tsGui* pGui)
   // --------------------------------------------------------------
   // Handle any pending events
   // --------------------------------------------------------------
-  if (pGui->bEventPending) {
-    gslc_ElemEvent((void*)pGui,pGui->sEventPend);
-    pGui->bEventPending = false;
+  // - Only issue the events that were deferred before this update
+  uint8_t nPendCnt = pGui->nEventPendCnt;
+  while ((nPendCnt > 0) && (gslc_ElemEventPendIssue(pGui))) {
+    nPendCnt--;
   }
 
   // ---------------------------------------------
@@ -629,126 +688,51 @@ void gslc_Update(gslc_tsGui* pGui)
   //       touch coordinate handling should be compiled or not
   //       (eg. if !DRV_TOUCH_NONE && !DRV_TOUCH_INPUT)
 
-  int16_t               nTouchX = 0;
-  int16_t               nTouchY = 0;
-  uint16_t              nTouchPress = 0;
-  bool                  bEvent = false;
-  gslc_teInputRawEvent  eInputEvent = GSLC_INPUT_NONE;
-  int16_t               nInputVal = 0;
-
   // Handle touchscreen presses
-  // - We clear the event queue here so that we don't fall behind
+  // - We collect all of the available input events into the input
+  //   event queue here so that we don't fall behind
   // - In the time it takes to update the display, several mouse /
   //   finger events may have occurred. If we only handle a single
   //   motion event per display update, then we may experience very
   //   lagging responsiveness from the controls.
-  // - Instead, we drain the event queue before proceeding on to the
-  //   display update, giving rise to a much more responsive GUI.
-  //   The maximum number of touch events that can be handled per
-  //   main loop is defined by the GSLC_TOUCH_MAX_EVT config param.
+  // - Instead, we drain the driver's events into the queue (merging
+  //   consecutive touch moves) before proceeding on to the display
+  //   update, giving rise to a much more responsive GUI.
+  //   The number of queued events handled per main loop is defined
+  //   by the GSLC_TOUCH_MAX_EVT or GSLC_INPUT_Q_BUDGET_MS config param.
   // - Note that SDL2 may synchronize the RenderPresent call to
   //   the VSYNC, which will effectively insert a delay into the
   //   gslc_PageRedrawGo() call below. It might be possible to
   //   adjust this blocking behavior via SDL_RENDERER_PRESENTVSYNC.
-
-  // In case we are flooded with events, limit the maximum number
-  // that we handle in one gslc_Update() call.
-  bool      bDoneEvts = false;
-  uint16_t  nNumEvts  = 0;
-  do {
-    bEvent = false;
-
-    // --------------------------------------------------------------
-    // First check physical pin inputs
-    // --------------------------------------------------------------
-
-    #if (GSLC_FEATURE_INPUT)
-    int16_t  nPinNum = -1;
-    int16_t  nPinState = 0;
-    GSLC_CB_PIN_POLL  pfuncPinPoll = pGui->pfuncPinPoll;
-
-    if (pfuncPinPoll != NULL) {
-      bEvent = (*pfuncPinPoll)(pGui,&nPinNum,&nPinState);
-      if (bEvent) {
-        // We only enter here after a pin change/edge event was detected.
-        // - PinState=1 means the pin state is now 1 (pressed)
-        // - PinState=0 means the pin state is now 0 (released)
-        eInputEvent = nPinState? GSLC_INPUT_PIN_ASSERT : GSLC_INPUT_PIN_DEASSERT;
-        nInputVal = nPinNum;
-      }
-    } 
-    #endif // GSLC_FEATURE_INPUT
-
-    // --------------------------------------------------------------
-    // If no event found yet, check touch / keyboard
-    // --------------------------------------------------------------
-    if (!bEvent) {
-      // Fetch input event, which could include touch / mouse / keyboard / pin
-      bEvent = gslc_GetTouch(pGui, &nTouchX, &nTouchY, &nTouchPress, &eInputEvent, &nInputVal);
-    }
-
-    // --------------------------------------------------------------
-    // If event found, handle it
-    // --------------------------------------------------------------
-    if (bEvent) {
-      // Track and handle the input events
-      // - Handle the events on the current page
-      switch (eInputEvent) {
-        case GSLC_INPUT_KEY_DOWN:
-          gslc_TrackInput(pGui,eInputEvent,nInputVal);
-          break;
-        case GSLC_INPUT_KEY_UP:
-          // NOTE: For now, only handling key-down events
-          // TODO: gslc_TrackInput(pGui,eInputEvent,nInputVal);
-          break;
-
-        case GSLC_INPUT_PIN_ASSERT:
-          gslc_TrackInput(pGui,eInputEvent,nInputVal);
-          break;
-        case GSLC_INPUT_PIN_DEASSERT:
-          gslc_TrackInput(pGui,eInputEvent,nInputVal);
-          break;
-
-        case GSLC_INPUT_TOUCH:
-          // Track and handle the touch events
-          // - Handle the events on the current page
-          gslc_TrackTouch(pGui,NULL,nTouchX,nTouchY,nTouchPress);
-
-          #ifdef DBG_TOUCH
-          // Highlight current touch for coordinate debug
-          gslc_tsRect rMark = gslc_ExpandRect((gslc_tsRect){(int16_t)nTouchX,(int16_t)nTouchY,1,1},1,1);
-          gslc_DrawFrameRect(pGui,rMark,GSLC_COL_YELLOW);
-          #endif
-          break;
-
-        case GSLC_INPUT_NONE:
-        default:
-          break;
-
-      }
-
-      nNumEvts++;
-    }
-
-    // Should we stop handling events?
-    if ((!bEvent) || (nNumEvts >= GSLC_TOUCH_MAX_EVT)) {
-      bDoneEvts = true;
-    }
-  } while (!bDoneEvts);
+  gslc_InputQueuePoll(pGui);
+  #if (GSLC_STATS_EN)
+  uint16_t nNumEvts = gslc_InputQueueProcess(pGui);
+  pGui->sStats.nTouchEvtLast = nNumEvts;
+  pGui->sStats.nTouchEvtTotal += nNumEvts;
+  if (nNumEvts > pGui->sStats.nTouchEvtMax) {
+    pGui->sStats.nTouchEvtMax = nNumEvts;
+  }
+  #else
+  gslc_InputQueueProcess(pGui);
+  #endif // GSLC_STATS_EN
 
   #endif // !DRV_TOUCH_NONE
 
   // ---------------------------------------------
 
-  // Issue a timer tick to all pages
-  // - This is independent of the pages in the stack
-  uint8_t nPageInd;
-  gslc_tsPage* pPage = NULL;
-  for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
-    pPage = &pGui->asPage[nPageInd];
-    gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_TICK,0,(void*)pPage,NULL);
-    gslc_PageEvent(pGui,sEvent);
+  // Issue a timer tick to the elements
+  #if (GSLC_STATS_EN)
+  uint32_t nTickStart = gslc_StatsGetTimeUs();
+  #endif
+  gslc_PageTick(pGui);
+  #if (GSLC_STATS_EN)
+  uint32_t nTickUs = gslc_StatsGetTimeUs() - nTickStart;
+  pGui->sStats.nTickUsLast = nTickUs;
+  pGui->sStats.nTickUsTotal += nTickUs;
+  if (nTickUs > pGui->sStats.nTickUsMax) {
+    pGui->sStats.nTickUsMax = nTickUs;
   }
+  #endif // GSLC_STATS_EN
 
   // Perform any redraw required for current page
   // - Only perform the redraw if at least one element
@@ -778,6 +762,34 @@ void gslc_Update(gslc_tsGui* pGui)
 
 }
 
+bool gslc_GetStats(gslc_tsGui* pGui,gslc_tsStats* pStats)
+{
+  if ((pGui == NULL) || (pStats == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "GetStats";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  #if (GSLC_STATS_EN)
+  *pStats = pGui->sStats;
+  return true;
+  #else
+  memset(pStats,0,sizeof(gslc_tsStats));
+  return false;
+  #endif // GSLC_STATS_EN
+}
+
+void gslc_ResetStats(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ResetStats";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  #if (GSLC_STATS_EN)
+  memset(&(pGui->sStats),0,sizeof(gslc_tsStats));
+  #endif // GSLC_STATS_EN
+}
+
 gslc_tsEvent  gslc_EventCreate(gslc_tsGui* pGui,gslc_teEventType eType,uint8_t nSubType,void* pvScope,void* pvData)
 {
   (void)pGui; // Unused
@@ -815,6 +827,20 @@ bool gslc_IsInWH(int16_t nSelX,int16_t nSelY,uint16_t nWidth,uint16_t nHeight)
   }
 }
 
+bool gslc_IsRectOverlap(gslc_tsRect rRect1,gslc_tsRect rRect2)
+{
+  // Empty regions never overlap
+  if ((rRect1.w == 0) || (rRect1.h == 0) || (rRect2.w == 0) || (rRect2.h == 0)) {
+    return false;
+  }
+  if ( (rRect1.x + (int16_t)rRect1.w <= rRect2.x) || (rRect2.x + (int16_t)rRect2.w <= rRect1.x) ||
+       (rRect1.y + (int16_t)rRect1.h <= rRect2.y) || (rRect2.y + (int16_t)rRect2.h <= rRect1.y) ) {
+    return false;
+  } else {
+    return true;
+  }
+}
+
 // Ensure the coordinates are increasing from nX0->nX1 and nY0->nY1
 // NOTE: UNUSED
 void gslc_OrderCoord(int16_t* pnX0,int16_t* pnY0,int16_t* pnX1,int16_t* pnY1)
@@ -959,100 +985,404 @@ bool gslc_ClipRect(gslc_tsRect* pClipRect,gslc_tsRect* pRect)
   return true;
 }
 
+bool gslc_InputQueuePush(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t nInputVal,int16_t nX,int16_t nY,uint16_t nPress)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "InputQueuePush";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
 
+  // A touch that remains pressed is a move
+  bool bMove = false;
+  if (eInputEvent == GSLC_INPUT_TOUCH) {
+    bMove = (nPress > 0) && (pGui->nInputQTouchPress > 0);
+  }
 
-gslc_tsImgRef gslc_ResetImage()
-{
-  gslc_tsImgRef sImgRef;
-  sImgRef.eImgFlags = GSLC_IMGREF_NONE;
-  sImgRef.pFname    = NULL;
-  sImgRef.pImgBuf   = NULL;
-  sImgRef.pvImgRaw  = NULL;
-  return sImgRef;
-}
+  // Merge a move into a move that is still waiting at the end of the
+  // queue. The queued move keeps its timestamp.
+  gslc_tsInputEvt* pInputEvt;
+  if ((bMove) && (pGui->nInputQCnt > 0)) {
+    pInputEvt = &(pGui->asInputQ[(pGui->nInputQHead + pGui->nInputQCnt - 1) % GSLC_INPUT_Q_MAX]);
+    if ((pInputEvt->eInputEvent == GSLC_INPUT_TOUCH) && (pInputEvt->bMove)) {
+      pInputEvt->nX     = nX;
+      pInputEvt->nY     = nY;
+      pInputEvt->nPress = nPress;
+      pGui->nInputQTouchPress = nPress;
+      pGui->nInputQMergeCnt++;
+      return true;
+    }
+  }
 
-gslc_tsImgRef gslc_GetImageFromFile(const char* pFname,gslc_teImgRefFlags eFmt)
-{
-  gslc_tsImgRef sImgRef;
-  sImgRef.eImgFlags = GSLC_IMGREF_SRC_FILE | (GSLC_IMGREF_FMT & eFmt);
-  sImgRef.pFname    = pFname;
-  sImgRef.pImgBuf   = NULL;
-  sImgRef.pvImgRaw  = NULL;
-  return sImgRef;
-}
+  if (pGui->nInputQCnt >= GSLC_INPUT_Q_MAX) {
+    pGui->nInputQDropCnt++;
+    return false;
+  }
 
-gslc_tsImgRef gslc_GetImageFromSD(const char* pFname,gslc_teImgRefFlags eFmt)
-{
-  gslc_tsImgRef sImgRef;
-#if (GSLC_SD_EN)
-  sImgRef.eImgFlags = GSLC_IMGREF_SRC_SD | (GSLC_IMGREF_FMT & eFmt);
-  sImgRef.pFname    = pFname;
-  sImgRef.pImgBuf   = NULL;
-  sImgRef.pvImgRaw  = NULL;
-#else
-  (void)pFname; // Unused
-  (void)eFmt; // Unused
-  // TODO: Change message to also handle non-Arduino output
-  GSLC_DEBUG_PRINT("ERROR: GSLC_SD_EN not enabled\n","");
-  //GSLC_DEBUG2_PRINT("ERROR: GetImageFromSD(%s) not supported as Config:GSLC_SD_EN=0\n","");
-  sImgRef.eImgFlags = GSLC_IMGREF_NONE;
-#endif
-  return sImgRef;
+  pInputEvt = &(pGui->asInputQ[(pGui->nInputQHead + pGui->nInputQCnt) % GSLC_INPUT_Q_MAX]);
+  pInputEvt->nTime        = gslc_GetTimeMs();
+  pInputEvt->eInputEvent  = eInputEvent;
+  pInputEvt->nInputVal    = nInputVal;
+  pInputEvt->nX           = nX;
+  pInputEvt->nY           = nY;
+  pInputEvt->nPress       = nPress;
+  pInputEvt->bMove        = bMove;
+  pGui->nInputQCnt++;
+  if (pGui->nInputQCnt > pGui->nInputQCntMax) {
+    pGui->nInputQCntMax = pGui->nInputQCnt;
+  }
+  if (eInputEvent == GSLC_INPUT_TOUCH) {
+    pGui->nInputQTouchPress = nPress;
+  }
+  return true;
 }
 
-gslc_tsImgRef gslc_GetImageFromRam(unsigned char* pImgBuf,gslc_teImgRefFlags eFmt)
+bool gslc_InputQueuePop(gslc_tsGui* pGui,gslc_tsInputEvt* psInputEvt)
 {
-  gslc_tsImgRef sImgRef;
-  sImgRef.eImgFlags = GSLC_IMGREF_SRC_RAM | (GSLC_IMGREF_FMT & eFmt);
-  sImgRef.pFname    = NULL;
-  sImgRef.pImgBuf   = pImgBuf;
-  sImgRef.pvImgRaw  = NULL;
-  return sImgRef;
+  if ((pGui == NULL) || (psInputEvt == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "InputQueuePop";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  if (pGui->nInputQCnt == 0) {
+    return false;
+  }
+  *psInputEvt = pGui->asInputQ[pGui->nInputQHead];
+  pGui->nInputQHead = (pGui->nInputQHead + 1) % GSLC_INPUT_Q_MAX;
+  pGui->nInputQCnt--;
+  return true;
 }
 
-
-gslc_tsImgRef gslc_GetImageFromProg(const unsigned char* pImgBuf,gslc_teImgRefFlags eFmt)
+uint16_t gslc_InputQueuePoll(gslc_tsGui* pGui)
 {
-  gslc_tsImgRef sImgRef;
-#if (GSLC_USE_PROGMEM)
-  sImgRef.eImgFlags = GSLC_IMGREF_SRC_PROG | (GSLC_IMGREF_FMT & eFmt);
+#if defined(DRV_TOUCH_NONE)
+  (void)pGui; // Unused
+  return 0;
 #else
-  // Fallback to RAM if PROGMEM not implemented
-  sImgRef.eImgFlags = GSLC_IMGREF_SRC_RAM | (GSLC_IMGREF_FMT & eFmt);
-#endif
-  sImgRef.pFname    = NULL;
-  sImgRef.pImgBuf   = pImgBuf;
-  sImgRef.pvImgRaw  = NULL;
-  return sImgRef;
-}
+  int16_t               nTouchX = 0;
+  int16_t               nTouchY = 0;
+  uint16_t              nTouchPress = 0;
+  bool                  bEvent = false;
+  gslc_teInputRawEvent  eInputEvent = GSLC_INPUT_NONE;
+  int16_t               nInputVal = 0;
 
+  // Limit the number of polls since merged touch moves
+  // don't occupy any additional space in the queue
+  uint16_t  nNumEvts = 0;
+  uint16_t  nPollInd;
+  uint32_t  nMergeCnt;
+  for (nPollInd = 0; nPollInd < GSLC_INPUT_Q_MAX; nPollInd++) {
+    // Leave any further events with the driver until there is space
+    if (pGui->nInputQCnt >= GSLC_INPUT_Q_MAX) {
+      break;
+    }
+    bEvent = false;
+    nTouchX = 0;
+    nTouchY = 0;
+    nTouchPress = 0;
 
-// Sine function with optional lookup table
-// - Note that the n64Ang range is limited by 16-bit integers
-//   to an effective degree range of -511 to +511 degrees,
-//   defined by the max integer range: 32767/64.
-int16_t gslc_sinFX(int16_t n64Ang)
-{
-  int16_t   nRetValS;
+    // --------------------------------------------------------------
+    // First check physical pin inputs
+    // --------------------------------------------------------------
 
-#if (GSLC_USE_FLOAT)
-  // Use floating-point math library function
+    #if (GSLC_FEATURE_INPUT)
+    int16_t  nPinNum = -1;
+    int16_t  nPinState = 0;
+    GSLC_CB_PIN_POLL  pfuncPinPoll = pGui->pfuncPinPoll;
 
-  // Calculate angle in radians
-  float fAngRad = n64Ang*GSLC_2PI/(360.0*64.0);
-  // Perform floating point calc
-  float fSin = sin(fAngRad);
-  // Return as fixed point result
-  nRetValS = fSin * 32767.0;
-  return nRetValS;
+    if (pfuncPinPoll != NULL) {
+      bEvent = (*pfuncPinPoll)(pGui,&nPinNum,&nPinState);
+      if (bEvent) {
+        // We only enter here after a pin change/edge event was detected.
+        // - PinState=1 means the pin state is now 1 (pressed)
+        // - PinState=0 means the pin state is now 0 (released)
+        eInputEvent = nPinState? GSLC_INPUT_PIN_ASSERT : GSLC_INPUT_PIN_DEASSERT;
+        nInputVal = nPinNum;
+      }
+    }
+    #endif // GSLC_FEATURE_INPUT
+
+    // --------------------------------------------------------------
+    // If no event found yet, check touch / keyboard
+    // --------------------------------------------------------------
+    if (!bEvent) {
+      // Fetch input event, which could include touch / mouse / keyboard / pin
+      bEvent = gslc_GetTouch(pGui, &nTouchX, &nTouchY, &nTouchPress, &eInputEvent, &nInputVal);
+    }
+
+    if (!bEvent) {
+      break;
+    }
+    if (eInputEvent != GSLC_INPUT_NONE) {
+      nMergeCnt = pGui->nInputQMergeCnt;
+      gslc_InputQueuePush(pGui,eInputEvent,nInputVal,nTouchX,nTouchY,nTouchPress);
+      nNumEvts++;
+      // Stop once a touch move has been merged, as drivers that
+      // report a held touch on every call would otherwise be read
+      // repeatedly without adding anything to the queue
+      if (pGui->nInputQMergeCnt != nMergeCnt) {
+        break;
+      }
+    }
+  }
+  return nNumEvts;
+#endif // !DRV_TOUCH_NONE
+}
 
+uint16_t gslc_InputQueueProcess(gslc_tsGui* pGui)
+{
+#if defined(DRV_TOUCH_NONE)
+  (void)pGui; // Unused
+  return 0;
 #else
-  // TODO: Clean up excess integer typecasting
+  gslc_tsInputEvt sInputEvt;
+  uint16_t        nNumEvts = 0;
+  #if (GSLC_INPUT_Q_BUDGET_MS > 0)
+  uint32_t        nTimeStart = gslc_GetTimeMs();
+  #endif
 
-  // Use lookup tables
-  bool bNegate = false;
+  while (gslc_InputQueuePop(pGui,&sInputEvt)) {
+    pGui->nInputQLatency = gslc_GetTimeMs() - sInputEvt.nTime;
 
-  // Support multiple waveform periods
+    // Track and handle the input events
+    // - Handle the events on the current page
+    switch (sInputEvt.eInputEvent) {
+      case GSLC_INPUT_KEY_DOWN:
+        gslc_TrackInput(pGui,sInputEvt.eInputEvent,sInputEvt.nInputVal);
+        break;
+      case GSLC_INPUT_KEY_UP:
+        // NOTE: For now, only handling key-down events
+        // TODO: gslc_TrackInput(pGui,eInputEvent,nInputVal);
+        break;
+
+      case GSLC_INPUT_PIN_ASSERT:
+        gslc_TrackInput(pGui,sInputEvt.eInputEvent,sInputEvt.nInputVal);
+        break;
+      case GSLC_INPUT_PIN_DEASSERT:
+        gslc_TrackInput(pGui,sInputEvt.eInputEvent,sInputEvt.nInputVal);
+        break;
+
+      case GSLC_INPUT_TOUCH:
+        // Track and handle the touch events
+        // - Handle the events on the current page
+        gslc_TrackTouch(pGui,NULL,sInputEvt.nX,sInputEvt.nY,sInputEvt.nPress);
+
+        #ifdef DBG_TOUCH
+        // Highlight current touch for coordinate debug
+        gslc_tsRect rMark = gslc_ExpandRect((gslc_tsRect){(int16_t)sInputEvt.nX,(int16_t)sInputEvt.nY,1,1},1,1);
+        gslc_DrawFrameRect(pGui,rMark,GSLC_COL_YELLOW);
+        #endif
+        break;
+
+      case GSLC_INPUT_NONE:
+      default:
+        break;
+
+    }
+    nNumEvts++;
+
+    // Should we stop handling events?
+    #if (GSLC_INPUT_Q_BUDGET_MS > 0)
+    if ((gslc_GetTimeMs() - nTimeStart) >= GSLC_INPUT_Q_BUDGET_MS) {
+      break;
+    }
+    #else
+    if (nNumEvts >= GSLC_TOUCH_MAX_EVT) {
+      break;
+    }
+    #endif
+  }
+  return nNumEvts;
+#endif // !DRV_TOUCH_NONE
+}
+
+uint8_t gslc_InputQueueGetDepth(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "InputQueueGetDepth";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return 0;
+  }
+  return pGui->nInputQCnt;
+}
+
+void gslc_InputQueueGetCnt(gslc_tsGui* pGui,uint8_t* pnDepthMax,uint32_t* pnDropCnt,uint32_t* pnMergeCnt,uint32_t* pnLatency)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "InputQueueGetCnt";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  if (pnDepthMax) { *pnDepthMax = pGui->nInputQCntMax; }
+  if (pnDropCnt)  { *pnDropCnt  = pGui->nInputQDropCnt; }
+  if (pnMergeCnt) { *pnMergeCnt = pGui->nInputQMergeCnt; }
+  if (pnLatency)  { *pnLatency  = pGui->nInputQLatency; }
+}
+
+void gslc_InputQueueResetCnt(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "InputQueueResetCnt";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  pGui->nInputQCntMax   = pGui->nInputQCnt;
+  pGui->nInputQDropCnt  = 0;
+  pGui->nInputQMergeCnt = 0;
+  pGui->nInputQLatency  = 0;
+}
+
+gslc_teClipRes gslc_ClipRectTest(gslc_tsRect* pClipRect,gslc_tsRect rRect)
+{
+  gslc_tsRect rVisible = rRect;
+  if (!gslc_ClipRect(pClipRect,&rVisible)) {
+    return GSLC_CLIP_OUT;
+  }
+  if ((rVisible.x == rRect.x) && (rVisible.y == rRect.y) &&
+      (rVisible.w == rRect.w) && (rVisible.h == rRect.h)) {
+    return GSLC_CLIP_IN;
+  }
+  return GSLC_CLIP_PART;
+}
+
+
+
+gslc_tsImgRef gslc_ResetImage()
+{
+  gslc_tsImgRef sImgRef;
+  sImgRef.eImgFlags = GSLC_IMGREF_NONE;
+  sImgRef.pFname    = NULL;
+  sImgRef.pImgBuf   = NULL;
+  sImgRef.pvImgRaw  = NULL;
+  return sImgRef;
+}
+
+uint32_t gslc_StatsGetTimeUs()
+{
+  #if (GSLC_STATS_EN) && defined(GSLC_CFG_LINUX)
+  struct timespec sTime;
+  clock_gettime(CLOCK_MONOTONIC, &sTime);
+  return (uint32_t)((uint64_t)sTime.tv_sec * 1000000 + sTime.tv_nsec / 1000);
+  #elif (GSLC_STATS_EN) && defined(GSLC_CFG_ARD)
+  return (uint32_t)micros();
+  #else
+  return 0;
+  #endif
+}
+
+uint32_t gslc_GetTimeMs()
+{
+  #if defined(GSLC_CFG_LINUX)
+  struct timespec sTime;
+  clock_gettime(CLOCK_MONOTONIC, &sTime);
+  return (uint32_t)((uint64_t)sTime.tv_sec * 1000 + sTime.tv_nsec / 1000000);
+  #elif defined(GSLC_CFG_ARD)
+  return (uint32_t)millis();
+  #else
+  return 0;
+  #endif
+}
+
+void gslc_StatsElemRedraw(gslc_tsGui* pGui,int16_t nType)
+{
+  #if (GSLC_STATS_EN)
+  if (nType >= GSLC_TYPE_BASE_EXTEND) {
+    nType -= GSLC_TYPE_BASE_EXTEND;
+    if (nType >= GSLC_STATS_TYPEX_MAX) {
+      nType = GSLC_STATS_TYPEX_MAX-1;
+    }
+    pGui->sStats.anElemRedrawX[nType]++;
+  } else if ((nType >= 0) && (nType <= GSLC_TYPE_LINE)) {
+    pGui->sStats.anElemRedraw[nType]++;
+  }
+  #else
+  (void)pGui; // Unused
+  (void)nType; // Unused
+  #endif // GSLC_STATS_EN
+}
+
+gslc_tsImgRef gslc_GetImageFromFile(const char* pFname,gslc_teImgRefFlags eFmt)
+{
+  gslc_tsImgRef sImgRef;
+  sImgRef.eImgFlags = GSLC_IMGREF_SRC_FILE | (GSLC_IMGREF_FMT & eFmt);
+  sImgRef.pFname    = pFname;
+  sImgRef.pImgBuf   = NULL;
+  sImgRef.pvImgRaw  = NULL;
+  return sImgRef;
+}
+
+gslc_tsImgRef gslc_GetImageFromSD(const char* pFname,gslc_teImgRefFlags eFmt)
+{
+  gslc_tsImgRef sImgRef;
+#if (GSLC_SD_EN)
+  sImgRef.eImgFlags = GSLC_IMGREF_SRC_SD | (GSLC_IMGREF_FMT & eFmt);
+  sImgRef.pFname    = pFname;
+  sImgRef.pImgBuf   = NULL;
+  sImgRef.pvImgRaw  = NULL;
+#else
+  (void)pFname; // Unused
+  (void)eFmt; // Unused
+  // TODO: Change message to also handle non-Arduino output
+  GSLC_DEBUG_PRINT("ERROR: GSLC_SD_EN not enabled\n","");
+  //GSLC_DEBUG2_PRINT("ERROR: GetImageFromSD(%s) not supported as Config:GSLC_SD_EN=0\n","");
+  sImgRef.eImgFlags = GSLC_IMGREF_NONE;
+#endif
+  return sImgRef;
+}
+
+gslc_tsImgRef gslc_GetImageFromRam(unsigned char* pImgBuf,gslc_teImgRefFlags eFmt)
+{
+  gslc_tsImgRef sImgRef;
+  sImgRef.eImgFlags = GSLC_IMGREF_SRC_RAM | (GSLC_IMGREF_FMT & eFmt);
+  sImgRef.pFname    = NULL;
+  sImgRef.pImgBuf   = pImgBuf;
+  sImgRef.pvImgRaw  = NULL;
+  return sImgRef;
+}
+
+
+gslc_tsImgRef gslc_GetImageFromProg(const unsigned char* pImgBuf,gslc_teImgRefFlags eFmt)
+{
+  gslc_tsImgRef sImgRef;
+#if (GSLC_USE_PROGMEM)
+  sImgRef.eImgFlags = GSLC_IMGREF_SRC_PROG | (GSLC_IMGREF_FMT & eFmt);
+#else
+  // Fallback to RAM if PROGMEM not implemented
+  sImgRef.eImgFlags = GSLC_IMGREF_SRC_RAM | (GSLC_IMGREF_FMT & eFmt);
+#endif
+  sImgRef.pFname    = NULL;
+  sImgRef.pImgBuf   = pImgBuf;
+  sImgRef.pvImgRaw  = NULL;
+  return sImgRef;
+}
+
+
+// Sine function with optional lookup table
+// - Note that the n64Ang range is limited by 16-bit integers
+//   to an effective degree range of -511 to +511 degrees,
+//   defined by the max integer range: 32767/64.
+int16_t gslc_sinFX(int16_t n64Ang)
+{
+  int16_t   nRetValS;
+
+#if (GSLC_USE_FLOAT)
+  // Use floating-point math library function
+
+  // Calculate angle in radians
+  float fAngRad = n64Ang*GSLC_2PI/(360.0*64.0);
+  // Perform floating point calc
+  float fSin = sin(fAngRad);
+  // Return as fixed point result
+  nRetValS = fSin * 32767.0;
+  return nRetValS;
+
+#else
+  // TODO: Clean up excess integer typecasting
+
+  // Use lookup tables
+  bool bNegate = false;
+
+  // Support multiple waveform periods
   if (n64Ang >= 360*64) {
     n64Ang = n64Ang - (360*64);
   } else if (n64Ang <= -360*64) {
@@ -1141,6 +1471,91 @@ void gslc_PolarToXY(uint16_t nRad,int16_t n64Ang,int16_t* nDX,int16_t* nDY)
   *nDY = nTmp / 32767;
 }
 
+void gslc_PolarCacheReset(gslc_tsPolarCache* pCache)
+{
+  if (pCache == NULL) {
+    return;
+  }
+  pCache->nStep64 = 0;
+  pCache->nNumPts = 0;
+}
+
+void gslc_PolarCacheSetStep(gslc_tsPolarCache* pCache,int16_t nStep64)
+{
+  if (pCache == NULL) {
+    return;
+  }
+  // Nothing to do if the table already matches the step
+  if ((pCache->nNumPts > 0) && (pCache->nStep64 == nStep64)) {
+    return;
+  }
+  pCache->nStep64 = nStep64;
+  pCache->nNumPts = 0;
+
+#if (GSLC_POLAR_CACHE_EN)
+  // Only cache steps that land exactly on a full revolution
+  if ((nStep64 <= 0) || (((int32_t)360*64) % nStep64 != 0)) {
+    return;
+  }
+  uint16_t nNumSeg = ((int32_t)360*64) / nStep64;
+  if (nNumSeg > GSLC_POLAR_CACHE_MAX) {
+    return;
+  }
+  // Include the closing entry at 360 degrees so that the far edge
+  // of the last segment is also found in the table
+  uint16_t nInd;
+  int16_t  n64Ang;
+  for (nInd=0;nInd<=nNumSeg;nInd++) {
+    n64Ang = (int32_t)nInd * nStep64;
+    pCache->anSin[nInd] = gslc_sinFX(n64Ang);
+    pCache->anCos[nInd] = gslc_cosFX(n64Ang);
+  }
+  pCache->nNumPts = nNumSeg+1;
+#endif // GSLC_POLAR_CACHE_EN
+}
+
+void gslc_PolarCacheToXY(gslc_tsPolarCache* pCache,uint16_t nRad,int16_t n64Ang,int16_t* nDX,int16_t* nDY)
+{
+#if (GSLC_POLAR_CACHE_EN)
+  if ((pCache != NULL) && (pCache->nNumPts > 0) && (n64Ang >= 0) && (n64Ang % pCache->nStep64 == 0)) {
+    uint16_t nInd = n64Ang / pCache->nStep64;
+    if (nInd < pCache->nNumPts) {
+      int32_t nTmp;
+      // Same scaling as gslc_PolarToXY()
+      nTmp = (int32_t)nRad *  pCache->anSin[nInd];
+      *nDX = nTmp / 32767;
+      nTmp = (int32_t)nRad * -pCache->anCos[nInd];
+      *nDY = nTmp / 32767;
+      return;
+    }
+  }
+#else
+  (void)pCache; // Unused
+#endif // GSLC_POLAR_CACHE_EN
+  gslc_PolarToXY(nRad,n64Ang,nDX,nDY);
+}
+
+void gslc_PolarIndicCalc(gslc_tsPolarIndic* pIndic,uint16_t nLen,uint16_t nTip,int16_t n64Ang)
+{
+  if (pIndic == NULL) {
+    return;
+  }
+#if (GSLC_POLAR_CACHE_EN)
+  // Reuse the vertices if the indicator hasn't changed
+  if ((pIndic->bValid) && (pIndic->n64Ang == n64Ang) && (pIndic->nLen == nLen) && (pIndic->nTip == nTip)) {
+    return;
+  }
+#endif // GSLC_POLAR_CACHE_EN
+  gslc_PolarToXY(nLen,n64Ang,&pIndic->sTip.x,&pIndic->sTip.y);
+  gslc_PolarToXY(nLen-nTip,n64Ang,&pIndic->sTipBase.x,&pIndic->sTipBase.y);
+  gslc_PolarToXY(nTip,n64Ang-90*64,&pIndic->sBase1.x,&pIndic->sBase1.y);
+  gslc_PolarToXY(nTip,n64Ang+90*64,&pIndic->sBase2.x,&pIndic->sBase2.y);
+  pIndic->n64Ang  = n64Ang;
+  pIndic->nLen    = nLen;
+  pIndic->nTip    = nTip;
+  pIndic->bValid  = true;
+}
+
 // Call with nMidAmt=500 to create simple linear blend between two colors
 gslc_tsColor gslc_ColorBlend2(gslc_tsColor colStart,gslc_tsColor colEnd,uint16_t nMidAmt,uint16_t nBlendAmt)
 {
@@ -1188,6 +1603,7 @@ void gslc_DrawSetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 
 #if (DRV_HAS_DRAW_POINT)
   // Call optimized driver point drawing
+  GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_POINT);
   gslc_DrvDrawPoint(pGui,nX,nY,nCol);
 #else
   GSLC_DEBUG2_PRINT("ERROR: Mandatory DrvDrawPoint() is not defined in driver\n");
@@ -1203,6 +1619,7 @@ void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t
 
 #if (DRV_HAS_DRAW_LINE)
   // Call optimized driver line drawing
+  GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_LINE);
   gslc_DrvDrawLine(pGui,nX0,nY0,nX1,nY1,nCol);
 
 #else
@@ -1241,6 +1658,7 @@ void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t
   if (!bDone) {
     for (;;) {
       // Set the pixel
+      GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_POINT);
       gslc_DrvDrawPoint(pGui,nX0,nY0,nCol);
 
       // Calculate next coordinates
@@ -1258,10 +1676,21 @@ void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t
 
 void gslc_DrawLineH(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nW,gslc_tsColor nCol)
 {
+#if (DRV_HAS_DRAW_LINE)
+  // Call optimized driver line drawing, which fills
+  // horizontal lines as a single span
+  if (nW == 0) {
+    return;
+  }
+  GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_LINE);
+  gslc_DrvDrawLine(pGui,nX,nY,(int16_t)(nX+nW-1),nY,nCol);
+#else
   uint16_t nOffset;
   for (nOffset=0;nOffset<nW;nOffset++) {
+    GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_POINT);
     gslc_DrvDrawPoint(pGui,nX+nOffset,nY,nCol);
   }
+#endif
 
   gslc_PageFlipSet(pGui,true);
 }
@@ -1270,6 +1699,7 @@ void gslc_DrawLineV(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nH,gslc_ts
 {
   uint16_t nOffset;
   for (nOffset=0;nOffset<nH;nOffset++) {
+    GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_POINT);
     gslc_DrvDrawPoint(pGui,nX,nY+nOffset,nCol);
   }
 
@@ -1298,6 +1728,7 @@ void gslc_DrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 
 #if (DRV_HAS_DRAW_RECT_FRAME)
   // Call optimized driver implementation
+  GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_RECT_FRAME);
   gslc_DrvDrawFrameRect(pGui,rRect,nCol);
 #else
   // Emulate rect frame with four lines
@@ -1325,9 +1756,11 @@ void gslc_DrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,
 
 #if (DRV_HAS_DRAW_RECT_ROUND_FRAME)
   // Call optimized driver implementation
+  GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_RECT_FRAME);
   gslc_DrvDrawFrameRoundRect(pGui,rRect,nRadius,nCol);
 #else
   // TODO: Add emulation of rounded rects. For now fallback to square corners
+  GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_RECT_FRAME);
   gslc_DrvDrawFrameRect(pGui,rRect,nCol);
 #endif
 
@@ -1344,6 +1777,7 @@ void gslc_DrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 
 #if (DRV_HAS_DRAW_RECT_FILL)
   // Call optimized driver implementation
+  GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_RECT_FILL);
   gslc_DrvDrawFillRect(pGui,rRect,nCol);
 #else
   // Emulate it with individual line draws
@@ -1358,6 +1792,45 @@ void gslc_DrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   gslc_PageFlipSet(pGui,true);
 }
 
+bool gslc_DrawCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY)
+{
+#if (DRV_HAS_COPY_RECT)
+  gslc_tsRect rDisp = { 0, 0, pGui->nDispW, pGui->nDispH };
+  gslc_tsRect rClip = gslc_GetClipRect(pGui);
+  gslc_tsRect rDst = { nDstX, nDstY, rSrc.w, rSrc.h };
+  gslc_tsRect rDstVis = rDst;
+
+  // The source must be entirely on the display
+  if ((rSrc.x < 0) || (rSrc.y < 0) ||
+      (rSrc.x + (int16_t)rSrc.w > rDisp.w) || (rSrc.y + (int16_t)rSrc.h > rDisp.h)) {
+    return false;
+  }
+
+  // Limit the destination to the clipping region and
+  // adjust the source to match
+  if ((rSrc.w == 0) || (rSrc.h == 0) || (!gslc_ClipRect(&rClip,&rDstVis))) {
+    return true;
+  }
+  rSrc.x += rDstVis.x - rDst.x;
+  rSrc.y += rDstVis.y - rDst.y;
+  rSrc.w  = rDstVis.w;
+  rSrc.h  = rDstVis.h;
+
+  GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_COPY);
+  if (!gslc_DrvCopyRect(pGui,rSrc,rDstVis.x,rDstVis.y)) {
+    return false;
+  }
+  gslc_PageFlipSet(pGui,true);
+  return true;
+#else
+  (void)pGui; // Unused
+  (void)rSrc; // Unused
+  (void)nDstX; // Unused
+  (void)nDstY; // Unused
+  return false;
+#endif // DRV_HAS_COPY_RECT
+}
+
 void gslc_DrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColor nCol)
 {
   // Ensure dimensions are valid
@@ -1367,9 +1840,11 @@ void gslc_DrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,g
 
 #if (DRV_HAS_DRAW_RECT_ROUND_FILL)
   // Call optimized driver implementation
+  GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_RECT_FILL);
   gslc_DrvDrawFillRoundRect(pGui,rRect,nRadius,nCol);
 #else
   // TODO: Add emulation of rounded rects. For now fallback to square corners
+  GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_RECT_FILL);
   gslc_DrvDrawFillRect(pGui,rRect,nCol);
 #endif
 
@@ -1447,6 +1922,51 @@ void gslc_UnionRect(gslc_tsRect* pRect,gslc_tsRect rAddRect)
 
 }
 
+bool gslc_RectListAdd(gslc_tsRect* asRect,uint8_t* pnRectCnt,uint8_t nRectMax,gslc_tsRect rAddRect)
+{
+  uint8_t   nInd;
+  uint32_t  nAreaSum,nAreaUnion;
+  bool      bMerged;
+  gslc_tsRect rUnion;
+
+  // Absorb any regions in the list that the new region overlaps or
+  // that are close enough that a single pass would be cheaper.
+  // Repeat the search after each merge since the enlarged region
+  // may now overlap other regions in the list. This ensures that
+  // the regions in the list never overlap each other.
+  do {
+    bMerged = false;
+    for (nInd=0;nInd<*pnRectCnt;nInd++) {
+      rUnion = asRect[nInd];
+      nAreaSum = (uint32_t)rUnion.w * rUnion.h + (uint32_t)rAddRect.w * rAddRect.h;
+      gslc_UnionRect(&rUnion, rAddRect);
+      nAreaUnion = (uint32_t)rUnion.w * rUnion.h;
+      if ((gslc_IsRectOverlap(asRect[nInd], rAddRect)) ||
+          (nAreaUnion * 100 <= nAreaSum * (100 + GSLC_INVALIDATE_MERGE_PCT))) {
+        // Merge and remove the absorbed region from the list
+        rAddRect = rUnion;
+        (*pnRectCnt)--;
+        asRect[nInd] = asRect[*pnRectCnt];
+        bMerged = true;
+        break;
+      }
+    }
+  } while (bMerged);
+
+  if (*pnRectCnt < nRectMax) {
+    asRect[(*pnRectCnt)++] = rAddRect;
+    return false;
+  }
+  // No more room in the list, so fall back to the
+  // bounding region of all regions
+  for (nInd=0;nInd<*pnRectCnt;nInd++) {
+    gslc_UnionRect(&rAddRect, asRect[nInd]);
+  }
+  asRect[0] = rAddRect;
+  *pnRectCnt = 1;
+  return true;
+}
+
 void gslc_InvalidateRgnReset(gslc_tsGui* pGui)
 {
 #if defined(DBG_REDRAW)
@@ -1454,6 +1974,8 @@ void gslc_InvalidateRgnReset(gslc_tsGui* pGui)
 #endif
   pGui->bInvalidateEn = false;
   pGui->rInvalidateRect = (gslc_tsRect) { 0, 0, 1, 1 };
+  pGui->nInvalidateRectCnt = 0;
+  pGui->nInvalidateRectCur = -1;
 }
 
 void gslc_InvalidateRgnScreen(gslc_tsGui* pGui)
@@ -1463,6 +1985,8 @@ void gslc_InvalidateRgnScreen(gslc_tsGui* pGui)
 #endif
   pGui->bInvalidateEn = true;
   pGui->rInvalidateRect = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+  pGui->asInvalidateRect[0] = pGui->rInvalidateRect;
+  pGui->nInvalidateRectCnt = 1;
 }
 
 void gslc_InvalidateRgnPage(gslc_tsGui* pGui, gslc_tsPage* pPage)
@@ -1480,32 +2004,97 @@ void gslc_InvalidateRgnPage(gslc_tsGui* pGui, gslc_tsPage* pPage)
 }
 
 
+gslc_tsRect gslc_InvalidateRgnPad(gslc_tsGui* pGui, gslc_tsRect rElem)
+{
+  // Pad the region to cover any drawing beyond the element's rect
+  gslc_tsRect rDisp = {0,0,pGui->nDispW,pGui->nDispH};
+  gslc_tsRect rPad  = gslc_ExpandRect(rElem,GSLC_INVALIDATE_PAD,GSLC_INVALIDATE_PAD);
+  if ((rElem.w == 0) || (rElem.h == 0) || (!gslc_ClipRect(&rDisp,&rPad))) {
+    return rElem;
+  }
+  return rPad;
+}
+
+void gslc_InvalidateRgnElem(gslc_tsGui* pGui, gslc_tsRect rElem)
+{
+  gslc_InvalidateRgnAdd(pGui, gslc_InvalidateRgnPad(pGui, rElem));
+}
+
 void gslc_InvalidateRgnAdd(gslc_tsGui* pGui, gslc_tsRect rAddRect)
 {
+  // Maintain the bounding region of all invalidated regions
   if (pGui->bInvalidateEn) {
     gslc_UnionRect(&(pGui->rInvalidateRect), rAddRect);
   } else {
     pGui->bInvalidateEn = true;
     pGui->rInvalidateRect = rAddRect;
+    pGui->nInvalidateRectCnt = 0;
+  }
+
+  // Empty regions don't need to be tracked in the region list
+  if ((rAddRect.w == 0) || (rAddRect.h == 0)) {
+    return;
+  }
+
+  // Leave the region list untouched while it is being redrawn
+  // since the list is reset at the end of the redraw
+  if (pGui->nInvalidateRectCur >= 0) {
+    return;
+  }
+
+  if (gslc_RectListAdd(pGui->asInvalidateRect,&(pGui->nInvalidateRectCnt),GSLC_INVALIDATE_RECT_MAX,rAddRect)) {
+    // The list was full, so use the bounding region of
+    // all invalidated regions
+    pGui->asInvalidateRect[0] = pGui->rInvalidateRect;
   }
 }
 
 
-// Draw a circle using midpoint circle algorithm
-// - Algorithm reference: https://en.wikipedia.org/wiki/Midpoint_circle_algorithm
-void gslc_DrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
-  uint16_t nRadius,gslc_tsColor nCol)
+bool gslc_InvalidateRgnTest(gslc_tsGui* pGui, gslc_tsRect rRect, bool bRedrawPend)
 {
+  uint8_t nInd;
+  int8_t  nCur = pGui->nInvalidateRectCur;
 
-  #if (DRV_HAS_DRAW_CIRCLE_FRAME)
-    // Call optimized driver implementation
-    gslc_DrvDrawFrameCircle(pGui,nMidX,nMidY,nRadius,nCol);
-  #else
-    // Emulate circle with point drawing
-
-    int16_t nX    = nRadius;
-    int16_t nY    = 0;
-    int16_t nErr  = 0;
+  // Not redrawing a specific region, so everything is drawn
+  if (nCur < 0) {
+    return true;
+  }
+
+  if (gslc_IsRectOverlap(rRect, pGui->asInvalidateRect[nCur])) {
+    return true;
+  }
+
+  // Anything with a pending redraw that lies outside all of the
+  // regions is passed through in the final region so that its
+  // redraw state is still cleared (its drawing is fully clipped)
+  if ((!bRedrawPend) || (nCur + 1 < pGui->nInvalidateRectCnt)) {
+    return false;
+  }
+  for (nInd=0;nInd<pGui->nInvalidateRectCnt;nInd++) {
+    if (gslc_IsRectOverlap(rRect, pGui->asInvalidateRect[nInd])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+// Draw a circle using midpoint circle algorithm
+// - Algorithm reference: https://en.wikipedia.org/wiki/Midpoint_circle_algorithm
+void gslc_DrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
+  uint16_t nRadius,gslc_tsColor nCol)
+{
+
+  #if (DRV_HAS_DRAW_CIRCLE_FRAME)
+    // Call optimized driver implementation
+    GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_CIRCLE);
+    gslc_DrvDrawFrameCircle(pGui,nMidX,nMidY,nRadius,nCol);
+  #else
+    // Emulate circle with point drawing
+
+    int16_t nX    = nRadius;
+    int16_t nY    = 0;
+    int16_t nErr  = 0;
 
     #if (DRV_HAS_DRAW_POINTS)
       gslc_tsPt asPt[8];
@@ -1519,6 +2108,7 @@ void gslc_DrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
         asPt[5] = (gslc_tsPt){nMidX - nY, nMidY - nX};
         asPt[6] = (gslc_tsPt){nMidX + nY, nMidY - nX};
         asPt[7] = (gslc_tsPt){nMidX + nX, nMidY - nY};
+        GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_POINTS);
         gslc_DrvDrawPoints(pGui,asPt,8,nCol);
 
         nY    += 1;
@@ -1533,6 +2123,7 @@ void gslc_DrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
     #elif (DRV_HAS_DRAW_POINT)
       while (nX >= nY)
       {
+        GSLC_STATS_DRV_N(pGui,GSLC_STATS_DRV_POINT,8);
         gslc_DrvDrawPoint(pGui,nMidX + nX, nMidY + nY,nCol);
         gslc_DrvDrawPoint(pGui,nMidX + nY, nMidY + nX,nCol);
         gslc_DrvDrawPoint(pGui,nMidX - nY, nMidY + nX,nCol);
@@ -1570,6 +2161,7 @@ void gslc_DrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
 
   #if (DRV_HAS_DRAW_CIRCLE_FILL)
     // Call optimized driver implementation
+    GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_CIRCLE);
     gslc_DrvDrawFillCircle(pGui,nMidX,nMidY,nRadius,nCol);
   #else
     // Emulate circle with line drawing
@@ -1623,6 +2215,7 @@ void gslc_DrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 
   #if (DRV_HAS_DRAW_TRI_FRAME)
     // Call optimized driver implementation
+    GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_TRI);
     gslc_DrvDrawFrameTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
   #else
     // Draw triangle with three lines
@@ -1654,86 +2247,554 @@ void gslc_DrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 
   #if (DRV_HAS_DRAW_TRI_FILL)
     // Call optimized driver implementation
+    GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_TRI);
     gslc_DrvDrawFillTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
 
   #else
-    // Emulate triangle fill
-
-    // Algorithm:
-    // - An arbitrary triangle is cut into two portions:
-    //   1) a flat bottom triangle
-    //   2) a flat top triangle
-    // - Sort the vertices in descending vertical position.
-    //   This serves two purposes:
-    //   1) ensures that the division between the flat bottom
-    //      and flat top triangles occurs at Y=Y1
-    //   2) ensure that we avoid division-by-zero in the for loops
-    // - Walk each scan line and determine the intersection
-    //   between triangle side A & B (flat bottom triangle)
-    //   and then C and B (flat top triangle) using line slopes.
+    // Emulate triangle fill with the scanline polygon filler
+    gslc_tsPt asPt[3];
+    asPt[0] = (gslc_tsPt) { nX0, nY0 };
+    asPt[1] = (gslc_tsPt) { nX1, nY1 };
+    asPt[2] = (gslc_tsPt) { nX2, nY2 };
+    gslc_DrawFillPoly(pGui,asPt,3,nCol);
 
-    // Sort vertices
-    // - Want nY0 >= nY1 >= nY2
-    if (nY2>nY1) { gslc_SwapCoords(&nX2,&nY2,&nX1,&nY1); }
-    if (nY1>nY0) { gslc_SwapCoords(&nX0,&nY0,&nX1,&nY1); }
-    if (nY2>nY1) { gslc_SwapCoords(&nX2,&nY2,&nX1,&nY1); }
+  #endif  // DRV_HAS_DRAW_TRI_FILL
+
+  gslc_PageFlipSet(pGui,true);
+}
+
+// ------------------------------------------------------------------------
+// Clipped Drawing Functions
+// - These are called by drivers (with GSLC_CLIP_EN) before they
+//   use an accelerated drawing API that doesn't support clipping.
+// - Partially visible shapes are decomposed into the driver's
+//   point, line and filled rect primitives as these perform clipping.
+// ------------------------------------------------------------------------
+
+// Draw a horizontal span as a single-row filled rect
+// - The driver's filled rect routine performs the clipping
+void gslc_ClipDrawSpan(gslc_tsGui* pGui,int16_t nX0,int16_t nX1,int16_t nY,gslc_tsColor nCol)
+{
+  if (nX1 < nX0) {
+    return;
+  }
+  gslc_tsRect rSpan = (gslc_tsRect) { nX0, nY, (uint16_t)(nX1-nX0+1), 1 };
+  GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_RECT_FILL);
+  gslc_DrvDrawFillRect(pGui,rSpan,nCol);
+}
+
+// Draw the selected quadrants of a circle using the midpoint algorithm
+// - nQuadMask: 0x1=top-left, 0x2=top-right, 0x4=bottom-right, 0x8=bottom-left
+// - nOffsetW, nOffsetH: additional offset between the left/right
+//   and top/bottom quadrants (used for rounded rects)
+void gslc_ClipDrawCircleQuad(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,
+  uint8_t nQuadMask,int16_t nOffsetW,int16_t nOffsetH,bool bFill,gslc_tsColor nCol)
+{
+  int16_t nX    = nRadius;
+  int16_t nY    = 0;
+  int16_t nErr  = 0;
+  int16_t nLeft = nMidX;
+  int16_t nRight= nMidX + nOffsetW;
+  int16_t nTop  = nMidY;
+  int16_t nBot  = nMidY + nOffsetH;
+
+  while (nX >= nY) {
+    if (bFill) {
+      // Each span covers both left and right quadrants
+      if (nQuadMask & 0x3) {
+        gslc_ClipDrawSpan(pGui,nLeft-nX,nRight+nX,nTop-nY,nCol);
+        gslc_ClipDrawSpan(pGui,nLeft-nY,nRight+nY,nTop-nX,nCol);
+      }
+      if (nQuadMask & 0xC) {
+        gslc_ClipDrawSpan(pGui,nLeft-nX,nRight+nX,nBot+nY,nCol);
+        gslc_ClipDrawSpan(pGui,nLeft-nY,nRight+nY,nBot+nX,nCol);
+      }
+    } else {
+      if (nQuadMask & 0x1) {
+        GSLC_STATS_DRV_N(pGui,GSLC_STATS_DRV_POINT,2);
+        gslc_DrvDrawPoint(pGui,nLeft-nX,nTop-nY,nCol);
+        gslc_DrvDrawPoint(pGui,nLeft-nY,nTop-nX,nCol);
+      }
+      if (nQuadMask & 0x2) {
+        GSLC_STATS_DRV_N(pGui,GSLC_STATS_DRV_POINT,2);
+        gslc_DrvDrawPoint(pGui,nRight+nX,nTop-nY,nCol);
+        gslc_DrvDrawPoint(pGui,nRight+nY,nTop-nX,nCol);
+      }
+      if (nQuadMask & 0x4) {
+        GSLC_STATS_DRV_N(pGui,GSLC_STATS_DRV_POINT,2);
+        gslc_DrvDrawPoint(pGui,nRight+nX,nBot+nY,nCol);
+        gslc_DrvDrawPoint(pGui,nRight+nY,nBot+nX,nCol);
+      }
+      if (nQuadMask & 0x8) {
+        GSLC_STATS_DRV_N(pGui,GSLC_STATS_DRV_POINT,2);
+        gslc_DrvDrawPoint(pGui,nLeft-nX,nBot+nY,nCol);
+        gslc_DrvDrawPoint(pGui,nLeft-nY,nBot+nX,nCol);
+      }
+    }
+
+    nY    += 1;
+    nErr  += 1 + 2*nY;
+    if (2*(nErr-nX) + 1 > 0)
+    {
+        nX -= 1;
+        nErr += 1 - 2*nX;
+    }
+  } // while
+}
+
+bool gslc_ClipDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
+{
+  gslc_tsRect rClip = gslc_GetClipRect(pGui);
+  gslc_tsRect rBound = (gslc_tsRect) { (int16_t)(nMidX-nRadius), (int16_t)(nMidY-nRadius), (uint16_t)(2*nRadius+1), (uint16_t)(2*nRadius+1) };
+  gslc_teClipRes eClip = gslc_ClipRectTest(&rClip,rBound);
+  if (eClip == GSLC_CLIP_IN) {
+    return false;
+  } else if (eClip == GSLC_CLIP_PART) {
+    gslc_ClipDrawCircleQuad(pGui,nMidX,nMidY,nRadius,0xF,0,0,false,nCol);
+  }
+  return true;
+}
+
+bool gslc_ClipDrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
+{
+  gslc_tsRect rClip = gslc_GetClipRect(pGui);
+  gslc_tsRect rBound = (gslc_tsRect) { (int16_t)(nMidX-nRadius), (int16_t)(nMidY-nRadius), (uint16_t)(2*nRadius+1), (uint16_t)(2*nRadius+1) };
+  gslc_teClipRes eClip = gslc_ClipRectTest(&rClip,rBound);
+  if (eClip == GSLC_CLIP_IN) {
+    return false;
+  } else if (eClip == GSLC_CLIP_PART) {
+    gslc_ClipDrawCircleQuad(pGui,nMidX,nMidY,nRadius,0xF,0,0,true,nCol);
+  }
+  return true;
+}
 
-    // TODO: It is more efficient to calculate row endpoints
-    // using incremental additions instead of multiplies/divides
+bool gslc_ClipDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColor nCol)
+{
+  gslc_tsRect rClip = gslc_GetClipRect(pGui);
+  gslc_teClipRes eClip = gslc_ClipRectTest(&rClip,rRect);
+  if (eClip == GSLC_CLIP_IN) {
+    return false;
+  } else if (eClip == GSLC_CLIP_OUT) {
+    return true;
+  }
+
+  // Limit the radius to fit within the rect
+  int16_t nMaxRad = ((rRect.w < rRect.h) ? rRect.w : rRect.h) / 2;
+  if (nRadius > nMaxRad) { nRadius = nMaxRad; }
+  if (nRadius < 0) { nRadius = 0; }
+
+  int16_t nX0 = rRect.x;
+  int16_t nY0 = rRect.y;
+  int16_t nX1 = rRect.x + rRect.w - 1;
+  int16_t nY1 = rRect.y + rRect.h - 1;
+
+  // Straight edges
+  GSLC_STATS_DRV_N(pGui,GSLC_STATS_DRV_LINE,4);
+  gslc_DrvDrawLine(pGui,nX0+nRadius,nY0,nX1-nRadius,nY0,nCol); // Top
+  gslc_DrvDrawLine(pGui,nX0+nRadius,nY1,nX1-nRadius,nY1,nCol); // Bottom
+  gslc_DrvDrawLine(pGui,nX0,nY0+nRadius,nX0,nY1-nRadius,nCol); // Left
+  gslc_DrvDrawLine(pGui,nX1,nY0+nRadius,nX1,nY1-nRadius,nCol); // Right
+
+  // Corners
+  gslc_ClipDrawCircleQuad(pGui,nX0+nRadius,nY0+nRadius,nRadius,0xF,
+    (nX1-nRadius)-(nX0+nRadius),(nY1-nRadius)-(nY0+nRadius),false,nCol);
+  return true;
+}
+
+bool gslc_ClipDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColor nCol)
+{
+  gslc_tsRect rClip = gslc_GetClipRect(pGui);
+  gslc_teClipRes eClip = gslc_ClipRectTest(&rClip,rRect);
+  if (eClip == GSLC_CLIP_IN) {
+    return false;
+  } else if (eClip == GSLC_CLIP_OUT) {
+    return true;
+  }
+
+  // Limit the radius to fit within the rect
+  int16_t nMaxRad = ((rRect.w < rRect.h) ? rRect.w : rRect.h) / 2;
+  if (nRadius > nMaxRad) { nRadius = nMaxRad; }
+  if (nRadius < 0) { nRadius = 0; }
 
-    int16_t nXa,nXb,nXc,nYos;
-    int16_t nX01,nX20,nY01,nY20,nX21,nY21;
-    nX01 = nX0-nX1; nY01 = nY0-nY1;
-    nX20 = nX2-nX0; nY20 = nY2-nY0;
-    nX21 = nX2-nX1; nY21 = nY2-nY1;
+  int16_t nX0 = rRect.x;
+  int16_t nY0 = rRect.y;
+  int16_t nX1 = rRect.x + rRect.w - 1;
+  int16_t nY1 = rRect.y + rRect.h - 1;
 
-    // Flat bottom scenario
-    // NOTE: Due to vertex sorting and loop range, it shouldn't
-    // be possible to enter loop when nY0 == nY1 or nY2
-    for (nYos=0;nYos<nY01;nYos++) {
-      // Determine row endpoints (no rounding)
-      //nXa = (nYos          )*(nX0-nX1)/(nY0-nY1);
-      //nXb = (nYos-(nY0-nY1))*(nX2-nX0)/(nY2-nY0);
+  // Center band (full width) between the corners
+  if (rRect.h > 2*nRadius) {
+    gslc_tsRect rMid = (gslc_tsRect) { nX0, (int16_t)(nY0+nRadius), rRect.w, (uint16_t)(rRect.h-2*nRadius) };
+    GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_RECT_FILL);
+    gslc_DrvDrawFillRect(pGui,rMid,nCol);
+  }
+
+  // Top and bottom bands with rounded ends
+  gslc_ClipDrawCircleQuad(pGui,nX0+nRadius,nY0+nRadius,nRadius,0xF,
+    (nX1-nRadius)-(nX0+nRadius),(nY1-nRadius)-(nY0+nRadius),true,nCol);
+  return true;
+}
+
+// Determine the bounding rect of a triangle
+gslc_tsRect gslc_ClipTriangleBounds(int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2)
+{
+  int16_t nMinX = nX0;
+  int16_t nMaxX = nX0;
+  int16_t nMinY = nY0;
+  int16_t nMaxY = nY0;
+  if (nX1 < nMinX) { nMinX = nX1; }
+  if (nX2 < nMinX) { nMinX = nX2; }
+  if (nX1 > nMaxX) { nMaxX = nX1; }
+  if (nX2 > nMaxX) { nMaxX = nX2; }
+  if (nY1 < nMinY) { nMinY = nY1; }
+  if (nY2 < nMinY) { nMinY = nY2; }
+  if (nY1 > nMaxY) { nMaxY = nY1; }
+  if (nY2 > nMaxY) { nMaxY = nY2; }
+  return (gslc_tsRect) { nMinX, nMinY, (uint16_t)(nMaxX-nMinX+1), (uint16_t)(nMaxY-nMinY+1) };
+}
+
+bool gslc_ClipDrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
+        int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol)
+{
+  gslc_tsRect rClip = gslc_GetClipRect(pGui);
+  gslc_tsRect rBound = gslc_ClipTriangleBounds(nX0,nY0,nX1,nY1,nX2,nY2);
+  gslc_teClipRes eClip = gslc_ClipRectTest(&rClip,rBound);
+  if (eClip == GSLC_CLIP_IN) {
+    return false;
+  } else if (eClip == GSLC_CLIP_PART) {
+    GSLC_STATS_DRV_N(pGui,GSLC_STATS_DRV_LINE,3);
+    gslc_DrvDrawLine(pGui,nX0,nY0,nX1,nY1,nCol);
+    gslc_DrvDrawLine(pGui,nX1,nY1,nX2,nY2,nCol);
+    gslc_DrvDrawLine(pGui,nX2,nY2,nX0,nY0,nCol);
+  }
+  return true;
+}
+
+bool gslc_ClipDrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
+        int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol)
+{
+  gslc_tsRect rClip = gslc_GetClipRect(pGui);
+  gslc_tsRect rBound = gslc_ClipTriangleBounds(nX0,nY0,nX1,nY1,nX2,nY2);
+  gslc_teClipRes eClip = gslc_ClipRectTest(&rClip,rBound);
+  if (eClip == GSLC_CLIP_IN) {
+    return false;
+  } else if (eClip == GSLC_CLIP_OUT) {
+    return true;
+  }
 
-      // Determine row endpoints (using rounding)
-      nXa  = 2*(nYos)*nX01;
-      nXa += (nXa>=0)?abs(nY01):-abs(nY01);
-      nXa /= 2*nY01;
+  // Sort vertices so that nY0 <= nY1 <= nY2
+  if (nY0 > nY1) { gslc_SwapCoords(&nX0,&nY0,&nX1,&nY1); }
+  if (nY1 > nY2) { gslc_SwapCoords(&nX1,&nY1,&nX2,&nY2); }
+  if (nY0 > nY1) { gslc_SwapCoords(&nX0,&nY0,&nX1,&nY1); }
 
-      nXb = 2*(nYos-nY01)*nX20;
-      nXb += (nXb>=0)?abs(nY20):-abs(nY20);
-      nXb /= 2*nY20;
+  // Only walk the scanlines that are within the clipping region
+  int16_t nRowStart = (nY0 > rClip.y) ? nY0 : rClip.y;
+  int16_t nRowEnd   = rClip.y + rClip.h - 1;
+  int16_t nRow,nXa,nXb;
+  if (nY2 < nRowEnd) { nRowEnd = nY2; }
 
-      // Draw horizontal line between endpoints
-      gslc_DrawLine(pGui,nX1+nXa,nY1+nYos,nX0+nXb,nY1+nYos,nCol);
+  for (nRow=nRowStart;nRow<=nRowEnd;nRow++) {
+    // Long edge (Y0-Y2)
+    if (nY2 == nY0) {
+      nXa = nX0;
+    } else {
+      nXa = nX0 + (int32_t)(nX2-nX0)*(nRow-nY0)/(nY2-nY0);
+    }
+    // Short edges (Y0-Y1 or Y1-Y2)
+    if (nRow < nY1) {
+      nXb = nX0 + (int32_t)(nX1-nX0)*(nRow-nY0)/(nY1-nY0);
+    } else if (nY2 == nY1) {
+      nXb = nX1;
+    } else {
+      nXb = nX1 + (int32_t)(nX2-nX1)*(nRow-nY1)/(nY2-nY1);
+    }
+    if (nXa > nXb) {
+      gslc_ClipDrawSpan(pGui,nXb,nXa,nRow,nCol);
+    } else {
+      gslc_ClipDrawSpan(pGui,nXa,nXb,nRow,nCol);
     }
+  }
+  return true;
+}
 
-    // Flat top scenario
-    // NOTE: Due to vertex sorting and loop range, it shouldn't
-    // be possible to enter loop when nY2 == nY0 or nY1
-    for (nYos=nY21;nYos<0;nYos++) {
+bool gslc_ClipImgRect(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,int16_t nImgW,int16_t nImgH,gslc_tsRect* pRect)
+{
+  gslc_tsRect rClip = gslc_GetClipRect(pGui);
+  gslc_tsRect rImg = (gslc_tsRect) { nDstX, nDstY, (uint16_t)nImgW, (uint16_t)nImgH };
+  if (!gslc_ClipRect(&rClip,&rImg)) {
+    return false;
+  }
+  // Convert to image-relative coordinates
+  rImg.x -= nDstX;
+  rImg.y -= nDstY;
+  *pRect = rImg;
+  return true;
+}
 
-      // Determine row endpoints (no rounding)
-      //nXc = (nYos          )*(nX2-nX1)/(nY2-nY1);
-      //nXb = (nYos-(nY0-nY1))*(nX2-nX0)/(nY2-nY0);
+// ------------------------------------------------------------------------
+// BMP Streaming Functions
+// ------------------------------------------------------------------------
 
-      // Determine row endpoints (using rounding)
-      nXc  = 2*(nYos)*nX21;
-      nXc += (nXc>=0)?abs(nY21):-abs(nY21);
-      nXc /= 2*nY21;
+uint16_t gslc_BmpGet16(const uint8_t* pBuf)
+{
+  return (uint16_t)pBuf[0] | ((uint16_t)pBuf[1] << 8);
+}
 
-      nXb = 2*(nYos-nY01)*nX20;
-      nXb += (nXb>=0)?abs(nY20):-abs(nY20);
-      nXb /= 2*nY20;
+uint32_t gslc_BmpGet32(const uint8_t* pBuf)
+{
+  return (uint32_t)pBuf[0] | ((uint32_t)pBuf[1] << 8) |
+    ((uint32_t)pBuf[2] << 16) | ((uint32_t)pBuf[3] << 24);
+}
 
-      // Draw horizontal line between endpoints
-      gslc_DrawLine(pGui,nX1+nXc,nY1+nYos,nX0+nXb,nY1+nYos,nCol);
+void gslc_BmpMaskToField(uint32_t nMask,uint8_t* pnShift,uint8_t* pnBits)
+{
+  uint8_t nShift = 0;
+  uint8_t nBits = 0;
+  if (nMask != 0) {
+    while ((nMask & 1) == 0) {
+      nMask >>= 1;
+      nShift++;
     }
+    while (nMask & 1) {
+      nMask >>= 1;
+      nBits++;
+    }
+  }
+  *pnShift = nShift;
+  *pnBits = nBits;
+}
 
-  #endif  // DRV_HAS_DRAW_TRI_FILL
+bool gslc_BmpParseHeader(gslc_tsBmpReader* pReader,gslc_tsBmpInfo* pInfo)
+{
+  // Read the file header (14 bytes), the BITMAPINFOHEADER (40 bytes)
+  // and the bitfield masks that may follow it (12 bytes)
+  uint8_t   anHdr[66];
+  uint16_t  nHdrLen;
+  if (!(*pReader->pfuncSeek)(pReader->pvStream,0)) {
+    return false;
+  }
+  nHdrLen = (*pReader->pfuncRead)(pReader->pvStream,anHdr,sizeof(anHdr));
+  if (nHdrLen < 54) {
+    return false;
+  }
+  // Check the signature ("BM")
+  if (gslc_BmpGet16(&anHdr[0]) != 0x4D42) {
+    return false;
+  }
+  pInfo->nDataOfs = gslc_BmpGet32(&anHdr[10]);
+  int32_t nWidth  = (int32_t)gslc_BmpGet32(&anHdr[18]);
+  int32_t nHeight = (int32_t)gslc_BmpGet32(&anHdr[22]);
+  uint16_t nPlanes = gslc_BmpGet16(&anHdr[26]);
+  uint16_t nDepth = gslc_BmpGet16(&anHdr[28]);
+  uint32_t nCompress = gslc_BmpGet32(&anHdr[30]);
+  if ((nPlanes != 1) || (nWidth <= 0) || (nWidth > 32767) || (nHeight == 0)) {
+    return false;
+  }
 
-  gslc_PageFlipSet(pGui,true);
+  // If the height is negative, the image is stored top-down
+  pInfo->bTopDown = false;
+  if (nHeight < 0) {
+    nHeight = -nHeight;
+    pInfo->bTopDown = true;
+  }
+  if (nHeight > 32767) {
+    return false;
+  }
+  pInfo->nWidth = (int16_t)nWidth;
+  pInfo->nHeight = (int16_t)nHeight;
+  pInfo->nDepth = (uint8_t)nDepth;
+
+  // Determine the color field layout
+  uint32_t anMask[3];
+  if (nCompress == 0) {
+    // Uncompressed (BI_RGB)
+    if (nDepth == 16) {
+      // RGB555
+      anMask[0] = 0x7C00; anMask[1] = 0x03E0; anMask[2] = 0x001F;
+    } else if ((nDepth == 24) || (nDepth == 32)) {
+      anMask[0] = 0x00FF0000; anMask[1] = 0x0000FF00; anMask[2] = 0x000000FF;
+    } else {
+      return false;
+    }
+  } else if ((nCompress == 3) && ((nDepth == 16) || (nDepth == 32)) && (nHdrLen >= 66)) {
+    // Uncompressed with bitfield masks (BI_BITFIELDS)
+    anMask[0] = gslc_BmpGet32(&anHdr[54]);
+    anMask[1] = gslc_BmpGet32(&anHdr[58]);
+    anMask[2] = gslc_BmpGet32(&anHdr[62]);
+  } else {
+    return false;
+  }
+  uint8_t nInd;
+  for (nInd=0;nInd<3;nInd++) {
+    gslc_BmpMaskToField(anMask[nInd],&pInfo->anShift[nInd],&pInfo->anBits[nInd]);
+  }
+
+  // BMP rows are padded to a 4-byte boundary
+  pInfo->nRowSize = (((uint32_t)pInfo->nWidth * nDepth / 8) + 3) & ~3UL;
+  return true;
+}
+
+gslc_tsColor gslc_BmpDecodePixel(gslc_tsBmpInfo* pInfo,const uint8_t* pPix)
+{
+  gslc_tsColor  nCol;
+  uint32_t      nPix;
+  if (pInfo->nDepth == 24) {
+    // Stored as B,G,R
+    nCol.b = pPix[0];
+    nCol.g = pPix[1];
+    nCol.r = pPix[2];
+    return nCol;
+  } else if (pInfo->nDepth == 16) {
+    nPix = gslc_BmpGet16(pPix);
+  } else {
+    nPix = gslc_BmpGet32(pPix);
+  }
+
+  // Extract each color field and scale it to 8 bits
+  uint8_t   anVal[3];
+  uint8_t   nInd,nBits;
+  uint32_t  nVal;
+  for (nInd=0;nInd<3;nInd++) {
+    nBits = pInfo->anBits[nInd];
+    nVal = (nPix >> pInfo->anShift[nInd]) & ((1UL << nBits) - 1);
+    if (nBits >= 8) {
+      nVal >>= (nBits - 8);
+    } else if (nBits >= 4) {
+      // Replicate the upper bits into the low bits
+      nVal = (nVal << (8 - nBits)) | (nVal >> (2*nBits - 8));
+    } else {
+      nVal <<= (8 - nBits);
+    }
+    anVal[nInd] = (uint8_t)nVal;
+  }
+  nCol.r = anVal[0];
+  nCol.g = anVal[1];
+  nCol.b = anVal[2];
+  return nCol;
+}
+
+void gslc_BmpDrawRun(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nLen,const gslc_tsColor* pasCol)
+{
+  if (nLen == 0) {
+    return;
+  }
+#if (DRV_HAS_DRAW_ROW)
+  GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_ROW);
+  gslc_DrvDrawRow(pGui,nX,nY,nLen,pasCol);
+#else
+  uint16_t nInd;
+  for (nInd=0;nInd<nLen;nInd++) {
+    GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_POINT);
+    gslc_DrvDrawPoint(pGui,nX+nInd,nY,pasCol[nInd]);
+  }
+#endif
+}
+
+bool gslc_BmpDraw(gslc_tsGui* pGui,gslc_tsBmpReader* pReader,int16_t nDstX,int16_t nDstY)
+{
+  gslc_tsBmpInfo  sInfo;
+  if (!gslc_BmpParseHeader(pReader,&sInfo)) {
+    GSLC_DEBUG2_PRINT("ERROR: BmpDraw() BMP format unsupported\n","");
+    return false;
+  }
+
+  // Determine the visible region of the image
+  // - Only the visible rows and columns are read from the stream
+  gslc_tsRect rVis;
+  if (!gslc_ClipImgRect(pGui,nDstX,nDstY,sInfo.nWidth,sInfo.nHeight,&rVis)) {
+    return true;
+  }
+
+  bool          bTransEn = (GSLC_BMP_TRANS_EN) ? true : false;
+  gslc_tsColor  colTrans = pGui->sTransCol;
+
+  uint8_t       nPixBytes = sInfo.nDepth / 8;
+  uint8_t       anReadBuf[4*GSLC_BMP_ROW_BUF_LEN];
+  gslc_tsColor  asRunBuf[GSLC_BMP_ROW_BUF_LEN];
+  uint16_t      nRunLen;
+  uint16_t      nChunk,nInd;
+  uint32_t      nPos;
+  uint32_t      nPosCur = 0xFFFFFFFF;
+  int16_t       nRow,nFileRow,nCol,nColEnd;
+  gslc_tsColor  nColPix;
+
+  for (nRow=rVis.y;nRow<rVis.y+rVis.h;nRow++) {
+    // Seek to the first visible pixel of the scanline
+    // - The seek is skipped if the stream is already positioned there
+    nFileRow = (sInfo.bTopDown) ? nRow : (sInfo.nHeight - 1 - nRow);
+    nPos = sInfo.nDataOfs + (uint32_t)nFileRow * sInfo.nRowSize + (uint32_t)rVis.x * nPixBytes;
+    if (nPos != nPosCur) {
+      if (!(*pReader->pfuncSeek)(pReader->pvStream,nPos)) {
+        GSLC_DEBUG2_PRINT("ERROR: BmpDraw() seek failed\n","");
+        return false;
+      }
+      nPosCur = nPos;
+    }
+
+    nCol = rVis.x;
+    nColEnd = rVis.x + rVis.w;
+    nRunLen = 0;
+    while (nCol < nColEnd) {
+      // Read the next chunk of the scanline
+      nChunk = nColEnd - nCol;
+      if (nChunk > GSLC_BMP_ROW_BUF_LEN) {
+        nChunk = GSLC_BMP_ROW_BUF_LEN;
+      }
+      if ((*pReader->pfuncRead)(pReader->pvStream,anReadBuf,nChunk*nPixBytes) != nChunk*nPixBytes) {
+        GSLC_DEBUG2_PRINT("ERROR: BmpDraw() read failed\n","");
+        return false;
+      }
+      nPosCur += nChunk*nPixBytes;
+
+      // Decode the pixels into runs that are pushed to the display
+      // - Transparent pixels split the scanline into separate runs
+      for (nInd=0;nInd<nChunk;nInd++,nCol++) {
+        nColPix = gslc_BmpDecodePixel(&sInfo,&anReadBuf[nInd*nPixBytes]);
+        if ((bTransEn) && gslc_ColorEqual(nColPix,colTrans)) {
+          gslc_BmpDrawRun(pGui,nDstX+nCol-nRunLen,nDstY+nRow,nRunLen,asRunBuf);
+          nRunLen = 0;
+          continue;
+        }
+        asRunBuf[nRunLen++] = nColPix;
+        if (nRunLen == GSLC_BMP_ROW_BUF_LEN) {
+          gslc_BmpDrawRun(pGui,nDstX+nCol+1-nRunLen,nDstY+nRow,nRunLen,asRunBuf);
+          nRunLen = 0;
+        }
+      }
+    }
+    // Flush the remainder of the scanline
+    gslc_BmpDrawRun(pGui,nDstX+nColEnd-nRunLen,nDstY+nRow,nRunLen,asRunBuf);
+  }
+  return true;
+}
+
+#if defined(__linux__)
+uint16_t gslc_BmpReadFile(void* pvStream,uint8_t* pBuf,uint16_t nLen)
+{
+  return (uint16_t)fread(pBuf,1,nLen,(FILE*)pvStream);
+}
+
+bool gslc_BmpSeekFile(void* pvStream,uint32_t nPos)
+{
+  return (fseek((FILE*)pvStream,(long)nPos,SEEK_SET) == 0);
+}
+
+bool gslc_BmpDrawFromFile(gslc_tsGui* pGui,const char* pFname,int16_t nDstX,int16_t nDstY)
+{
+  FILE* pFile = fopen(pFname,"rb");
+  if (pFile == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: BmpDrawFromFile() file not found [%s]\n",pFname);
+    return false;
+  }
+  gslc_tsBmpReader sReader;
+  sReader.pvStream  = (void*)pFile;
+  sReader.pfuncRead = &gslc_BmpReadFile;
+  sReader.pfuncSeek = &gslc_BmpSeekFile;
+  bool bOk = gslc_BmpDraw(pGui,&sReader,nDstX,nDstY);
+  fclose(pFile);
+  return bOk;
 }
+#endif // __linux__
+
 
 void gslc_DrawFrameQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol)
 {
@@ -1757,8 +2818,11 @@ void gslc_DrawFrameQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol)
 // two filled triangles sharing one side. We have to be careful
 // about the triangle fill routine (ie. using rounding) so that
 // we can avoid leaving a thin seam between the two triangles.
+// - Without a native triangle fill, the scanline polygon filler
+//   rasterises the same two triangles in a single pass
 void gslc_DrawFillQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol)
 {
+#if (DRV_HAS_DRAW_TRI_FILL)
   int16_t nX0,nY0,nX1,nY1,nX2,nY2;
 
   // Break down quadrilateral into two triangles
@@ -1771,10 +2835,183 @@ void gslc_DrawFillQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol)
   nX1 = psPt[0].x; nY1 = psPt[0].y;
   nX2 = psPt[3].x; nY2 = psPt[3].y;
   gslc_DrawFillTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
+#else
+  gslc_DrawFillPoly(pGui,psPt,4,nCol);
+#endif
+}
+
+// Add an edge of a triangle to the scanline filler's edge table
+// - The edge runs downwards from sPtA to sPtB
+// - Edge crossings are rounded to the nearest pixel, with ties
+//   rounded away from the edge's reference vertex (sPtA if bRefA,
+//   otherwise sPtB). This matches the rounding of the original
+//   per-row triangle fill.
+void gslc_DrawFillPolyEdge(gslc_tsPolyEdge* pEdge,gslc_tsPt sPtA,gslc_tsPt sPtB,bool bRefA,uint8_t nTri)
+{
+  int16_t nDX = sPtB.x - sPtA.x;
+  pEdge->nY0    = sPtA.y;
+  pEdge->nY1    = sPtB.y;
+  pEdge->nDY    = sPtB.y - sPtA.y;
+  pEdge->nX     = sPtA.x;
+  pEdge->nErr   = 0;
+  pEdge->nTri   = nTri;
+  pEdge->bTieUp = (bRefA)? (nDX > 0) : (nDX < 0);
+  // Split the slope into integer and fractional steps (rounding down)
+  pEdge->nStep = nDX / pEdge->nDY;
+  pEdge->nRem  = nDX % pEdge->nDY;
+  if (pEdge->nRem < 0) {
+    pEdge->nStep--;
+    pEdge->nRem += pEdge->nDY;
+  }
+}
+
+// Draw a filled convex polygon using an edge table
+// - The polygon is divided into a fan of triangles: (P0,P1,P2),
+//   then (Pn,P0,Pn+1). Each triangle's rows and edge crossings
+//   follow the same rules as the emulated gslc_DrawFillTriangle(),
+//   so the output is identical to filling the triangles one by one.
+// - Each edge's X coordinate is advanced incrementally per row
+//   (DDA), avoiding a multiply and divide per row
+// - Within each row, the spans of the triangles are merged so that
+//   a convex polygon is generally filled with a single span
+// - Rows outside the clipping region are skipped
+void gslc_DrawFillPoly(gslc_tsGui* pGui,gslc_tsPt* psPt,uint8_t nNumPt,gslc_tsColor nCol)
+{
+  gslc_tsPolyEdge asEdge[3*(GSLC_FILL_POLY_PT_MAX-2)];
+  gslc_tsPolyEdge* pEdge;
+  gslc_tsPt   asTri[3];
+  gslc_tsPt   sPtSwap;
+  int16_t     anTriX0[GSLC_FILL_POLY_PT_MAX-2];
+  int16_t     anTriX1[GSLC_FILL_POLY_PT_MAX-2];
+  uint8_t     nInd,nTri,nTriCnt,nTriSel;
+  uint8_t     nEdgeCnt = 0;
+  int16_t     nRowMin,nRowMax,nRow,nSkip;
+  int16_t     nSpanX0,nSpanX1,nEdgeX;
+  int32_t     nNum,nQuot,nMod;
+
+  if ((nNumPt < 3) || (nNumPt > GSLC_FILL_POLY_PT_MAX)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrawFillPoly() unsupported number of points (%u)\n",nNumPt);
+    return;
+  }
+
+  // Build the edge table from the triangle fan
+  nTriCnt = nNumPt-2;
+  nRowMin = psPt[0].y;
+  nRowMax = psPt[0].y;
+  for (nTri=0;nTri<nTriCnt;nTri++) {
+    if (nTri == 0) {
+      asTri[0] = psPt[0];
+      asTri[1] = psPt[1];
+    } else {
+      asTri[0] = psPt[nTri+1];
+      asTri[1] = psPt[0];
+    }
+    asTri[2] = psPt[nTri+2];
+    // Sort vertices
+    // - Want Y0 >= Y1 >= Y2
+    if (asTri[2].y > asTri[1].y) { sPtSwap = asTri[2]; asTri[2] = asTri[1]; asTri[1] = sPtSwap; }
+    if (asTri[1].y > asTri[0].y) { sPtSwap = asTri[1]; asTri[1] = asTri[0]; asTri[0] = sPtSwap; }
+    if (asTri[2].y > asTri[1].y) { sPtSwap = asTri[2]; asTri[2] = asTri[1]; asTri[1] = sPtSwap; }
+    if (asTri[2].y < nRowMin) { nRowMin = asTri[2].y; }
+    if (asTri[0].y > nRowMax) { nRowMax = asTri[0].y; }
+    // Horizontal edges are covered by the adjoining edges
+    // - The short edges are referenced to the middle vertex and
+    //   the long edge to the bottom vertex
+    if (asTri[1].y != asTri[0].y) {
+      gslc_DrawFillPolyEdge(&asEdge[nEdgeCnt++],asTri[1],asTri[0],true,nTri);
+    }
+    if (asTri[2].y != asTri[0].y) {
+      gslc_DrawFillPolyEdge(&asEdge[nEdgeCnt++],asTri[2],asTri[0],false,nTri);
+    }
+    if (asTri[2].y != asTri[1].y) {
+      gslc_DrawFillPolyEdge(&asEdge[nEdgeCnt++],asTri[2],asTri[1],false,nTri);
+    }
+  }
+
+  // Limit the rows to the clipping region
+  gslc_tsRect rClip = gslc_GetClipRect(pGui);
+  if (nRowMin < rClip.y) {
+    nRowMin = rClip.y;
+  }
+  if (nRowMax > rClip.y + (int16_t)rClip.h) {
+    nRowMax = rClip.y + (int16_t)rClip.h;
+  }
+
+  // Advance any edges that start above the first visible row
+  for (nInd=0;nInd<nEdgeCnt;nInd++) {
+    pEdge = &asEdge[nInd];
+    if ((pEdge->nY0 >= nRowMin) || (pEdge->nY1 <= nRowMin)) {
+      continue;
+    }
+    nSkip = nRowMin - pEdge->nY0;
+    nNum  = (int32_t)nSkip * (pEdge->nStep * pEdge->nDY + pEdge->nRem);
+    nQuot = nNum / pEdge->nDY;
+    nMod  = nNum % pEdge->nDY;
+    if (nMod < 0) {
+      nQuot--;
+      nMod += pEdge->nDY;
+    }
+    pEdge->nX  += (int16_t)nQuot;
+    pEdge->nErr = (int16_t)nMod;
+    pEdge->nY0  = nRowMin;
+  }
+
+  for (nRow=nRowMin;nRow<nRowMax;nRow++) {
+    for (nTri=0;nTri<nTriCnt;nTri++) {
+      anTriX0[nTri] = 0x7FFF;
+      anTriX1[nTri] = -0x7FFF;
+    }
+    for (nInd=0;nInd<nEdgeCnt;nInd++) {
+      pEdge = &asEdge[nInd];
+      if ((nRow < pEdge->nY0) || (nRow >= pEdge->nY1)) {
+        continue;
+      }
+      // Round the edge crossing to the nearest pixel
+      nEdgeX = pEdge->nX;
+      if ((2*(int32_t)pEdge->nErr > pEdge->nDY) || ((2*(int32_t)pEdge->nErr == pEdge->nDY) && (pEdge->bTieUp))) {
+        nEdgeX++;
+      }
+      nTri = pEdge->nTri;
+      if (nEdgeX < anTriX0[nTri]) { anTriX0[nTri] = nEdgeX; }
+      if (nEdgeX > anTriX1[nTri]) { anTriX1[nTri] = nEdgeX; }
+      // Step to the next row
+      pEdge->nX   += pEdge->nStep;
+      pEdge->nErr += pEdge->nRem;
+      if (pEdge->nErr >= pEdge->nDY) {
+        pEdge->nX++;
+        pEdge->nErr -= pEdge->nDY;
+      }
+    }
+    // Emit the union of the triangle spans, from left to right,
+    // merging spans that overlap or abut
+    nSpanX0 = 0x7FFF;
+    nSpanX1 = -0x7FFF;
+    while (true) {
+      nTriSel = nTriCnt;
+      for (nTri=0;nTri<nTriCnt;nTri++) {
+        if ((anTriX0[nTri] <= anTriX1[nTri]) && ((nTriSel == nTriCnt) || (anTriX0[nTri] < anTriX0[nTriSel]))) {
+          nTriSel = nTri;
+        }
+      }
+      if ((nTriSel == nTriCnt) || (anTriX0[nTriSel] > nSpanX1+1)) {
+        gslc_ClipDrawSpan(pGui,nSpanX0,nSpanX1,nRow,nCol);
+        if (nTriSel == nTriCnt) {
+          break;
+        }
+        nSpanX0 = anTriX0[nTriSel];
+        nSpanX1 = anTriX1[nTriSel];
+      } else if (anTriX1[nTriSel] > nSpanX1) {
+        nSpanX1 = anTriX1[nTriSel];
+      }
+      // Mark the span as consumed
+      anTriX1[nTriSel] = -0x7FFF;
+    }
+  }
 
+  gslc_PageFlipSet(pGui,true);
 }
 
-void gslc_DrawFillSectorBase(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
+void gslc_DrawFillSectorBase(gslc_tsGui* pGui, gslc_tsPolarCache* pCache, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
   gslc_tsColor cArcStart, gslc_tsColor cArcEnd,bool bGradient, int16_t nAngGradStart, int16_t nAngGradRange,int16_t nAngSecStart,int16_t nAngSecEnd)
 {
   gslc_tsPt anPts[4];
@@ -1783,6 +3020,9 @@ void gslc_DrawFillSectorBase(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX,
   int16_t nStepAng = 360 / nQuality;
   int16_t nStep64 = 64 * nStepAng;
 
+  // Ensure any cached vertices correspond to this quality
+  gslc_PolarCacheSetStep(pCache, nStep64);
+
   int16_t nAng64;
   int16_t nX, nY;
   int16_t nSegStart, nSegEnd;
@@ -1822,13 +3062,13 @@ void gslc_DrawFillSectorBase(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX,
     GSLC_DEBUG2_PRINT("FillSector:  StepInd=%d SegInd=%d (%d..%d) Ang64=%d\n", nStepInd, nSegInd, nSegStart, nSegEnd, nAng64);
     #endif
 
-    gslc_PolarToXY(nRad1, nAng64, &nX, &nY);
+    gslc_PolarCacheToXY(pCache, nRad1, nAng64, &nX, &nY);
     anPts[0] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad2, nAng64, &nX, &nY);
+    gslc_PolarCacheToXY(pCache, nRad2, nAng64, &nX, &nY);
     anPts[1] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad2, nAng64 + nStep64, &nX, &nY);
+    gslc_PolarCacheToXY(pCache, nRad2, nAng64 + nStep64, &nX, &nY);
     anPts[2] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad1, nAng64 + nStep64, &nX, &nY);
+    gslc_PolarCacheToXY(pCache, nRad1, nAng64 + nStep64, &nX, &nY);
     anPts[3] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
 
     if (bGradient) {
@@ -1850,14 +3090,14 @@ void gslc_DrawFillSectorBase(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX,
 void gslc_DrawFillGradSector(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
   gslc_tsColor cArcStart, gslc_tsColor cArcEnd, int16_t nAngSecStart, int16_t nAngSecEnd, int16_t nAngGradStart, int16_t nAngGradRange)
 {
-  gslc_DrawFillSectorBase(pGui, nQuality, nMidX, nMidY, nRad1, nRad2, cArcStart, cArcEnd, true,
+  gslc_DrawFillSectorBase(pGui, NULL, nQuality, nMidX, nMidY, nRad1, nRad2, cArcStart, cArcEnd, true,
     nAngGradStart, nAngGradRange, nAngSecStart, nAngSecEnd);
 }
 
 void gslc_DrawFillSector(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
   gslc_tsColor cArc, int16_t nAngSecStart, int16_t nAngSecEnd)
 {
-  gslc_DrawFillSectorBase(pGui, nQuality, nMidX, nMidY, nRad1, nRad2, cArc, cArc, false,
+  gslc_DrawFillSectorBase(pGui, NULL, nQuality, nMidX, nMidY, nRad1, nRad2, cArc, cArc, false,
     0, 0, nAngSecStart, nAngSecEnd);
 }
 
@@ -1888,6 +3128,9 @@ bool gslc_FontSetBase(gslc_tsGui* pGui, uint8_t nFontInd, int16_t nFontId, gslc_
     pGui->asFont[nFontInd].nId          = nFontId;
     pGui->asFont[nFontInd].nSize        = nFontSz;
 
+    // Any text measured with the previous font in this slot is stale
+    gslc_TxtCacheReset(pGui);
+
     return true;
   }
 }
@@ -1956,6 +3199,7 @@ bool gslc_FontSetMode(gslc_tsGui* pGui, int16_t nFontId, gslc_teFontRefMode eFon
     return false;
   }
   pFont->eFontRefMode = eFontMode;
+  gslc_TxtCacheReset(pGui);
   return true;
 }
 
@@ -2021,12 +3265,20 @@ void gslc_PageAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* psElem,uint16_t
   // Initialize pPage->sCollect
   gslc_CollectReset(&pPage->sCollect,psElem,nMaxElem,psElemRef,nMaxElemRef);
 
+  // Keep count of the page's elements that require redraw so that
+  // pages (and elements) without a pending redraw can be skipped
+  pPage->sCollect.bRedrawCntEn = true;
+
   // Assign the requested Page ID
   pPage->nPageId = nPageId;
 
   // Initialize the page elements bounds to empty
   pPage->rBounds = (gslc_tsRect) { 0, 0, 0, 0 };
 
+  #if (GSLC_PAGE_CACHE_EN)
+  pPage->bCacheEn = false;
+  #endif
+
   // Increment the page count
   pGui->nPageCnt++;
 
@@ -2090,6 +3342,12 @@ void gslc_SetStackPage(gslc_tsGui* pGui, uint8_t nStackPos, int16_t nPageId)
   // the forced redraw step.
   if (nPageSaved != nPageId) {
     gslc_PageRedrawSet(pGui,true);
+    #if (GSLC_POPUP_SAVE_EN)
+    // The popup save-under no longer matches the pages beneath it
+    if (nStackPos != GSLC_STACK_OVERLAY) {
+      pGui->sPopupSave.nPageId = GSLC_PAGE_NONE;
+    }
+    #endif // GSLC_POPUP_SAVE_EN
   }
 
   // Invalidate the old page in the stack
@@ -2126,7 +3384,20 @@ void gslc_SetPageBase(gslc_tsGui* pGui, int16_t nPageId)
 
 void gslc_SetPageCur(gslc_tsGui* pGui,int16_t nPageId)
 {
+  #if (GSLC_PAGE_CACHE_EN)
+  // Retain the display of the page being replaced, and
+  // restore any display retained for the new page
+  bool bPageChange = (gslc_GetPageCur(pGui) != nPageId);
+  if (bPageChange) {
+    gslc_PageCacheSave(pGui);
+  }
   gslc_SetStackPage(pGui, GSLC_STACK_CUR, nPageId);
+  if (bPageChange) {
+    gslc_PageCacheRestore(pGui);
+  }
+  #else
+  gslc_SetStackPage(pGui, GSLC_STACK_CUR, nPageId);
+  #endif // GSLC_PAGE_CACHE_EN
 
   // If a focus is currently active, change the focus to the new page
   #if (GSLC_FEATURE_INPUT)
@@ -2140,11 +3411,19 @@ void gslc_SetPageCur(gslc_tsGui* pGui,int16_t nPageId)
 
 void gslc_SetPageOverlay(gslc_tsGui* pGui,int16_t nPageId)
 {
+  #if (GSLC_POPUP_SAVE_EN)
+  // Only popups shown by gslc_PopupShow() use the save-under
+  pGui->sPopupSave.nPageId = GSLC_PAGE_NONE;
+  #endif
   gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, nPageId);
 }
 
 void gslc_PopupShow(gslc_tsGui* pGui, int16_t nPageId, bool bModal)
 {
+  #if (GSLC_POPUP_SAVE_EN)
+  // Save the display beneath the popup before it is drawn
+  gslc_PopupSaveTake(pGui, nPageId);
+  #endif
   gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, nPageId);
   // If modal dialog selected, then deactivate other pages in stack
   // If modeless dialog selected, then don't deactivate other pages in stack
@@ -2176,11 +3455,29 @@ void gslc_PopupShow(gslc_tsGui* pGui, int16_t nPageId, bool bModal)
 
 void gslc_PopupHide(gslc_tsGui* pGui)
 {
+  #if (GSLC_POPUP_SAVE_EN)
+  // Retain any regions that are still awaiting redraw, as these are
+  // discarded when the save-under replaces the redraw of the popup
+  // - A pending redraw of the entire display can't be replaced
+  gslc_tsRect asRectPend[GSLC_INVALIDATE_RECT_MAX];
+  uint8_t     nRectPend = 0;
+  if (pGui->bInvalidateEn) {
+    for (nRectPend=0;nRectPend<pGui->nInvalidateRectCnt;nRectPend++) {
+      asRectPend[nRectPend] = pGui->asInvalidateRect[nRectPend];
+    }
+  } else if (pGui->bScreenNeedRedraw) {
+    pGui->sPopupSave.nPageId = GSLC_PAGE_NONE;
+  }
+  #endif // GSLC_POPUP_SAVE_EN
   gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, GSLC_PAGE_NONE);
   // Ensure other pages in stack are activated
   // - This is done in case they were deactivated due to a modal popup
   gslc_SetStackState(pGui, GSLC_STACK_CUR, true, true);
   gslc_SetStackState(pGui, GSLC_STACK_BASE, true, true);
+  #if (GSLC_POPUP_SAVE_EN)
+  // Restore the display beneath the popup rather than redrawing it
+  gslc_PopupSaveRestore(pGui,asRectPend,nRectPend);
+  #endif
 
   #if (GSLC_FEATURE_INPUT)
   // If there was a focus state saved before we opened
@@ -2226,9 +3523,10 @@ bool gslc_PageRedrawGet(gslc_tsGui* pGui)
 // - The typical case for this being required is when an element
 //   requires redraw but it is marked as being transparent. Therefore,
 //   the lower level elements should be redrawn.
-// - For now, just mark the entire page as requiring redraw.
-// TODO: Determine which elements underneath should be redrawn based
-//       on the region exposed by the transparent element.
+// - If GSLC_REDRAW_TRANSP_CLIP is enabled, the invalidated regions
+//   are marked as requiring redraw: the background and all elements
+//   overlapping the regions will be redrawn (clipped to the regions).
+// - Otherwise, mark the entire page as requiring redraw.
 void gslc_PageRedrawCalc(gslc_tsGui* pGui)
 {
   uint16_t          nInd;
@@ -2236,6 +3534,8 @@ void gslc_PageRedrawCalc(gslc_tsGui* pGui)
   gslc_tsElem*      pElem = NULL;
   gslc_tsElemRef*   pElemRef = NULL;
   gslc_tsCollect*   pCollect = NULL;
+  uint16_t          nRedrawCnt;
+  uint16_t          nRedrawFound;
 
   bool  bRedrawFullPage = false;  // Does entire page require redraw?
   gslc_tsPage*  pPage = NULL;
@@ -2254,23 +3554,38 @@ void gslc_PageRedrawCalc(gslc_tsGui* pGui)
     }
     pCollect = &pPage->sCollect;
 
-    for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+    // Only visit the elements until all of those that
+    // require redraw have been found
+    nRedrawCnt = pCollect->nElemRefRedrawCnt;
+    nRedrawFound = 0;
+
+    for (nInd=0;(nInd<pCollect->nElemRefCnt) && (nRedrawFound<nRedrawCnt);nInd++) {
       pElemRef = &pCollect->asElemRef[nInd];
       gslc_teElemRefFlags eFlags = pElemRef->eElemFlags;
-      pElem = gslc_GetElemFromRef(pGui,pElemRef);
-      //GSLC_DEBUG2_PRINT("PageRedrawCalc: Ind=%u ID=%u redraw=%u flags_old=%u fea=%u\n",nInd,pElem->nId,
-      //        (eFlags & GSLC_ELEMREF_REDRAW_MASK),eFlags,pElem->nFeatures);
+      //GSLC_DEBUG2_PRINT("PageRedrawCalc: Ind=%u redraw=%u flags_old=%u\n",nInd,
+      //        (eFlags & GSLC_ELEMREF_REDRAW_MASK),eFlags);
       if ((eFlags & GSLC_ELEMREF_REDRAW_MASK) != GSLC_ELEMREF_REDRAW_NONE) {
 
         // We found at least one item requiring redraw
+        nRedrawFound++;
+        pElem = gslc_GetElemFromRef(pGui,pElemRef);
+
+        #if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+        // When rendering in bands, each band is composed from the
+        // background upwards, so the element's region is redrawn
+        // in full (along with any elements that overlap it)
+        if ((pGui->bRedrawPartialEn) && (pElem)) {
+          gslc_InvalidateRgnElem(pGui,pElem->rElem);
+          pGui->bScreenNeedRedrawRgn = true;
+          continue;
+        }
+        #endif // GSLC_BAND_EN && DRV_HAS_BAND
 
         // If partial redraw is supported, then we
         // look out for transparent elements which may
         // still warrant full page redraw.
         if (pGui->bRedrawPartialEn) {
           // Is the element transparent?
-          // FIXME: Instead of forcing full page redraw, consider
-          // using clipping region for partial redraw
           if (!(pElem->nFeatures & GSLC_ELEM_FEA_FILL_EN)) {
             bRedrawFullPage = true;
           }
@@ -2290,55 +3605,27 @@ void gslc_PageRedrawCalc(gslc_tsGui* pGui)
   } // nStackPage
 
   if (bRedrawFullPage) {
+    #if (GSLC_REDRAW_TRANSP_CLIP)
+    if ((pGui->bRedrawPartialEn) && (pGui->bInvalidateEn)) {
+      // Limit the redraw to the invalidated regions
+      pGui->bScreenNeedRedrawRgn = true;
+      return;
+    }
+    #endif // GSLC_REDRAW_TRANSP_CLIP
     // Mark the entire screen as requiring redraw
     gslc_PageRedrawSet(pGui,true);
   }
 
 }
 
-// Redraw the active page
-// - If the page has been marked as needing redraw, then all
-//   elements are rendered
-// - If the entire page has not been marked as needing redraw then only
-//   the elements that have been marked as needing redraw
-//   are rendered.
-void gslc_PageRedrawGo(gslc_tsGui* pGui)
+// Redraw the background (if forced) and issue the draw events
+// to each page in the stack, within the current clipping region
+void gslc_PageRedrawStack(gslc_tsGui* pGui,bool bForce)
 {
-  // Update any page redraw status that may be required
-  // - Note that this routine handles cases where an element
-  //   marked as requiring update is semi-transparent which can
-  //   cause other elements to be redrawn as well.
-  gslc_PageRedrawCalc(pGui);
-
-  // Determine final state of full-screen redraw
-  bool  bPageRedraw = gslc_PageRedrawGet(pGui);
-
-  // Set the clipping based on the current invalidated region
-  if (pGui->bInvalidateEn) {
-    #if defined(DBG_REDRAW)
-    // Note that this will still outline the invalidation region
-    // even if we later discover that the changed element is on
-    // a page in the stack that has been disabled through
-    // abPageStackDoDraw[] = false.
-    GSLC_DEBUG_PRINT("DBG: PageRedrawGo() InvRgn: En=%d (%d,%u)-(%d,%d) PageRedraw=%d\n",
-      pGui->bInvalidateEn, pGui->rInvalidateRect.x, pGui->rInvalidateRect.y,
-      pGui->rInvalidateRect.x + pGui->rInvalidateRect.w - 1,
-      pGui->rInvalidateRect.y + pGui->rInvalidateRect.h - 1, bPageRedraw);
-
-    // Mark the invalidation region
-    gslc_DrvDrawFrameRect(pGui, pGui->rInvalidateRect, GSLC_COL_RED);
-
-    // Slow down rendering
-    delay(1000);
-    #endif // DBG_REDRAW
-
-    gslc_SetClipRect(pGui, &(pGui->rInvalidateRect));
-  }
-  else {
-    // No invalidation region defined, so default the
-    // clipping region to the entire display
-    gslc_SetClipRect(pGui, NULL);
-  }
+  // Draw other elements (as needed, unless forced page or region redraw)
+  // TODO: Handle GSLC_EVTSUB_DRAW_NEEDED
+  uint32_t nSubType = (bForce)?GSLC_EVTSUB_DRAW_FORCE:GSLC_EVTSUB_DRAW_NEEDED;
+  void*    pvData = NULL;
 
   // If a full page redraw is required, then start by
   // redrawing the background.
@@ -2351,20 +3638,14 @@ void gslc_PageRedrawGo(gslc_tsGui* pGui)
   //   TODO: Fix this assumption (either add specific flag
   //         for bBkgndNeedRedraw or make the background just
   //         another element).
-  if (bPageRedraw) {
+  // - When redrawing the invalidated regions, the background is
+  //   only redrawn within the current clipping region.
+  if (bForce) {
+    GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_BKGND);
     gslc_DrvDrawBkgnd(pGui);
     gslc_PageFlipSet(pGui,true);
   }
 
-  // Draw other elements (as needed, unless forced page redraw)
-  // TODO: Handle GSLC_EVTSUB_DRAW_NEEDED
-  uint32_t nSubType = (bPageRedraw)?GSLC_EVTSUB_DRAW_FORCE:GSLC_EVTSUB_DRAW_NEEDED;
-  void*    pvData = NULL;
-
-  // TODO: Consider creating a flag that indicates whether any elements
-  // on the page have requested redraw. This would enable us to skip
-  // over this exhaustive search every time we call Update()
-
   // Issue page redraw events to all pages in stack
   // - Start from bottom page in stack first
   for (int nStackPage = 0; nStackPage < GSLC_STACK__MAX; nStackPage++) {
@@ -2372,8 +3653,8 @@ void gslc_PageRedrawGo(gslc_tsGui* pGui)
     if (!pStackPage) {
       continue;
     }
-    if (!bPageRedraw && !pGui->abPageStackDoDraw[nStackPage]) {
-      // When doing a full page redraw, proceed as normal
+    if (!bForce && !pGui->abPageStackDoDraw[nStackPage]) {
+      // When doing a full page (or region) redraw, proceed as normal
       // When only doing a parital page redraw, check to see if
       // the page has been marked as redraw-disabled. If so, skip
       // updating the elements on the page.
@@ -2389,10 +3670,168 @@ void gslc_PageRedrawGo(gslc_tsGui* pGui)
     gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_DRAW,nSubType,pvData,NULL);
     gslc_PageEvent(pGui,sEvent);
   }
+}
+
+// Redraw the active page
+// - If the page has been marked as needing redraw, then all
+//   elements are rendered
+// - If the entire page has not been marked as needing redraw then only
+//   the elements that have been marked as needing redraw
+//   are rendered.
+void gslc_PageRedrawGo(gslc_tsGui* pGui)
+{
+  // Update any page redraw status that may be required
+  // - Note that this routine handles cases where an element
+  //   marked as requiring update is semi-transparent which can
+  //   cause other elements to be redrawn as well.
+  gslc_PageRedrawCalc(pGui);
 
+  // Determine final state of full-screen redraw
+  bool  bPageRedraw = gslc_PageRedrawGet(pGui);
+
+  // Determine if the invalidated regions are to be redrawn in full
+  // (background and all overlapping elements). In this mode, each
+  // region is redrawn in its own pass.
+  bool  bRgnRedraw = (!bPageRedraw) && (pGui->bScreenNeedRedrawRgn);
+
+  // Determine the number of clipped redraw passes
+  // - If multiple (non-overlapping) regions have been invalidated,
+  //   each region is redrawn in its own pass, clipped to that region
+  // - Otherwise a single pass is performed, clipped to the
+  //   invalidated region (or the entire display if none)
+  uint8_t     nPass;
+  uint8_t     nPassCnt = 1;
+  gslc_tsRect rClip;
+  if ((bRgnRedraw) && (pGui->nInvalidateRectCnt == 0)) {
+    // Only empty regions were invalidated but elements may still
+    // be awaiting redraw, so fall back to a single pass that
+    // is clipped to the entire display
+    pGui->bInvalidateEn = false;
+  } else if (bRgnRedraw) {
+    nPassCnt = pGui->nInvalidateRectCnt;
+  } else if ((pGui->bInvalidateEn) && (pGui->nInvalidateRectCnt > 1)) {
+    nPassCnt = pGui->nInvalidateRectCnt;
+  }
+
+  #if (GSLC_STATS_EN)
+  if (bPageRedraw) {
+    pGui->sStats.nRedrawFull++;
+  } else {
+    pGui->sStats.nRedrawPartial++;
+  }
+  pGui->sStats.nRedrawPass += nPassCnt;
+  #endif // GSLC_STATS_EN
+
+  #if (DRV_HAS_FRAME_LOCK)
+  // Keep the display locked across the pixel primitives of all passes
+  gslc_DrvFrameLock(pGui);
+  #endif
+
+  for (nPass = 0; nPass < nPassCnt; nPass++) {
+
+    // Set the clipping based on the current invalidated region
+    if (pGui->bInvalidateEn) {
+      if ((nPassCnt > 1) || (bRgnRedraw)) {
+        // Restrict element drawing to those overlapping this region
+        pGui->nInvalidateRectCur = (int8_t)nPass;
+        rClip = pGui->asInvalidateRect[nPass];
+      } else {
+        rClip = pGui->rInvalidateRect;
+      }
+
+      #if defined(DBG_REDRAW)
+      // Note that this will still outline the invalidation region
+      // even if we later discover that the changed element is on
+      // a page in the stack that has been disabled through
+      // abPageStackDoDraw[] = false.
+      GSLC_DEBUG_PRINT("DBG: PageRedrawGo() InvRgn: En=%d Pass=%u/%u (%d,%u)-(%d,%d) PageRedraw=%d\n",
+        pGui->bInvalidateEn, nPass + 1, nPassCnt, rClip.x, rClip.y,
+        rClip.x + rClip.w - 1, rClip.y + rClip.h - 1, bPageRedraw);
+
+      // Mark the invalidation region
+      GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_RECT_FRAME);
+      gslc_DrvDrawFrameRect(pGui, rClip, GSLC_COL_RED);
+
+      // Slow down rendering
+      delay(1000);
+      #endif // DBG_REDRAW
+
+      gslc_SetClipRect(pGui, &rClip);
+      #if (GSLC_STATS_EN)
+      pGui->sStats.nInvalidateArea += (uint32_t)rClip.w * rClip.h;
+      #endif
+    }
+    else {
+      // No invalidation region defined, so default the
+      // clipping region to the entire display
+      rClip.x = 0;
+      rClip.y = 0;
+      rClip.w = pGui->nDispW;
+      rClip.h = pGui->nDispH;
+      gslc_SetClipRect(pGui, NULL);
+      #if (GSLC_STATS_EN)
+      pGui->sStats.nInvalidateArea += (uint32_t)pGui->nDispW * pGui->nDispH;
+      #endif
+    }
+
+    #if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+    // Compose the clipping region in horizontal bands within the
+    // driver's band buffer, pushing each band to the display once
+    // it has been completed.
+    // - Only a forced redraw (background upwards) can compose a
+    //   complete band. Otherwise (eg. only elements on pages with
+    //   redraw disabled were pending), or if the driver can't provide
+    //   a band, the region is drawn directly.
+    gslc_tsRect rDisp = { 0, 0, pGui->nDispW, pGui->nDispH };
+    gslc_tsRect rArea = rClip;
+    gslc_tsRect rBand;
+    int16_t     nAreaY1;
+    bool        bBand = (bPageRedraw || bRgnRedraw) && gslc_ClipRect(&rDisp,&rArea);
+    rBand = rArea;
+    nAreaY1 = rArea.y + (int16_t)rArea.h;
+    while ((bBand) && (rBand.y < nAreaY1)) {
+      rBand.h = (uint16_t)(nAreaY1 - rBand.y);
+      if (rBand.h > GSLC_BAND_H) {
+        rBand.h = GSLC_BAND_H;
+      }
+      bBand = gslc_DrvBandStart(pGui,rBand);
+      if (!bBand) {
+        break;
+      }
+      gslc_SetClipRect(pGui,&rBand);
+      gslc_PageRedrawStack(pGui,(bPageRedraw || bRgnRedraw));
+      GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_BAND);
+      bBand = gslc_DrvBandFlush(pGui);
+      if (!bBand) {
+        // The driver discarded the band (eg. it contained content
+        // that can only be drawn directly to the display)
+        break;
+      }
+      rBand.y += (int16_t)rBand.h;
+    }
+    if (!bBand) {
+      // Draw the remainder of the region directly
+      if (rBand.y > rArea.y) {
+        rBand.h = (uint16_t)(nAreaY1 - rBand.y);
+        gslc_SetClipRect(pGui,&rBand);
+      } else {
+        gslc_SetClipRect(pGui,&rClip);
+      }
+      gslc_PageRedrawStack(pGui,(bPageRedraw || bRgnRedraw));
+    }
+    #else
+    gslc_PageRedrawStack(pGui,(bPageRedraw || bRgnRedraw));
+    #endif // GSLC_BAND_EN && DRV_HAS_BAND
+
+  } // nPass
+
+  #if (DRV_HAS_FRAME_LOCK)
+  gslc_DrvFrameUnlock(pGui);
+  #endif
 
   // Clear the page redraw flag
   gslc_PageRedrawSet(pGui,false);
+  pGui->bScreenNeedRedrawRgn = false;
 
   // Reset the invalidated regions
   gslc_InvalidateRgnReset(pGui);
@@ -2427,70 +3866,844 @@ void gslc_PageFlipSet(gslc_tsGui* pGui,bool bNeeded)
 #endif
 }
 
-bool gslc_PageFlipGet(gslc_tsGui* pGui)
+bool gslc_PageFlipGet(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    return false;
+  }
+
+  return pGui->bScreenNeedFlip;
+}
+
+void gslc_PageFlipGo(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    return;
+  }
+
+  if (pGui->bScreenNeedFlip) {
+    gslc_DrvPageFlipNow(pGui);
+
+    // Indicate that page flip is no longer required
+    gslc_PageFlipSet(pGui,false);
+  }
+}
+
+
+gslc_tsPage* gslc_PageFindById(gslc_tsGui* pGui,int16_t nPageId)
+{
+  int8_t nInd;
+
+  // Loop through list of pages
+  // Return pointer to page
+  gslc_tsPage*  pFoundPage = NULL;
+  for (nInd=0;nInd<pGui->nPageMax;nInd++) {
+    if (pGui->asPage[nInd].nPageId == nPageId) {
+      pFoundPage = &pGui->asPage[nInd];
+      break;
+    }
+  }
+
+  // Error handling: if not found, make this a fatal error
+  // as it shows a serious config error and continued operation
+  // is not viable.
+  if (pFoundPage == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: PageFindById() can't find page (ID=%d)\n",nPageId);
+    return NULL;
+  }
+
+  return pFoundPage;
+}
+
+gslc_tsPage* gslc_PageFindByElemRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  uint8_t         nInd;
+  gslc_tsCollect* pCollect;
+
+  if (pElemRef == NULL) {
+    return NULL;
+  }
+  // Check the page found by the previous lookup first
+  if (pGui->nPageIndRefLast < pGui->nPageCnt) {
+    pCollect = &(pGui->asPage[pGui->nPageIndRefLast].sCollect);
+    if ((pElemRef >= pCollect->asElemRef) && (pElemRef < pCollect->asElemRef + pCollect->nElemRefMax)) {
+      return &(pGui->asPage[pGui->nPageIndRefLast]);
+    }
+  }
+  // Locate the page whose element reference array holds the reference
+  for (nInd=0;nInd<pGui->nPageCnt;nInd++) {
+    pCollect = &(pGui->asPage[nInd].sCollect);
+    if ((pElemRef >= pCollect->asElemRef) && (pElemRef < pCollect->asElemRef + pCollect->nElemRefMax)) {
+      pGui->nPageIndRefLast = nInd;
+      return &(pGui->asPage[nInd]);
+    }
+  }
+  return NULL;
+}
+
+bool gslc_PageInStack(gslc_tsGui* pGui,gslc_tsPage* pPage)
+{
+  uint8_t nStackPage;
+  for (nStackPage=0;nStackPage<GSLC_STACK__MAX;nStackPage++) {
+    if (pGui->apPageStack[nStackPage] == pPage) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void gslc_PageTick(gslc_tsGui* pGui)
+{
+#if (GSLC_FEATURE_TICK_SCHED)
+  gslc_tsTickSched* pSched = &(pGui->sTickSched);
+  uint32_t          nTimeNow = gslc_GetTimeMs();
+  int8_t            nEntry;
+
+  if (pSched->bOverflow) {
+    // Not all of the elements with a tick callback could be
+    // registered, so fall back to ticking every page
+    gslc_PageTickAll(pGui);
+    return;
+  }
+
+  pSched->bBusy = true;
+
+  // Call the elements that tick on every update
+  while ((nEntry = pSched->anHead[GSLC_TICK_LIST_EVERY]) >= 0) {
+    gslc_TickSchedUnlink(pSched,nEntry);
+    gslc_TickSchedFire(pGui,nEntry,nTimeNow,-1);
+  }
+  gslc_TickSchedRelink(pSched,GSLC_TICK_LIST_DONE);
+
+  // Visit the wheel slots covering the time since the last update
+  // - The slot of the last update is visited again as some of its
+  //   entries may have come due since then
+  // - After a long delay, each slot is visited once
+  uint32_t  nSlotTimeLast = pSched->nTimeLast / GSLC_TICK_WHEEL_RES_MS;
+  uint32_t  nSlotTimeNow  = nTimeNow / GSLC_TICK_WHEEL_RES_MS;
+  uint32_t  nSlotCnt      = nSlotTimeNow - nSlotTimeLast + 1;
+  uint32_t  nSlotInd;
+  int8_t    nSlot;
+  if (nSlotCnt > GSLC_TICK_WHEEL_SLOTS) {
+    nSlotCnt = GSLC_TICK_WHEEL_SLOTS;
+  }
+  for (nSlotInd=0;nSlotInd<nSlotCnt;nSlotInd++) {
+    nSlot = (int8_t)((nSlotTimeLast + nSlotInd) % GSLC_TICK_WHEEL_SLOTS);
+    while ((nEntry = pSched->anHead[nSlot]) >= 0) {
+      gslc_TickSchedUnlink(pSched,nEntry);
+      gslc_TickSchedFire(pGui,nEntry,nTimeNow,nSlot);
+    }
+    gslc_TickSchedRelink(pSched,GSLC_TICK_LIST_DONE);
+  }
+  pSched->nTimeLast = nTimeNow;
+
+  // Place any elements that were registered by the callbacks
+  pSched->bBusy = false;
+  gslc_TickSchedRelink(pSched,GSLC_TICK_LIST_NEW);
+
+#else
+  gslc_PageTickAll(pGui);
+#endif // GSLC_FEATURE_TICK_SCHED
+}
+
+void gslc_PageTickAll(gslc_tsGui* pGui)
+{
+  // Issue a timer tick to all pages
+  // - This is independent of the pages in the stack
+  //   unless GSLC_TICK_STACK_ONLY is enabled
+  uint8_t       nPageInd;
+  gslc_tsPage*  pPage = NULL;
+  for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+    pPage = &pGui->asPage[nPageInd];
+    #if (GSLC_TICK_STACK_ONLY)
+    if (!gslc_PageInStack(pGui,pPage)) {
+      continue;
+    }
+    #endif // GSLC_TICK_STACK_ONLY
+    gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_TICK,0,(void*)pPage,NULL);
+    gslc_PageEvent(pGui,sEvent);
+  }
+}
+
+#if (GSLC_FEATURE_TICK_SCHED)
+bool gslc_TickSchedAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsPage* pPage,uint32_t nIntervalMs)
+{
+  gslc_tsTickSched* pSched = &(pGui->sTickSched);
+  int8_t            nEntry = -1;
+  int8_t            nInd;
+
+  // Reuse the element's existing entry, otherwise take a free one
+  for (nInd=0;nInd<GSLC_TICK_SCHED_MAX;nInd++) {
+    if (pSched->asEntry[nInd].pElemRef == pElemRef) {
+      nEntry = nInd;
+      break;
+    }
+    if ((nEntry < 0) && (pSched->asEntry[nInd].pElemRef == NULL)) {
+      nEntry = nInd;
+    }
+  }
+  if (nEntry < 0) {
+    // Fall back to ticking every element on every update so
+    // that the element still receives its ticks
+    GSLC_DEBUG2_PRINT("ERROR: TickSchedAdd() too many tick elements (max %d)\n",GSLC_TICK_SCHED_MAX);
+    pSched->bOverflow = true;
+    return false;
+  }
+
+  gslc_tsTickEntry* pEntry = &(pSched->asEntry[nEntry]);
+  gslc_TickSchedUnlink(pSched,nEntry);
+  pEntry->pElemRef  = pElemRef;
+  pEntry->pPage     = pPage;
+  pEntry->nInterval = nIntervalMs;
+  pEntry->nDue      = gslc_GetTimeMs() + nIntervalMs;
+
+  // Defer placement if we were called from a tick callback
+  if (pSched->bBusy) {
+    gslc_TickSchedLink(pSched,nEntry,GSLC_TICK_LIST_NEW);
+  } else {
+    gslc_TickSchedLink(pSched,nEntry,gslc_TickSchedGetList(pEntry));
+  }
+  return true;
+}
+
+void gslc_TickSchedRemove(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  gslc_tsTickSched* pSched = &(pGui->sTickSched);
+  int8_t            nInd;
+  for (nInd=0;nInd<GSLC_TICK_SCHED_MAX;nInd++) {
+    if (pSched->asEntry[nInd].pElemRef == pElemRef) {
+      gslc_TickSchedUnlink(pSched,nInd);
+      pSched->asEntry[nInd].pElemRef = NULL;
+      return;
+    }
+  }
+}
+
+void gslc_TickSchedLink(gslc_tsTickSched* pSched,int8_t nEntry,int8_t nList)
+{
+  // Append to the end of the list so that the callback order is
+  // preserved as entries move between lists
+  gslc_tsTickEntry* pEntry = &(pSched->asEntry[nEntry]);
+  int8_t            nTail = pSched->anTail[nList];
+  pEntry->nList = nList;
+  pEntry->nPrev = nTail;
+  pEntry->nNext = -1;
+  if (nTail >= 0) {
+    pSched->asEntry[nTail].nNext = nEntry;
+  } else {
+    pSched->anHead[nList] = nEntry;
+  }
+  pSched->anTail[nList] = nEntry;
+}
+
+void gslc_TickSchedUnlink(gslc_tsTickSched* pSched,int8_t nEntry)
+{
+  gslc_tsTickEntry* pEntry = &(pSched->asEntry[nEntry]);
+  if (pEntry->nList == GSLC_TICK_LIST_NONE) {
+    return;
+  }
+  if (pEntry->nPrev >= 0) {
+    pSched->asEntry[pEntry->nPrev].nNext = pEntry->nNext;
+  } else {
+    pSched->anHead[pEntry->nList] = pEntry->nNext;
+  }
+  if (pEntry->nNext >= 0) {
+    pSched->asEntry[pEntry->nNext].nPrev = pEntry->nPrev;
+  } else {
+    pSched->anTail[pEntry->nList] = pEntry->nPrev;
+  }
+  pEntry->nList = GSLC_TICK_LIST_NONE;
+  pEntry->nPrev = -1;
+  pEntry->nNext = -1;
+}
+
+int8_t gslc_TickSchedGetList(gslc_tsTickEntry* pEntry)
+{
+  if (pEntry->nInterval == 0) {
+    return GSLC_TICK_LIST_EVERY;
+  }
+  return (int8_t)((pEntry->nDue / GSLC_TICK_WHEEL_RES_MS) % GSLC_TICK_WHEEL_SLOTS);
+}
+
+void gslc_TickSchedRelink(gslc_tsTickSched* pSched,int8_t nListSrc)
+{
+  int8_t nEntry;
+  while ((nEntry = pSched->anHead[nListSrc]) >= 0) {
+    gslc_TickSchedUnlink(pSched,nEntry);
+    gslc_TickSchedLink(pSched,nEntry,gslc_TickSchedGetList(&(pSched->asEntry[nEntry])));
+  }
+}
+
+void gslc_TickSchedFire(gslc_tsGui* pGui,int8_t nEntry,uint32_t nTimeNow,int8_t nSlotCur)
+{
+  gslc_tsTickSched* pSched = &(pGui->sTickSched);
+  gslc_tsTickEntry* pEntry = &(pSched->asEntry[nEntry]);
+
+  // Entries in a wheel slot are only due once their time has come
+  // (the slot is shared by all times that are a multiple of the
+  // wheel duration apart)
+  if ((pEntry->nInterval == 0) || ((int32_t)(nTimeNow - pEntry->nDue) >= 0)) {
+    // Schedule the next tick before calling the callback so that
+    // the callback may change its own interval
+    // - If we have fallen behind, skip the missed ticks
+    pEntry->nDue += pEntry->nInterval;
+    if ((int32_t)(nTimeNow - pEntry->nDue) >= 0) {
+      pEntry->nDue = nTimeNow + pEntry->nInterval;
+    }
+
+    #if (GSLC_TICK_STACK_ONLY)
+    bool bActive = gslc_PageInStack(pGui,pEntry->pPage);
+    #else
+    bool bActive = true;
+    #endif // GSLC_TICK_STACK_ONLY
+    if (bActive) {
+      // Since we are going to use the callback within the element
+      // we need to ensure it is cached in RAM first
+      gslc_tsElemRef* pElemRef = pEntry->pElemRef;
+      gslc_tsElem*    pElem = gslc_GetElemFromRef(pGui,pElemRef);
+      GSLC_CB_TICK    pfuncXTick = (pElem)? pElem->pfuncXTick : NULL;
+      if (pfuncXTick != NULL) {
+        (*pfuncXTick)((void*)pGui,(void*)(pElemRef));
+      }
+    }
+  }
+
+  // The callback may have removed or re-registered the entry
+  if ((pEntry->pElemRef == NULL) || (pEntry->nList != GSLC_TICK_LIST_NONE)) {
+    return;
+  }
+
+  // Entries that stay in the list being visited are set aside
+  // until the visit is complete
+  int8_t nList = gslc_TickSchedGetList(pEntry);
+  if ((nList == nSlotCur) || ((nList == GSLC_TICK_LIST_EVERY) && (nSlotCur < 0))) {
+    nList = GSLC_TICK_LIST_DONE;
+  }
+  gslc_TickSchedLink(pSched,nEntry,nList);
+}
+#endif // GSLC_FEATURE_TICK_SCHED
+
+gslc_tsElemRef* gslc_PageFindElemById(gslc_tsGui* pGui,int16_t nPageId,int16_t nElemId)
+{
+  gslc_tsPage*    pPage = NULL;
+  gslc_tsElemRef* pElemRef = NULL;
+
+  // Get the page
+  pPage = gslc_PageFindById(pGui,nPageId);
+  if (pPage == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: PageFindElemById() can't find page (ID=%d)\n",nPageId);
+    return NULL;
+  }
+  // Find the element reference in the page's element collection
+  pElemRef = gslc_CollectFindElemById(pGui,&pPage->sCollect,nElemId);
+  return pElemRef;
+}
+
+bool gslc_PageSetIndex(gslc_tsGui* pGui,int16_t nPageId,uint16_t* anIndexList,uint16_t nIndexMax)
+{
+  gslc_tsPage*    pPage = NULL;
+
+  // Get the page
+  pPage = gslc_PageFindById(pGui,nPageId);
+  if (pPage == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: PageSetIndex() can't find page (ID=%d)\n",nPageId);
+    return false;
+  }
+  return gslc_CollectSetIndex(pGui,&pPage->sCollect,anIndexList,nIndexMax);
+}
+
+bool gslc_PageSetCacheEn(gslc_tsGui* pGui,int16_t nPageId,bool bCacheEn)
+{
+#if (GSLC_PAGE_CACHE_EN)
+  gslc_tsPage*    pPage = NULL;
+  uint8_t         nInd;
+
+  // Get the page
+  pPage = gslc_PageFindById(pGui,nPageId);
+  if (pPage == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: PageSetCacheEn() can't find page (ID=%d)\n",nPageId);
+    return false;
+  }
+  pPage->bCacheEn = bCacheEn;
+  if (!bCacheEn) {
+    // Discard any snapshot of the page
+    for (nInd=0;nInd<GSLC_PAGE_CACHE_MAX;nInd++) {
+      if (pGui->asPageCache[nInd].nPageId == nPageId) {
+        pGui->asPageCache[nInd].nPageId = GSLC_PAGE_NONE;
+      }
+    }
+  }
+  return true;
+#else
+  (void)pGui; // Unused
+  (void)nPageId; // Unused
+  (void)bCacheEn; // Unused
+  GSLC_DEBUG2_PRINT("ERROR: PageSetCacheEn() requires GSLC_PAGE_CACHE_EN=1\n","");
+  return false;
+#endif // GSLC_PAGE_CACHE_EN
+}
+
+void gslc_PageCacheReset(gslc_tsGui* pGui)
+{
+#if (GSLC_PAGE_CACHE_EN)
+  uint8_t nInd;
+  // Mark all entries as unused, but retain their storage
+  // so that it can be reused by later snapshots
+  for (nInd=0;nInd<GSLC_PAGE_CACHE_MAX;nInd++) {
+    pGui->asPageCache[nInd].nPageId = GSLC_PAGE_NONE;
+    pGui->asPageCache[nInd].nPageBaseId = GSLC_PAGE_NONE;
+    pGui->asPageCache[nInd].nLastUse = 0;
+    pGui->asPageCache[nInd].nStaleCnt = 0;
+  }
+#endif // GSLC_PAGE_CACHE_EN
+#if (GSLC_POPUP_SAVE_EN)
+  pGui->sPopupSave.nPageId = GSLC_PAGE_NONE;
+  pGui->sPopupSave.nPageBaseId = GSLC_PAGE_NONE;
+  pGui->sPopupSave.nLastUse = 0;
+  pGui->sPopupSave.nStaleCnt = 0;
+#endif // GSLC_POPUP_SAVE_EN
+  (void)pGui; // Unused
+}
+
+#if (GSLC_PAGE_CACHE_EN)
+void gslc_PageCacheSave(gslc_tsGui* pGui)
+{
+#if (DRV_HAS_PAGE_SNAP)
+  gslc_tsPage*      pPage     = pGui->apPageStack[GSLC_STACK_CUR];
+  gslc_tsPage*      pPageBase = pGui->apPageStack[GSLC_STACK_BASE];
+  gslc_tsPageCache* pEntry    = NULL;
+  gslc_tsPageCache* pEntryCur;
+  uint8_t           nInd;
+  uint8_t           nEntryMax = GSLC_PAGE_CACHE_MAX;
+  uint32_t          nSnapSize;
+
+  if ((pPage == NULL) || (!pPage->bCacheEn)) {
+    return;
+  }
+  // The display must show the page in full and without a popup
+  if ((pGui->apPageStack[GSLC_STACK_OVERLAY] != NULL) || (pGui->bScreenNeedRedraw)) {
+    return;
+  }
+
+  // The snapshot holds the entire display
+  gslc_tsRect rSnap = { 0, 0, pGui->nDispW, pGui->nDispH };
+  nSnapSize = gslc_DrvPageSnapGetSize(pGui,rSnap);
+
+  #if (GSLC_PAGE_CACHE_BUDGET > 0)
+  // Limit the number of snapshots to the memory budget
+  if (nSnapSize == 0) {
+    nEntryMax = 0;
+  } else if ((uint32_t)GSLC_PAGE_CACHE_BUDGET / nSnapSize < nEntryMax) {
+    nEntryMax = (uint8_t)((uint32_t)GSLC_PAGE_CACHE_BUDGET / nSnapSize);
+  }
+  #if (GSLC_POPUP_SAVE_EN)
+  // The popup save-under shares the budget, but it is unused
+  // whenever a snapshot is taken (as no popup is shown), so its
+  // storage is released if the snapshots may need the room
+  if ((uint32_t)nEntryMax*nSnapSize + pGui->sPopupSave.nSnapSize > (uint32_t)GSLC_PAGE_CACHE_BUDGET) {
+    gslc_PageCacheRelease(pGui,&(pGui->sPopupSave));
+  }
+  #endif // GSLC_POPUP_SAVE_EN
+  #endif // GSLC_PAGE_CACHE_BUDGET
+
+  // Select an unused entry, otherwise replace the
+  // least recently used entry
+  for (nInd=0;nInd<nEntryMax;nInd++) {
+    pEntryCur = &(pGui->asPageCache[nInd]);
+    if ((pEntry == NULL) || (pEntryCur->nPageId == GSLC_PAGE_NONE)) {
+      pEntry = pEntryCur;
+      if (pEntryCur->nPageId == GSLC_PAGE_NONE) {
+        break;
+      }
+    } else if (pEntryCur->nLastUse < pEntry->nLastUse) {
+      pEntry = pEntryCur;
+    }
+  }
+  if (pEntry == NULL) {
+    return;
+  }
+
+  // The entry is unusable until the snapshot has been taken
+  pEntry->nPageId = GSLC_PAGE_NONE;
+  if (!gslc_DrvPageSnapSave(pGui,&(pEntry->pvSnap),rSnap)) {
+    return;
+  }
+  // The storage is only reallocated when it is too small
+  if (nSnapSize > pEntry->nSnapSize) {
+    pEntry->nSnapSize = nSnapSize;
+  }
+  pEntry->rSnap       = rSnap;
+  pEntry->nPageId     = pPage->nPageId;
+  pEntry->nPageBaseId = (pPageBase)? pPageBase->nPageId : GSLC_PAGE_NONE;
+  pEntry->nLastUse    = ++(pGui->nPageCacheTick);
+  pEntry->nStaleCnt   = 0;
+#else
+  (void)pGui; // Unused
+#endif // DRV_HAS_PAGE_SNAP
+}
+
+bool gslc_PageCacheRestore(gslc_tsGui* pGui)
+{
+#if (DRV_HAS_PAGE_SNAP)
+  gslc_tsPage*      pPage     = pGui->apPageStack[GSLC_STACK_CUR];
+  gslc_tsPage*      pPageBase = pGui->apPageStack[GSLC_STACK_BASE];
+  gslc_tsPageCache* pEntry    = NULL;
+  gslc_tsRect       rRestore;
+  uint8_t           nInd;
+  uint8_t           nStale;
+  uint8_t           nRestoreCnt;
+
+  if (pPage == NULL) {
+    return false;
+  }
+  for (nInd=0;nInd<GSLC_PAGE_CACHE_MAX;nInd++) {
+    if (pGui->asPageCache[nInd].nPageId == pPage->nPageId) {
+      pEntry = &(pGui->asPageCache[nInd]);
+      break;
+    }
+  }
+  if (pEntry == NULL) {
+    return false;
+  }
+  // The snapshot no longer tracks the display once the page
+  // is shown, so it is released whether or not it is used
+  pEntry->nPageId = GSLC_PAGE_NONE;
+  if ((!pPage->bCacheEn) || (pGui->apPageStack[GSLC_STACK_OVERLAY] != NULL)) {
+    return false;
+  }
+  if (pEntry->nPageBaseId != ((pPageBase)? pPageBase->nPageId : GSLC_PAGE_NONE)) {
+    return false;
+  }
+  // Only the regions invalidated by the page change can differ
+  // from the snapshot, so only those regions are restored
+  // - Regions that lie within a stale region are redrawn
+  //   afterwards anyway, so they are skipped
+  nRestoreCnt = (pGui->bInvalidateEn)? pGui->nInvalidateRectCnt : 1;
+  for (nInd=0;nInd<nRestoreCnt;nInd++) {
+    rRestore = (pGui->bInvalidateEn)? pGui->asInvalidateRect[nInd] : pEntry->rSnap;
+    for (nStale=0;nStale<pEntry->nStaleCnt;nStale++) {
+      if (gslc_ClipRectTest(&(pEntry->asStale[nStale]),rRestore) == GSLC_CLIP_IN) {
+        break;
+      }
+    }
+    if (nStale < pEntry->nStaleCnt) {
+      continue;
+    }
+    if (!gslc_DrvPageSnapRestore(pGui,pEntry->pvSnap,rRestore)) {
+      return false;
+    }
+    GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_COPY);
+  }
+  pEntry->nLastUse = ++(pGui->nPageCacheTick);
+
+  // Replace the full redraw requested by the page change with a
+  // redraw of the regions that changed while the page was hidden
+  gslc_PageCacheRedrawStale(pGui,pEntry);
+  return true;
+#else
+  (void)pGui; // Unused
+  return false;
+#endif // DRV_HAS_PAGE_SNAP
+}
+#endif // GSLC_PAGE_CACHE_EN
+
+#if (GSLC_POPUP_SAVE_EN)
+void gslc_PopupSaveTake(gslc_tsGui* pGui,int16_t nPageId)
+{
+#if (DRV_HAS_PAGE_SNAP)
+  gslc_tsPage*      pPage    = gslc_PageFindById(pGui,nPageId);
+  gslc_tsPage*      pPageCur = pGui->apPageStack[GSLC_STACK_CUR];
+  gslc_tsPageCache* pEntry   = &(pGui->sPopupSave);
+  gslc_tsRect       rDisp    = { 0, 0, pGui->nDispW, pGui->nDispH };
+  gslc_tsRect       rPend;
+  gslc_tsCollect*   pCollect;
+  gslc_tsElemRef*   pElemRef;
+  gslc_tsElem*      pElem;
+  uint32_t          nSnapSize;
+  uint16_t          nElemInd;
+  uint16_t          nRedrawFound;
+  uint8_t           nStackPage;
+  uint8_t           nInd;
+
+  pEntry->nPageId = GSLC_PAGE_NONE;
+  if (pPage == NULL) {
+    return;
+  }
+  // The display beneath the popup must be up to date, except for
+  // any pending region redraw (which is treated as stale)
+  if (pGui->apPageStack[GSLC_STACK_OVERLAY] != NULL) {
+    return;
+  }
+  if ((pGui->bScreenNeedRedraw) && (!pGui->bInvalidateEn)) {
+    return;
+  }
+  // The save-under covers the popup's bounds padded in the same
+  // way as its elements, so that the padded regions invalidated
+  // by the popup lie within it
+  pEntry->rSnap = gslc_InvalidateRgnPad(pGui,pPage->rBounds);
+  if ((pEntry->rSnap.w == 0) || (pEntry->rSnap.h == 0) || (!gslc_ClipRect(&rDisp,&(pEntry->rSnap)))) {
+    return;
+  }
+  nSnapSize = gslc_DrvPageSnapGetSize(pGui,pEntry->rSnap);
+
+  #if (GSLC_PAGE_CACHE_BUDGET > 0)
+  // The save-under shares the memory budget with the page snapshots
+  // - Storage larger than needed is released so that it doesn't
+  //   count against the budget
+  uint32_t nBudget = (uint32_t)GSLC_PAGE_CACHE_BUDGET;
+  #if (GSLC_PAGE_CACHE_EN)
+  for (nInd=0;nInd<GSLC_PAGE_CACHE_MAX;nInd++) {
+    nBudget = (pGui->asPageCache[nInd].nSnapSize < nBudget)? nBudget - pGui->asPageCache[nInd].nSnapSize : 0;
+  }
+  #endif // GSLC_PAGE_CACHE_EN
+  if (pEntry->nSnapSize > nSnapSize) {
+    gslc_PageCacheRelease(pGui,pEntry);
+  }
+  if ((nSnapSize == 0) || (nSnapSize > nBudget)) {
+    gslc_PageCacheRelease(pGui,pEntry);
+    return;
+  }
+  #endif // GSLC_PAGE_CACHE_BUDGET
+
+  if (!gslc_DrvPageSnapSave(pGui,&(pEntry->pvSnap),pEntry->rSnap)) {
+    return;
+  }
+  if (nSnapSize > pEntry->nSnapSize) {
+    pEntry->nSnapSize = nSnapSize;
+  }
+  pEntry->nPageId     = nPageId;
+  pEntry->nPageBaseId = (pPageCur)? pPageCur->nPageId : GSLC_PAGE_NONE;
+  pEntry->nStaleCnt   = 0;
+  if (!pGui->bInvalidateEn) {
+    return;
+  }
+  // Any region awaiting redraw beneath the popup is stale
+  // - If a redraw from the background is pending, the invalidated
+  //   regions may include areas to be erased. Otherwise they only
+  //   contain the elements awaiting redraw (which may include the
+  //   popup's own elements), so only those beneath are considered.
+  if ((pGui->bScreenNeedRedraw) || (pGui->bScreenNeedRedrawRgn)) {
+    for (nInd=0;nInd<pGui->nInvalidateRectCnt;nInd++) {
+      rPend = pGui->asInvalidateRect[nInd];
+      if (gslc_ClipRect(&(pEntry->rSnap),&rPend)) {
+        gslc_RectListAdd(pEntry->asStale,&(pEntry->nStaleCnt),GSLC_INVALIDATE_RECT_MAX,rPend);
+      }
+    }
+    return;
+  }
+  for (nStackPage=0;nStackPage<GSLC_STACK__MAX;nStackPage++) {
+    if (pGui->apPageStack[nStackPage] == NULL) {
+      continue;
+    }
+    pCollect = &(pGui->apPageStack[nStackPage]->sCollect);
+    nRedrawFound = 0;
+    for (nElemInd=0;(nElemInd<pCollect->nElemRefCnt) && (nRedrawFound<pCollect->nElemRefRedrawCnt);nElemInd++) {
+      pElemRef = &(pCollect->asElemRef[nElemInd]);
+      if ((pElemRef->eElemFlags & GSLC_ELEMREF_REDRAW_MASK) == GSLC_ELEMREF_REDRAW_NONE) {
+        continue;
+      }
+      nRedrawFound++;
+      pElem = gslc_GetElemFromRef(pGui,pElemRef);
+      if (pElem == NULL) {
+        continue;
+      }
+      rPend = gslc_InvalidateRgnPad(pGui,pElem->rElem);
+      if (gslc_ClipRect(&(pEntry->rSnap),&rPend)) {
+        gslc_RectListAdd(pEntry->asStale,&(pEntry->nStaleCnt),GSLC_INVALIDATE_RECT_MAX,rPend);
+      }
+    }
+  }
+#else
+  (void)pGui; // Unused
+  (void)nPageId; // Unused
+#endif // DRV_HAS_PAGE_SNAP
+}
+
+bool gslc_PopupSaveRestore(gslc_tsGui* pGui,gslc_tsRect* asRectPend,uint8_t nRectPend)
 {
-  if (pGui == NULL) {
+#if (DRV_HAS_PAGE_SNAP)
+  gslc_tsPageCache* pEntry = &(pGui->sPopupSave);
+  gslc_tsPage*      pPage;
+  gslc_tsRect       rBounds;
+  gslc_tsRect       rUnion;
+  gslc_tsRect       rPend;
+  gslc_tsRect       rIn;
+  int16_t           nX1,nY1,nInX1,nInY1;
+  uint8_t           nInd;
+
+  if (pEntry->nPageId == GSLC_PAGE_NONE) {
     return false;
   }
-
-  return pGui->bScreenNeedFlip;
+  // The save-under is only valid until the popup is hidden
+  pPage = gslc_PageFindById(pGui,pEntry->nPageId);
+  pEntry->nPageId = GSLC_PAGE_NONE;
+  if ((pPage == NULL) || (pGui->apPageStack[GSLC_STACK_OVERLAY] != NULL)) {
+    return false;
+  }
+  // If the popup has grown since it was shown, the region
+  // beyond the save-under must be redrawn as well
+  rBounds = gslc_InvalidateRgnPad(pGui,pPage->rBounds);
+  rUnion  = pEntry->rSnap;
+  gslc_UnionRect(&rUnion,rBounds);
+  if ((rUnion.x != pEntry->rSnap.x) || (rUnion.y != pEntry->rSnap.y) ||
+      (rUnion.w != pEntry->rSnap.w) || (rUnion.h != pEntry->rSnap.h)) {
+    gslc_RectListAdd(pEntry->asStale,&(pEntry->nStaleCnt),GSLC_INVALIDATE_RECT_MAX,rBounds);
+  }
+  if (!gslc_DrvPageSnapRestore(pGui,pEntry->pvSnap,pEntry->rSnap)) {
+    return false;
+  }
+  GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_COPY);
+
+  // Replace the redraw of the popup region with a redraw of the
+  // regions that changed while the popup was shown
+  gslc_PageCacheRedrawStale(pGui,pEntry);
+
+  // Retain the parts of the regions that were already awaiting
+  // redraw which lie outside of the save-under
+  // - Within the save-under, changes beneath the popup are covered
+  //   by the stale region and the popup itself is no longer shown
+  for (nInd=0;nInd<nRectPend;nInd++) {
+    rPend = asRectPend[nInd];
+    rIn   = rPend;
+    if (!gslc_ClipRect(&(pEntry->rSnap),&rIn)) {
+      gslc_InvalidateRgnAdd(pGui,rPend);
+      continue;
+    }
+    nY1   = rPend.y + (int16_t)rPend.h;
+    nInY1 = rIn.y + (int16_t)rIn.h;
+    nX1   = rPend.x + (int16_t)rPend.w;
+    nInX1 = rIn.x + (int16_t)rIn.w;
+    if (rIn.y > rPend.y) {
+      gslc_InvalidateRgnAdd(pGui,(gslc_tsRect){rPend.x,rPend.y,rPend.w,(uint16_t)(rIn.y-rPend.y)});
+    }
+    if (nInY1 < nY1) {
+      gslc_InvalidateRgnAdd(pGui,(gslc_tsRect){rPend.x,nInY1,rPend.w,(uint16_t)(nY1-nInY1)});
+    }
+    if (rIn.x > rPend.x) {
+      gslc_InvalidateRgnAdd(pGui,(gslc_tsRect){rPend.x,rIn.y,(uint16_t)(rIn.x-rPend.x),rIn.h});
+    }
+    if (nInX1 < nX1) {
+      gslc_InvalidateRgnAdd(pGui,(gslc_tsRect){nInX1,rIn.y,(uint16_t)(nX1-nInX1),rIn.h});
+    }
+  }
+  if (pGui->bInvalidateEn) {
+    pGui->bScreenNeedRedrawRgn = true;
+  }
+  return true;
+#else
+  (void)pGui; // Unused
+  (void)asRectPend; // Unused
+  (void)nRectPend; // Unused
+  return false;
+#endif // DRV_HAS_PAGE_SNAP
 }
+#endif // GSLC_POPUP_SAVE_EN
 
-void gslc_PageFlipGo(gslc_tsGui* pGui)
+#if (GSLC_PAGE_CACHE_EN) || (GSLC_POPUP_SAVE_EN)
+void gslc_PageCacheRedrawStale(gslc_tsGui* pGui,gslc_tsPageCache* pEntry)
 {
-  if (pGui == NULL) {
-    return;
-  }
-
-  if (pGui->bScreenNeedFlip) {
-    gslc_DrvPageFlipNow(pGui);
+  gslc_tsCollect*   pCollect;
+  gslc_tsElemRef*   pElemRef;
+  gslc_tsElem*      pElem;
+  uint16_t          nInd;
+  uint16_t          nRedrawFound;
+  uint8_t           nStackPage;
 
-    // Indicate that page flip is no longer required
-    gslc_PageFlipSet(pGui,false);
+  // Redraw (from the background upwards) the regions that may
+  // differ from the snapshot: those that changed since it was
+  // taken and those of any elements that are still awaiting redraw
+  gslc_InvalidateRgnReset(pGui);
+  gslc_PageRedrawSet(pGui,false);
+  for (nInd=0;nInd<pEntry->nStaleCnt;nInd++) {
+    gslc_InvalidateRgnAdd(pGui,pEntry->asStale[nInd]);
+  }
+  for (nStackPage=0;nStackPage<GSLC_STACK__MAX;nStackPage++) {
+    if (pGui->apPageStack[nStackPage] == NULL) {
+      continue;
+    }
+    pCollect = &(pGui->apPageStack[nStackPage]->sCollect);
+    nRedrawFound = 0;
+    for (nInd=0;(nInd<pCollect->nElemRefCnt) && (nRedrawFound<pCollect->nElemRefRedrawCnt);nInd++) {
+      pElemRef = &(pCollect->asElemRef[nInd]);
+      if ((pElemRef->eElemFlags & GSLC_ELEMREF_REDRAW_MASK) == GSLC_ELEMREF_REDRAW_NONE) {
+        continue;
+      }
+      nRedrawFound++;
+      pElem = gslc_GetElemFromRef(pGui,pElemRef);
+      if ((pElem) && (pElem->rElem.w != 0) && (pElem->rElem.h != 0)) {
+        gslc_InvalidateRgnElem(pGui,pElem->rElem);
+      }
+    }
+  }
+  if (pGui->bInvalidateEn) {
+    pGui->bScreenNeedRedrawRgn = true;
   }
+  pGui->bRedrawNeeded = true;
+  gslc_PageFlipSet(pGui,true);
 }
 
-
-gslc_tsPage* gslc_PageFindById(gslc_tsGui* pGui,int16_t nPageId)
+void gslc_PageCacheStale(gslc_tsGui* pGui,gslc_tsPage* pPage,gslc_tsRect rRect)
 {
-  int8_t nInd;
-
-  // Loop through list of pages
-  // Return pointer to page
-  gslc_tsPage*  pFoundPage = NULL;
-  for (nInd=0;nInd<pGui->nPageMax;nInd++) {
-    if (pGui->asPage[nInd].nPageId == nPageId) {
-      pFoundPage = &pGui->asPage[nInd];
-      break;
+  gslc_tsPageCache* pEntry;
+  if (pPage == NULL) {
+    return;
+  }
+  // Cover any drawing just beyond the element's rect
+  rRect = gslc_InvalidateRgnPad(pGui,rRect);
+  #if (GSLC_PAGE_CACHE_EN)
+  uint8_t           nInd;
+  for (nInd=0;nInd<GSLC_PAGE_CACHE_MAX;nInd++) {
+    pEntry = &(pGui->asPageCache[nInd]);
+    if (pEntry->nPageId == GSLC_PAGE_NONE) {
+      continue;
+    }
+    if ((pEntry->nPageId == pPage->nPageId) || (pEntry->nPageBaseId == pPage->nPageId)) {
+      gslc_RectListAdd(pEntry->asStale,&(pEntry->nStaleCnt),GSLC_INVALIDATE_RECT_MAX,rRect);
     }
   }
-
-  // Error handling: if not found, make this a fatal error
-  // as it shows a serious config error and continued operation
-  // is not viable.
-  if (pFoundPage == NULL) {
-    GSLC_DEBUG2_PRINT("ERROR: PageFindById() can't find page (ID=%d)\n",nPageId);
-    return NULL;
+  #endif // GSLC_PAGE_CACHE_EN
+  #if (GSLC_POPUP_SAVE_EN)
+  // Only the pages shown beneath the popup affect its save-under
+  // - Changes outside of the save-under are redrawn as usual, so
+  //   only the part of the region that it covers is stale
+  pEntry = &(pGui->sPopupSave);
+  if ((pEntry->nPageId != GSLC_PAGE_NONE) &&
+      ((pPage == pGui->apPageStack[GSLC_STACK_CUR]) || (pPage == pGui->apPageStack[GSLC_STACK_BASE]))) {
+    if (gslc_ClipRect(&(pEntry->rSnap),&rRect)) {
+      gslc_RectListAdd(pEntry->asStale,&(pEntry->nStaleCnt),GSLC_INVALIDATE_RECT_MAX,rRect);
+    }
   }
-
-  return pFoundPage;
+  #endif // GSLC_POPUP_SAVE_EN
 }
 
-gslc_tsElemRef* gslc_PageFindElemById(gslc_tsGui* pGui,int16_t nPageId,int16_t nElemId)
+void gslc_PageCacheRelease(gslc_tsGui* pGui,gslc_tsPageCache* pEntry)
 {
-  gslc_tsPage*    pPage = NULL;
-  gslc_tsElemRef* pElemRef = NULL;
+  #if (DRV_HAS_PAGE_SNAP)
+  if (pEntry->pvSnap) {
+    gslc_DrvPageSnapFree(pGui,pEntry->pvSnap);
+  }
+  #else
+  (void)pGui; // Unused
+  #endif
+  pEntry->nPageId   = GSLC_PAGE_NONE;
+  pEntry->pvSnap    = NULL;
+  pEntry->nSnapSize = 0;
+}
 
-  // Get the page
-  pPage = gslc_PageFindById(pGui,nPageId);
-  if (pPage == NULL) {
-    GSLC_DEBUG2_PRINT("ERROR: PageFindElemById() can't find page (ID=%d)\n",nPageId);
-    return NULL;
+void gslc_PageCacheFree(gslc_tsGui* pGui)
+{
+  gslc_PageCacheReset(pGui);
+  #if (GSLC_PAGE_CACHE_EN)
+  uint8_t nInd;
+  for (nInd=0;nInd<GSLC_PAGE_CACHE_MAX;nInd++) {
+    gslc_PageCacheRelease(pGui,&(pGui->asPageCache[nInd]));
   }
-  // Find the element reference in the page's element collection
-  pElemRef = gslc_CollectFindElemById(pGui,&pPage->sCollect,nElemId);
-  return pElemRef;
+  #endif // GSLC_PAGE_CACHE_EN
+  #if (GSLC_POPUP_SAVE_EN)
+  gslc_PageCacheRelease(pGui,&(pGui->sPopupSave));
+  #endif // GSLC_POPUP_SAVE_EN
 }
+#endif // GSLC_PAGE_CACHE_EN || GSLC_POPUP_SAVE_EN
 
 /* UNUSED
 void gslc_PageSetEventFunc(gslc_tsGui* pGui,gslc_tsPage* pPage,GSLC_CB_EVENT funcCb)
@@ -2639,6 +4852,7 @@ void gslc_SetRoundRadius(gslc_tsGui* pGui,uint8_t nRadius)
   pGui->nRoundRadius = (int16_t)nRadius;
   // Update redraw flag
   gslc_PageRedrawSet(pGui,true);
+  gslc_PageCacheReset(pGui);
 }
 
 void gslc_SetFocusCol(gslc_tsGui* pGui,gslc_tsColor colFocusNone,gslc_tsColor colFocus,gslc_tsColor colFocusEdit)
@@ -2979,8 +5193,114 @@ void gslc_ElemDraw(gslc_tsGui* pGui,int16_t nPageId,int16_t nElemId)
   gslc_ElemEvent(pGui,sEvent);
 }
 
-void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFont* pTxtFont,gslc_teTxtFlags eTxtFlags,
-  int8_t eTxtAlign,gslc_tsColor colTxt,gslc_tsColor colBg,int16_t nMarginW,int16_t nMarginH)
+// -----------------------------------------------------------------------
+// Text Extent Functions
+// -----------------------------------------------------------------------
+
+void gslc_TxtCacheReset(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "TxtCacheReset";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+#if (GSLC_TXT_CACHE_EN)
+  uint8_t nInd;
+  for (nInd=0;nInd<GSLC_TXT_CACHE_MAX;nInd++) {
+    pGui->asTxtCache[nInd].pFont = NULL;
+  }
+  pGui->nTxtCacheNext = 0;
+#endif // GSLC_TXT_CACHE_EN
+#if (GSLC_TXT_CACHE_EN) || (GSLC_TXT_MEMO_EN)
+  // Advance the generation so that all element memos become stale
+  // - Generation 0 is reserved to mark an invalid memo
+  pGui->nTxtGen++;
+  if (pGui->nTxtGen == 0) {
+    pGui->nTxtGen = 1;
+  }
+#endif
+}
+
+#if (GSLC_TXT_CACHE_EN) || (GSLC_TXT_MEMO_EN)
+// Calculate a hash (32-bit FNV-1a) of a text string and its length
+// - The string may reside in FLASH (GSLC_TXT_MEM_PROG)
+uint32_t gslc_TxtCacheHash(const char* pStr,gslc_teTxtFlags eTxtFlags,uint16_t* pnLen)
+{
+  uint32_t  nHash = 2166136261UL;
+  uint16_t  nLen = 0;
+  char      ch;
+  bool      bProg = ((eTxtFlags & GSLC_TXT_MEM) == GSLC_TXT_MEM_PROG);
+  while (1) {
+    #if (GSLC_USE_PROGMEM)
+    ch = (bProg) ? pgm_read_byte(&pStr[nLen]) : pStr[nLen];
+    #else
+    (void)bProg; // Unused
+    ch = pStr[nLen];
+    #endif
+    if (ch == '\0') {
+      break;
+    }
+    nHash = (nHash ^ (uint8_t)ch) * 16777619UL;
+    nLen++;
+  }
+  *pnLen = nLen;
+  return nHash;
+}
+#endif // GSLC_TXT_CACHE_EN || GSLC_TXT_MEMO_EN
+
+bool gslc_TxtCacheGetSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,
+  int16_t* pnTxtX,int16_t* pnTxtY,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH)
+{
+#if (GSLC_TXT_CACHE_EN)
+  if ((pGui == NULL) || (pFont == NULL) || (pStr == NULL)) {
+    // Leave the error handling to the driver
+    return gslc_DrvGetTxtSize(pGui,pFont,pStr,eTxtFlags,pnTxtX,pnTxtY,pnTxtSzW,pnTxtSzH);
+  }
+
+  // Only the memory type and encoding affect the text extents
+  gslc_teTxtFlags       eKeyFlags = (gslc_teTxtFlags)(eTxtFlags & (GSLC_TXT_MEM | GSLC_TXT_ENC));
+  uint16_t              nLen;
+  uint32_t              nHash = gslc_TxtCacheHash(pStr,eTxtFlags,&nLen);
+  gslc_tsTxtCacheEntry* pEntry;
+  uint8_t               nInd;
+
+  for (nInd=0;nInd<GSLC_TXT_CACHE_MAX;nInd++) {
+    pEntry = &(pGui->asTxtCache[nInd]);
+    if ((pEntry->pFont == pFont) && (pEntry->nHash == nHash) &&
+        (pEntry->nLen == nLen) && (pEntry->eTxtFlags == eKeyFlags)) {
+      *pnTxtX   = pEntry->nTxtOffsetX;
+      *pnTxtY   = pEntry->nTxtOffsetY;
+      *pnTxtSzW = pEntry->nTxtSzW;
+      *pnTxtSzH = pEntry->nTxtSzH;
+      return true;
+    }
+  }
+
+  // Not cached, so measure the text and replace the oldest entry
+  if (!gslc_DrvGetTxtSize(pGui,pFont,pStr,eTxtFlags,pnTxtX,pnTxtY,pnTxtSzW,pnTxtSzH)) {
+    return false;
+  }
+  pEntry = &(pGui->asTxtCache[pGui->nTxtCacheNext]);
+  pEntry->pFont       = pFont;
+  pEntry->nHash       = nHash;
+  pEntry->nLen        = nLen;
+  pEntry->eTxtFlags   = eKeyFlags;
+  pEntry->nTxtOffsetX = *pnTxtX;
+  pEntry->nTxtOffsetY = *pnTxtY;
+  pEntry->nTxtSzW     = *pnTxtSzW;
+  pEntry->nTxtSzH     = *pnTxtSzH;
+  pGui->nTxtCacheNext = (pGui->nTxtCacheNext+1) % GSLC_TXT_CACHE_MAX;
+  return true;
+#else
+  return gslc_DrvGetTxtSize(pGui,pFont,pStr,eTxtFlags,pnTxtX,pnTxtY,pnTxtSzW,pnTxtSzH);
+#endif // GSLC_TXT_CACHE_EN
+}
+
+// Draw text with full text justification, optionally using
+// an element's text memo (see GSLC_TXT_MEMO_EN)
+// - pMemo may be NULL
+void gslc_DrawTxtBaseMemo(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFont* pTxtFont,gslc_teTxtFlags eTxtFlags,
+  int8_t eTxtAlign,gslc_tsColor colTxt,gslc_tsColor colBg,int16_t nMarginW,int16_t nMarginH,gslc_tsTxtMemo* pMemo)
 {
   int16_t   nElemX,nElemY;
   uint16_t  nElemW,nElemH;
@@ -3020,8 +5340,19 @@ void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFo
     int16_t nX1 = nX0 + nElemW - 2*nMarginW;
     int16_t nY1 = nY0 + nElemH - 2*nMarginH;
 
+#if (GSLC_CLIP_EN)
+    // Skip the text render if the bounding box is outside the clipping region
+    gslc_tsRect rClip = gslc_GetClipRect(pGui);
+    gslc_tsRect rTxtBox = (gslc_tsRect) { nX0, nY0, (uint16_t)(nX1-nX0+1), (uint16_t)(nY1-nY0+1) };
+    if (!gslc_IsRectOverlap(rClip,rTxtBox)) {
+      return;
+    }
+#endif // GSLC_CLIP_EN
+
+    GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_TXT);
     gslc_DrvDrawTxtAlign(pGui,nX0,nY0,nX1,nY1,eTxtAlign,pTxtFont,
             pStrBuf,eTxtFlags,colTxt,colBg);
+    (void)pMemo; // Unused
 
 #else // DRV_OVERRIDE_TXT_ALIGN
 
@@ -3043,20 +5374,76 @@ void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFo
     int16_t       nTxtOffsetY=0;
     uint16_t      nTxtSzW=0;
     uint16_t      nTxtSzH=0;
-    gslc_DrvGetTxtSize(pGui,pTxtFont,pStrBuf,eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
 
     // Calculate the text alignment
     int16_t       nTxtX,nTxtY;
 
-    // Check for ALIGNH_LEFT & ALIGNH_RIGHT. Default to ALIGNH_MID
-    if      (eTxtAlign & GSLC_ALIGNH_LEFT)     { nTxtX = nElemX+nMarginW; }
-    else if (eTxtAlign & GSLC_ALIGNH_RIGHT)    { nTxtX = nElemX+nElemW-nMarginW-nTxtSzW; }
-    else                                       { nTxtX = nElemX+(nElemW/2)-(nTxtSzW/2); }
+    bool          bMemoOk = false;
+#if (GSLC_TXT_MEMO_EN)
+    // Reuse the text position from the previous draw if nothing
+    // that affects it has changed since
+    // - The string is compared by hash as the text buffer may
+    //   have been edited in place (eg. GSLC_TXT_ALLOC_EXT)
+    uint32_t      nMemoHash = 0;
+    uint16_t      nMemoLen = 0;
+    if ((pMemo) && (pMemo->bEn)) {
+      nMemoHash = gslc_TxtCacheHash(pStrBuf,eTxtFlags,&nMemoLen);
+    }
+    if ((pMemo) && (pMemo->bEn) && (pMemo->nGen == pGui->nTxtGen) &&
+        (pMemo->nHash == nMemoHash) && (pMemo->nLen == nMemoLen) &&
+        (pMemo->rTxt.x == rTxt.x) && (pMemo->rTxt.y == rTxt.y) &&
+        (pMemo->rTxt.w == rTxt.w) && (pMemo->rTxt.h == rTxt.h)) {
+      nTxtX       = pMemo->rTxtBox.x;
+      nTxtY       = pMemo->rTxtBox.y;
+      nTxtSzW     = pMemo->rTxtBox.w;
+      nTxtSzH     = pMemo->rTxtBox.h;
+      nTxtOffsetX = pMemo->nTxtOffsetX;
+      nTxtOffsetY = pMemo->nTxtOffsetY;
+      bMemoOk     = true;
+    }
+#else
+    (void)pMemo; // Unused
+#endif // GSLC_TXT_MEMO_EN
+
+    if (!bMemoOk) {
+      bool bTxtSzOk = gslc_TxtCacheGetSize(pGui,pTxtFont,pStrBuf,eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
+
+      // Check for ALIGNH_LEFT & ALIGNH_RIGHT. Default to ALIGNH_MID
+      if      (eTxtAlign & GSLC_ALIGNH_LEFT)     { nTxtX = nElemX+nMarginW; }
+      else if (eTxtAlign & GSLC_ALIGNH_RIGHT)    { nTxtX = nElemX+nElemW-nMarginW-nTxtSzW; }
+      else                                       { nTxtX = nElemX+(nElemW/2)-(nTxtSzW/2); }
+
+      // Check for ALIGNV_TOP & ALIGNV_BOT. Default to ALIGNV_MID
+      if      (eTxtAlign & GSLC_ALIGNV_TOP)      { nTxtY = nElemY+nMarginH; }
+      else if (eTxtAlign & GSLC_ALIGNV_BOT)      { nTxtY = nElemY+nElemH-nMarginH-nTxtSzH; }
+      else                                       { nTxtY = nElemY+(nElemH/2)-(nTxtSzH/2); }
+
+#if (GSLC_TXT_MEMO_EN)
+      if ((pMemo) && (pMemo->bEn) && (bTxtSzOk)) {
+        pMemo->nGen         = pGui->nTxtGen;
+        pMemo->rTxt         = rTxt;
+        pMemo->nHash        = nMemoHash;
+        pMemo->nLen         = nMemoLen;
+        pMemo->rTxtBox      = (gslc_tsRect) { nTxtX, nTxtY, nTxtSzW, nTxtSzH };
+        pMemo->nTxtOffsetX  = nTxtOffsetX;
+        pMemo->nTxtOffsetY  = nTxtOffsetY;
+      }
+#else
+      (void)bTxtSzOk; // Unused
+#endif // GSLC_TXT_MEMO_EN
+    }
 
-    // Check for ALIGNV_TOP & ALIGNV_BOT. Default to ALIGNV_MID
-    if      (eTxtAlign & GSLC_ALIGNV_TOP)      { nTxtY = nElemY+nMarginH; }
-    else if (eTxtAlign & GSLC_ALIGNV_BOT)      { nTxtY = nElemY+nElemH-nMarginH-nTxtSzH; }
-    else                                       { nTxtY = nElemY+(nElemH/2)-(nTxtSzH/2); }
+#if (GSLC_CLIP_EN)
+    // Skip the text render if it is outside the clipping region
+    // - Partially visible text is passed to the driver, which
+    //   clips it (generally one glyph at a time)
+    // - Text is always rendered if the driver didn't report its size
+    gslc_tsRect rClip = gslc_GetClipRect(pGui);
+    gslc_tsRect rTxtBox = (gslc_tsRect) { nTxtX, nTxtY, nTxtSzW, nTxtSzH };
+    if ((nTxtSzW > 0) && (nTxtSzH > 0) && (!gslc_IsRectOverlap(rClip,rTxtBox))) {
+      return;
+    }
+#endif // GSLC_CLIP_EN
 
     // Now correct for offset from text bounds
     // - This is used by the driver (such as Adafruit-GFX) to provide an
@@ -3065,6 +5452,7 @@ void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFo
     nTxtY -= nTxtOffsetY;
 
     // Call the driver text rendering routine
+    GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_TXT);
     gslc_DrvDrawTxt(pGui,nTxtX,nTxtY,pTxtFont,pStrBuf,eTxtFlags,colTxt,colBg);
 
 #endif // DRV_OVERRIDE_TXT_ALIGN
@@ -3075,6 +5463,12 @@ void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFo
   }
 }
 
+void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFont* pTxtFont,gslc_teTxtFlags eTxtFlags,
+  int8_t eTxtAlign,gslc_tsColor colTxt,gslc_tsColor colBg,int16_t nMarginW,int16_t nMarginH)
+{
+  gslc_DrawTxtBaseMemo(pGui,pStrBuf,rTxt,pTxtFont,eTxtFlags,eTxtAlign,colTxt,colBg,nMarginW,nMarginH,NULL);
+}
+
 // Draw an element to the active display
 // - Element is referenced by an element pointer
 // - TODO: Handle GSLC_TYPE_BKGND
@@ -3101,6 +5495,8 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     return true;
   }
 
+  gslc_StatsElemRedraw(pGui,pElem->nType);
+
   // --------------------------------------------------------------------------
   // Init for default drawing
   // --------------------------------------------------------------------------
@@ -3194,10 +5590,12 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
   // Draw any images associated with element
   if (pElem->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) {
     if ((bGlowing) && (pElem->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE)) {
+      GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_IMAGE);
       bOk = gslc_DrvDrawImage(pGui,nElemX,nElemY,pElem->sImgRefGlow);
     } else {
       // Note that when we are focused we are highlighting the frame
       // so we just draw the normal image.
+      GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_IMAGE);
       bOk = gslc_DrvDrawImage(pGui,nElemX,nElemY,pElem->sImgRefNorm);
     }
     if (!bOk) {
@@ -3233,10 +5631,18 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     int8_t        nMarginX  = pElem->nTxtMarginX;
     int8_t        nMarginY  = pElem->nTxtMarginY;
 
+    // Only elements stored in RAM can record the text position
+    gslc_tsTxtMemo* pTxtMemo = NULL;
+    #if (GSLC_TXT_MEMO_EN)
+    if ((pElemRef->eElemFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_RAM) {
+      pTxtMemo = &(pElem->sTxtMemo);
+    }
+    #endif
+
     // Note that we use the "inner" region for text placement to
     // avoid overlapping any frame
-    gslc_DrawTxtBase(pGui, pElem->pStrBuf, sState.rInner, pElem->pTxtFont, pElem->eTxtFlags,
-      pElem->eTxtAlign, sState.colTxtFore, sState.colTxtBack, nMarginX, nMarginY);
+    gslc_DrawTxtBaseMemo(pGui, pElem->pStrBuf, sState.rInner, pElem->pTxtFont, pElem->eTxtFlags,
+      pElem->eTxtAlign, sState.colTxtFore, sState.colTxtBack, nMarginX, nMarginY, pTxtMemo);
   }
 
   // --------------------------------------------------------------------------
@@ -3252,6 +5658,17 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
 // Element Update Functions
 // ------------------------------------------------------------------------
 
+// Discard the remembered text position of an element
+// - Called whenever the element's text, font or alignment changes
+void gslc_ElemTxtMemoReset(gslc_tsElem* pElem)
+{
+#if (GSLC_TXT_MEMO_EN)
+  pElem->sTxtMemo.nGen = 0;
+#else
+  (void)pElem; // Unused
+#endif // GSLC_TXT_MEMO_EN
+}
+
 void gslc_ElemSetFillEn(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bFillEn)
 {
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
@@ -3356,14 +5773,23 @@ void gslc_ElemSetRect(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsRect rEle
   if (!pElem) return;
 
   // Invalidate region including both rects from before & after
-  gslc_InvalidateRgnAdd(pGui, pElem->rElem); // Old region
-  gslc_InvalidateRgnAdd(pGui, rElem); // New region
+  gslc_InvalidateRgnElem(pGui, pElem->rElem); // Old region
+  gslc_InvalidateRgnElem(pGui, rElem); // New region
   // Force a page redraw within the scope defined by the invalidation region
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
   gslc_PageRedrawSet(pGui,true);
+  #if (GSLC_PAGE_CACHE_EN) || (GSLC_POPUP_SAVE_EN)
+  gslc_PageCacheStale(pGui,gslc_PageFindByElemRef(pGui,pElemRef),rElem);
+  #endif
 
   // Update element
   pElem->rElem           = rElem;
+  gslc_ElemTxtMemoReset(pElem);
+
+  #if (GSLC_FEATURE_COLLECT_INDEX)
+  // Mark the spatial index of all collections as out of date
+  pGui->nCollectIndexGen++;
+  #endif
 
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
@@ -3383,6 +5809,7 @@ void gslc_ElemSetTxtAlign(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,unsigned nAl
   if (!pElem) return;
 
   pElem->eTxtAlign        = nAlign;
+  gslc_ElemTxtMemoReset(pElem);
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -3393,6 +5820,7 @@ void gslc_ElemSetTxtMargin(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,unsigned nM
 
   pElem->nTxtMarginX       = nMargin;
   pElem->nTxtMarginY       = nMargin;
+  gslc_ElemTxtMemoReset(pElem);
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -3403,6 +5831,7 @@ void gslc_ElemSetTxtMarginXY(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int8_t nM
 
   pElem->nTxtMarginX       = nMarginX;
   pElem->nTxtMarginY       = nMarginY;
+  gslc_ElemTxtMemoReset(pElem);
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -3435,6 +5864,10 @@ void gslc_ElemSetTxtStr(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,const char* pS
     return;
   }
 
+  // The buffer may have been modified in place (GSLC_TXT_ALLOC_EXT)
+  // so the text position is always recalculated
+  gslc_ElemTxtMemoReset(pElem);
+
   // To avoid unnecessary redraw / flicker, only a change in
   // the text content will drive a redraw
 
@@ -3481,6 +5914,7 @@ void gslc_ElemSetTxtMem(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teTxtFlag
   }
   gslc_teTxtFlags eFlagsCur = pElem->eTxtFlags;
   pElem->eTxtFlags = (eFlagsCur & ~GSLC_TXT_MEM) | (eFlags & GSLC_TXT_MEM);
+  gslc_ElemTxtMemoReset(pElem);
 }
 
 void gslc_ElemSetTxtEnc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teTxtFlags eFlags)
@@ -3490,6 +5924,7 @@ void gslc_ElemSetTxtEnc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teTxtFlag
 
   gslc_teTxtFlags eFlagsCur = pElem->eTxtFlags;
   pElem->eTxtFlags = (eFlagsCur & ~GSLC_TXT_ENC) | (eFlags & GSLC_TXT_ENC);
+  gslc_ElemTxtMemoReset(pElem);
 }
 
 void gslc_ElemUpdateFont(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int nFontId)
@@ -3498,6 +5933,7 @@ void gslc_ElemUpdateFont(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int nFontId)
   if (!pElem) return;
 
   pElem->pTxtFont = gslc_FontGet(pGui,nFontId);
+  gslc_ElemTxtMemoReset(pElem);
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -3559,7 +5995,28 @@ void gslc_ElemSetRedraw(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     // Mark the region as invalidated
     // - Only invalidate if the element is visible on the screen
     if (gslc_ElemGetOnScreen(pGui,pElemRef)) {
-      gslc_InvalidateRgnAdd(pGui, pElem->rElem);
+      gslc_InvalidateRgnElem(pGui, pElem->rElem);
+    }
+    #if (GSLC_PAGE_CACHE_EN) || (GSLC_POPUP_SAVE_EN)
+    // Note the change in any page snapshot showing the element
+    if (pElem) {
+      gslc_PageCacheStale(pGui,gslc_PageFindByElemRef(pGui,pElemRef),pElem->rElem);
+    }
+    #endif // GSLC_PAGE_CACHE_EN || GSLC_POPUP_SAVE_EN
+  }
+
+  // Update the page's count of elements requiring redraw
+  // when the element enters or leaves the redraw-pending state
+  bool bRedrawPendOld = (eFlagsRedrawOld != GSLC_ELEMREF_REDRAW_NONE);
+  bool bRedrawPendNew = ((eFlags & GSLC_ELEMREF_REDRAW_MASK) != GSLC_ELEMREF_REDRAW_NONE);
+  if (bRedrawPendOld != bRedrawPendNew) {
+    gslc_tsPage* pPage = gslc_PageFindByElemRef(pGui,pElemRef);
+    if ((pPage) && (pPage->sCollect.bRedrawCntEn)) {
+      if (bRedrawPendNew) {
+        pPage->sCollect.nElemRefRedrawCnt++;
+      } else if (pPage->sCollect.nElemRefRedrawCnt > 0) {
+        pPage->sCollect.nElemRefRedrawCnt--;
+      }
     }
   }
 
@@ -3754,7 +6211,7 @@ void gslc_ElemSetVisible(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bVisible
       // Since we are hiding an element, we need to invalidate
       // the region underneath the element, so that it can
       // be redrawn.
-      gslc_InvalidateRgnAdd(pGui, pElem->rElem);
+      gslc_InvalidateRgnElem(pGui, pElem->rElem);
       // Mark the page as having a redraw pending
       gslc_PageRedrawSet(pGui,true);
      }
@@ -4107,11 +6564,30 @@ void gslc_ElemSetDrawFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_DRAW
 }
 
 void gslc_ElemSetTickFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_TICK funcCb)
+{
+  gslc_ElemSetTickFuncInterval(pGui,pElemRef,funcCb,0);
+}
+
+void gslc_ElemSetTickFuncInterval(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_TICK funcCb,uint32_t nIntervalMs)
 {
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
   if (!pElem) return;
 
   pElem->pfuncXTick       = funcCb;
+
+  #if (GSLC_FEATURE_TICK_SCHED)
+  // Update the element's registration with the tick scheduler
+  // - Elements that are not on a page (eg. within a compound
+  //   element) are not ticked
+  gslc_tsPage* pPage = gslc_PageFindByElemRef(pGui,pElemRef);
+  if ((funcCb != NULL) && (pPage != NULL)) {
+    gslc_TickSchedAdd(pGui,pElemRef,pPage,nIntervalMs);
+  } else {
+    gslc_TickSchedRemove(pGui,pElemRef);
+  }
+  #else
+  (void)nIntervalMs; // Unused
+  #endif // GSLC_FEATURE_TICK_SCHED
 }
 
 bool gslc_ElemOwnsCoord(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nX,int16_t nY,bool bOnlyClickEn)
@@ -5321,16 +7797,77 @@ bool gslc_CollectEvent(void* pvGui,gslc_tsEvent sEvent)
 
   } else if ( (sEvent.eType == GSLC_EVT_DRAW) || (sEvent.eType == GSLC_EVT_TICK) ) {
     // DRAW and TICK are propagated down to all elements in collection
+    gslc_tsGui*     pGui      = (gslc_tsGui*)(pvGui);
+    gslc_tsElem*    pElem     = NULL;
+    bool            bRedrawPend;
+    bool            bSkip;
+    #if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+    gslc_tsRect     rElemPad;
+    #endif
+
+    // When only drawing the elements that require redraw, the
+    // collection's redraw count (if maintained) enables us to skip
+    // the elements that don't require redraw and stop once all
+    // of those that do have been visited.
+    // - nRedrawLeft counts the visited elements that still
+    //   require redraw (eg. outside of the current region)
+    bool            bDrawNeeded = (sEvent.eType == GSLC_EVT_DRAW) && (sEvent.nSubType == GSLC_EVTSUB_DRAW_NEEDED);
+    bool            bRedrawCnt  = (bDrawNeeded) && (pCollect->bRedrawCntEn);
+    uint16_t        nRedrawLeft = 0;
 
     for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+      if ((bRedrawCnt) && (pCollect->nElemRefRedrawCnt <= nRedrawLeft)) {
+        break;
+      }
       pElemRef = &(pCollect->asElemRef[nInd]);
+      bRedrawPend = ((pElemRef->eElemFlags & GSLC_ELEMREF_REDRAW_MASK) != GSLC_ELEMREF_REDRAW_NONE);
+      if ((bDrawNeeded) && (!bRedrawPend)) {
+        continue;
+      }
+      bSkip = false;
+
+      // When redrawing multiple invalidated regions, skip any
+      // elements that don't need drawing in the current region
+      // - The element's rect is padded (as for its invalidated region)
+      //   to include any drawing just beyond it (eg. a focus frame)
+      if ((sEvent.eType == GSLC_EVT_DRAW) && (pGui->nInvalidateRectCur >= 0)) {
+        pElem = gslc_GetElemFromRef(pGui,pElemRef);
+        if ((pElem) && (!gslc_InvalidateRgnTest(pGui,
+            gslc_ExpandRect(pElem->rElem,GSLC_INVALIDATE_PAD,GSLC_INVALIDATE_PAD),bRedrawPend))) {
+          bSkip = true;
+        }
+      }
+
+      #if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+      // When composing a band, skip any elements that don't overlap it
+      // - Elements with a pending redraw that lie outside the redraw
+      //   region altogether are still passed through so that their
+      //   redraw state is cleared (their drawing is fully clipped)
+      if ((!bSkip) && (sEvent.eType == GSLC_EVT_DRAW)) {
+        pElem = gslc_GetElemFromRef(pGui,pElemRef);
+        if (pElem) {
+          rElemPad = gslc_ExpandRect(pElem->rElem,GSLC_INVALIDATE_PAD,GSLC_INVALIDATE_PAD);
+          if (!gslc_IsRectOverlap(rElemPad,gslc_GetClipRect(pGui))) {
+            if ((!bRedrawPend) || (gslc_InvalidateRgnTest(pGui,rElemPad,false))) {
+              bSkip = true;
+            }
+          }
+        }
+      }
+      #endif // GSLC_BAND_EN && DRV_HAS_BAND
 
-      // Copy event so we can modify it in the loop
-      gslc_tsEvent sEventNew = sEvent;
-      sEventNew.pvScope = (void*)(pElemRef);
+      if (!bSkip) {
+        // Copy event so we can modify it in the loop
+        gslc_tsEvent sEventNew = sEvent;
+        sEventNew.pvScope = (void*)(pElemRef);
+
+        // Propagate the event to the element
+        gslc_ElemEvent(pvGui,sEventNew);
+      }
 
-      // Propagate the event to the element
-      gslc_ElemEvent(pvGui,sEventNew);
+      if ((bRedrawCnt) && ((pElemRef->eElemFlags & GSLC_ELEMREF_REDRAW_MASK) != GSLC_ELEMREF_REDRAW_NONE)) {
+        nRedrawLeft++;
+      }
 
     } // nInd
 
@@ -5404,12 +7941,17 @@ gslc_tsElemRef* gslc_CollectElemAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,co
     //   pointer after the call is complete
     nElemInd = pCollect->nElemCnt;
     pCollect->asElem[nElemInd] = *pElem;
+    #if (GSLC_TXT_MEMO_EN)
+    // The element now owns its copy, so its text position can be remembered
+    pCollect->asElem[nElemInd].sTxtMemo.bEn  = true;
+    pCollect->asElem[nElemInd].sTxtMemo.nGen = 0;
+    #endif
     pCollect->nElemCnt++;
 
     // Add a reference
     // - Pointer (pElem) links to an item of internal element array
     nElemRefInd = pCollect->nElemRefCnt;
-    pCollect->asElemRef[nElemRefInd].eElemFlags = eFlags;
+    pCollect->asElemRef[nElemRefInd].eElemFlags = (gslc_teElemRefFlags)(eFlags & ~GSLC_ELEMREF_REDRAW_MASK);
     pCollect->asElemRef[nElemRefInd].pElem = &(pCollect->asElem[nElemInd]);
     pCollect->nElemRefCnt++;
 
@@ -5433,15 +7975,22 @@ gslc_tsElemRef* gslc_CollectElemAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,co
 
     // Add a reference
     nElemRefInd = pCollect->nElemRefCnt;
-    pCollect->asElemRef[nElemRefInd].eElemFlags = eFlags;
+    pCollect->asElemRef[nElemRefInd].eElemFlags = (gslc_teElemRefFlags)(eFlags & ~GSLC_ELEMREF_REDRAW_MASK);
     pCollect->asElemRef[nElemRefInd].pElem = (gslc_tsElem*)pElem;  // Typecast to drop const modifier
     pCollect->nElemRefCnt++;
   }
 
+  #if (GSLC_FEATURE_COLLECT_INDEX)
+  // The spatial index needs to be rebuilt to include the new element
+  pCollect->bIndexValid = false;
+  #endif
+
   // Fetch a pointer to the element reference array entry
   gslc_tsElemRef* pElemRef = &(pCollect->asElemRef[nElemRefInd]);
 
   // Mark any newly added element as requiring redraw
+  // - The redraw state was cleared above so that the
+  //   element is included in the collection's redraw count
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 
   // Return the new element reference
@@ -5521,6 +8070,13 @@ gslc_tsElemRef* gslc_ElemAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* pElem
   // Update the page's bounding rect
   gslc_UnionRect(&(pPage->rBounds), pElemLocal->rElem);
 
+  #if (GSLC_FEATURE_TICK_SCHED)
+  // Register any tick callback (eg. defined in FLASH) with the scheduler
+  if (pElemLocal->pfuncXTick != NULL) {
+    gslc_TickSchedAdd(pGui,pElemRefAdd,pPage,0);
+  }
+  #endif // GSLC_FEATURE_TICK_SCHED
+
   return pElemRefAdd;
 }
 
@@ -5587,6 +8143,7 @@ bool gslc_SetBkgndImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
   if (!gslc_DrvSetBkgndImage(pGui,sImgRef)) {
     return false;
   }
+  gslc_PageCacheReset(pGui);
   gslc_InvalidateRgnScreen(pGui);
   gslc_PageFlipSet(pGui,true);
   return true;
@@ -5597,6 +8154,7 @@ bool gslc_SetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol)
   if (!gslc_DrvSetBkgndColor(pGui,nCol)) {
     return false;
   }
+  gslc_PageCacheReset(pGui);
   gslc_InvalidateRgnScreen(pGui);
   gslc_PageFlipSet(pGui,true);
   return true;
@@ -5613,6 +8171,11 @@ bool gslc_GuiRotate(gslc_tsGui* pGui, uint8_t nRotation)
   // Simple wrapper for driver-specific rotation
   bool bOk = gslc_DrvRotate(pGui,nRotation);
 
+  #if (GSLC_PAGE_CACHE_EN) || (GSLC_POPUP_SAVE_EN)
+  // The snapshots no longer match the display dimensions
+  gslc_PageCacheFree(pGui);
+  #endif
+
   // Invalidate the new screen dimensions
   gslc_InvalidateRgnScreen(pGui);
 
@@ -5633,24 +8196,42 @@ bool gslc_ElemSendEventTouch(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefTracked,
     return false; //FIXME: Need to add this check!
   }
 
-  // Check to see if the deferred event queue is available
-  if (pGui->bEventPending) {
-    // If the pending slot already has an event, then
-    // service it now and then save the new event into
-    // the pending slot.
-    gslc_ElemEvent((void*)pGui,pGui->sEventPend);
+  // If the deferred event queue is full, then service the
+  // oldest event now to make room for the new event.
+  if (pGui->nEventPendCnt >= GSLC_EVENT_PEND_MAX) {
+    gslc_ElemEventPendIssue(pGui);
   }
-  // Now we can save the new event into the pending slot
-  pGui->sEventTouchPend.eTouch = eTouch;
-  pGui->sEventTouchPend.nX = nX;
-  pGui->sEventTouchPend.nY = nY;
-  pGui->sEventPend = gslc_EventCreate(pGui,GSLC_EVT_TOUCH,0,(void*)pElemRefTracked,&(pGui->sEventTouchPend));
-  pGui->bEventPending = true;
+  // Now we can save the new event into the next free slot
+  uint8_t nSlot = (pGui->nEventPendHead + pGui->nEventPendCnt) % GSLC_EVENT_PEND_MAX;
+  pGui->asEventTouchPend[nSlot].eTouch = eTouch;
+  pGui->asEventTouchPend[nSlot].nX = nX;
+  pGui->asEventTouchPend[nSlot].nY = nY;
+  pGui->asEventPend[nSlot] = gslc_EventCreate(pGui,GSLC_EVT_TOUCH,0,(void*)pElemRefTracked,&(pGui->asEventTouchPend[nSlot]));
+  pGui->nEventPendCnt++;
 
   return true;
 #endif // !DRV_TOUCH_NONE
 }
 
+bool gslc_ElemEventPendIssue(gslc_tsGui* pGui)
+{
+  if (pGui->nEventPendCnt == 0) {
+    return false;
+  }
+  // Release the slot before issuing the event since the
+  // event handler may defer further events. The touch data
+  // is copied so that it can't be overwritten in the meantime.
+  uint8_t             nSlot = pGui->nEventPendHead;
+  gslc_tsEventTouch   sEventTouch = pGui->asEventTouchPend[nSlot];
+  gslc_tsEvent        sEvent = pGui->asEventPend[nSlot];
+  sEvent.pvData = (void*)&sEventTouch;
+  pGui->nEventPendHead = (nSlot + 1) % GSLC_EVENT_PEND_MAX;
+  pGui->nEventPendCnt--;
+
+  gslc_ElemEvent((void*)pGui,sEvent);
+  return true;
+}
+
 // Initialize the element struct to all zeros
 void gslc_ResetElem(gslc_tsElem* pElem)
 {
@@ -5698,6 +8279,11 @@ void gslc_ResetElem(gslc_tsElem* pElem)
 #if (GSLC_FEATURE_COMPOUND)
   pElem->pElemRefParent   = NULL;
 #endif
+#if (GSLC_TXT_MEMO_EN)
+  // Virtual elements (not added to a page) don't use the text memo
+  pElem->sTxtMemo.bEn     = false;
+  pElem->sTxtMemo.nGen    = 0;
+#endif
 
 }
 
@@ -5808,6 +8394,11 @@ void gslc_GuiDestruct(gslc_tsGui* pGui)
   // Close all fonts
   gslc_DrvFontsDestruct(pGui);
 
+  #if (GSLC_PAGE_CACHE_EN) || (GSLC_POPUP_SAVE_EN)
+  // Release the page snapshots
+  gslc_PageCacheFree(pGui);
+  #endif
+
   // Close any driver-specific data
   gslc_DrvDestruct(pGui);
 
@@ -5852,6 +8443,18 @@ void gslc_CollectReset(gslc_tsCollect* pCollect,gslc_tsElem* asElem,uint16_t nEl
   // Reset touch / input tracking
   pCollect->pElemRefTracked = NULL;
   pCollect->nElemIndTracked = GSLC_IND_NONE;
+
+  // Reset redraw tracking
+  pCollect->nElemRefRedrawCnt = 0;
+  pCollect->bRedrawCntEn      = false;
+
+  #if (GSLC_FEATURE_COLLECT_INDEX)
+  // No spatial index until storage is assigned
+  pCollect->anIndexList   = NULL;
+  pCollect->nIndexListMax = 0;
+  pCollect->bIndexValid   = false;
+  pCollect->bIndexFull    = false;
+  #endif
 }
 
 
@@ -5926,6 +8529,38 @@ gslc_tsElemRef* gslc_CollectFindElemFromCoord(gslc_tsGui* pGui,gslc_tsCollect* p
   *pnElemInd = GSLC_IND_NONE;
 
   if (pCollect->nElemRefCnt == 0) { return NULL; }
+
+  #if (GSLC_FEATURE_COLLECT_INDEX)
+  // If a spatial index is available, only search the elements
+  // that overlap the grid cell containing the coordinate
+  if (gslc_CollectIndexBuild(pGui,pCollect)) {
+    // The grid covers the bounds of all elements
+    if ((nX < pCollect->nIndexX0) || (nY < pCollect->nIndexY0)) {
+      return NULL;
+    }
+    uint16_t nCellX = (uint16_t)(nX - pCollect->nIndexX0) / pCollect->nIndexCellW;
+    uint16_t nCellY = (uint16_t)(nY - pCollect->nIndexY0) / pCollect->nIndexCellH;
+    if ((nCellX >= GSLC_COLLECT_INDEX_COLS) || (nCellY >= GSLC_COLLECT_INDEX_ROWS)) {
+      return NULL;
+    }
+    uint16_t nCell = nCellY * GSLC_COLLECT_INDEX_COLS + nCellX;
+    uint16_t nPos;
+    // Each cell lists its elements in decreasing Z-order
+    for (nPos=pCollect->anIndexCellStart[nCell];nPos<pCollect->anIndexCellStart[nCell+1];nPos++) {
+      nInd = (int16_t)pCollect->anIndexList[nPos];
+      pElemRef  = &(pCollect->asElemRef[nInd]);
+      if (!gslc_ElemGetVisible(pGui, pElemRef)) {
+        continue;
+      }
+      if (gslc_ElemOwnsCoord(pGui,pElemRef,nX,nY,true)) {
+        *pnElemInd = nInd;
+        return pElemRef;
+      }
+    }
+    return NULL;
+  }
+  #endif // GSLC_FEATURE_COLLECT_INDEX
+
   for (nInd=pCollect->nElemRefCnt-1;nInd>=0;nInd--) {
     pElemRef  = &(pCollect->asElemRef[nInd]);
 
@@ -5947,6 +8582,127 @@ gslc_tsElemRef* gslc_CollectFindElemFromCoord(gslc_tsGui* pGui,gslc_tsCollect* p
 }
 
 
+bool gslc_CollectSetIndex(gslc_tsGui* pGui,gslc_tsCollect* pCollect,uint16_t* anIndexList,uint16_t nIndexMax)
+{
+  if (pCollect == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "CollectSetIndex";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  #if (GSLC_FEATURE_COLLECT_INDEX)
+  (void)pGui; // Unused
+  pCollect->anIndexList   = anIndexList;
+  pCollect->nIndexListMax = (anIndexList == NULL)? 0 : nIndexMax;
+  pCollect->bIndexValid   = false;
+  pCollect->bIndexFull    = false;
+  return true;
+  #else
+  (void)pGui; // Unused
+  (void)anIndexList; // Unused
+  (void)nIndexMax; // Unused
+  GSLC_DEBUG2_PRINT("ERROR: CollectSetIndex() requires GSLC_FEATURE_COLLECT_INDEX=1%s\n","");
+  return false;
+  #endif // GSLC_FEATURE_COLLECT_INDEX
+}
+
+// Build a uniform grid over the bounds of the elements in a collection
+// - Each cell lists the indices of the elements that overlap it, in
+//   decreasing Z-order. An element that spans several cells is listed
+//   in each of them.
+// - Note that gslc_IsInRect() treats the element bounds as inclusive
+//   of (x+w,y+h), so the same extent is used here.
+bool gslc_CollectIndexBuild(gslc_tsGui* pGui,gslc_tsCollect* pCollect)
+{
+  #if !(GSLC_FEATURE_COLLECT_INDEX)
+  (void)pGui; // Unused
+  (void)pCollect; // Unused
+  return false;
+  #else
+  if (pCollect->anIndexList == NULL) {
+    return false;
+  }
+  // Reuse the existing index if no element has been added or moved
+  if ((pCollect->bIndexValid) && (pCollect->nIndexGen == pGui->nCollectIndexGen)) {
+    return !pCollect->bIndexFull;
+  }
+  pCollect->bIndexValid = true;
+  pCollect->bIndexFull  = false;
+  pCollect->nIndexGen   = pGui->nCollectIndexGen;
+
+  uint16_t      nCellCnt = GSLC_COLLECT_INDEX_COLS * GSLC_COLLECT_INDEX_ROWS;
+  uint16_t      nInd,nCell,nCellX,nCellY;
+  uint16_t      nCellX0,nCellY0,nCellX1,nCellY1;
+  uint16_t      nTotal = 0;
+  int16_t       nX0 = 0, nY0 = 0, nX1 = 0, nY1 = 0;
+  gslc_tsElem*  pElem = NULL;
+  gslc_tsRect   rElem;
+
+  // Determine the bounds of all elements
+  for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+    pElem = gslc_GetElemFromRef(pGui,&(pCollect->asElemRef[nInd]));
+    rElem = pElem->rElem;
+    if ((nInd == 0) || (rElem.x < nX0)) { nX0 = rElem.x; }
+    if ((nInd == 0) || (rElem.y < nY0)) { nY0 = rElem.y; }
+    if ((nInd == 0) || (rElem.x + (int16_t)rElem.w > nX1)) { nX1 = rElem.x + (int16_t)rElem.w; }
+    if ((nInd == 0) || (rElem.y + (int16_t)rElem.h > nY1)) { nY1 = rElem.y + (int16_t)rElem.h; }
+  }
+  pCollect->nIndexX0    = nX0;
+  pCollect->nIndexY0    = nY0;
+  pCollect->nIndexCellW = (uint16_t)(nX1 - nX0 + GSLC_COLLECT_INDEX_COLS) / GSLC_COLLECT_INDEX_COLS;
+  pCollect->nIndexCellH = (uint16_t)(nY1 - nY0 + GSLC_COLLECT_INDEX_ROWS) / GSLC_COLLECT_INDEX_ROWS;
+
+  // Count the number of elements overlapping each cell
+  for (nCell=0;nCell<=nCellCnt;nCell++) {
+    pCollect->anIndexCellStart[nCell] = 0;
+  }
+  for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+    pElem = gslc_GetElemFromRef(pGui,&(pCollect->asElemRef[nInd]));
+    rElem = pElem->rElem;
+    nCellX0 = (uint16_t)(rElem.x - nX0) / pCollect->nIndexCellW;
+    nCellY0 = (uint16_t)(rElem.y - nY0) / pCollect->nIndexCellH;
+    nCellX1 = (uint16_t)(rElem.x + (int16_t)rElem.w - nX0) / pCollect->nIndexCellW;
+    nCellY1 = (uint16_t)(rElem.y + (int16_t)rElem.h - nY0) / pCollect->nIndexCellH;
+    for (nCellY=nCellY0;nCellY<=nCellY1;nCellY++) {
+      for (nCellX=nCellX0;nCellX<=nCellX1;nCellX++) {
+        pCollect->anIndexCellStart[nCellY * GSLC_COLLECT_INDEX_COLS + nCellX]++;
+        nTotal++;
+      }
+    }
+  }
+  if (nTotal > pCollect->nIndexListMax) {
+    GSLC_DEBUG2_PRINT("ERROR: CollectIndexBuild() too many index entries (%u/%u)\n",
+            nTotal,pCollect->nIndexListMax);
+    pCollect->bIndexFull = true;
+    return false;
+  }
+
+  // Convert the counts into the end position of each cell
+  for (nCell=1;nCell<nCellCnt;nCell++) {
+    pCollect->anIndexCellStart[nCell] += pCollect->anIndexCellStart[nCell-1];
+  }
+  pCollect->anIndexCellStart[nCellCnt] = nTotal;
+
+  // Fill each cell from its end so that the entries are listed
+  // in decreasing Z-order and the end positions become the start
+  // positions of each cell
+  for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+    pElem = gslc_GetElemFromRef(pGui,&(pCollect->asElemRef[nInd]));
+    rElem = pElem->rElem;
+    nCellX0 = (uint16_t)(rElem.x - nX0) / pCollect->nIndexCellW;
+    nCellY0 = (uint16_t)(rElem.y - nY0) / pCollect->nIndexCellH;
+    nCellX1 = (uint16_t)(rElem.x + (int16_t)rElem.w - nX0) / pCollect->nIndexCellW;
+    nCellY1 = (uint16_t)(rElem.y + (int16_t)rElem.h - nY0) / pCollect->nIndexCellH;
+    for (nCellY=nCellY0;nCellY<=nCellY1;nCellY++) {
+      for (nCellX=nCellX0;nCellX<=nCellX1;nCellX++) {
+        nCell = nCellY * GSLC_COLLECT_INDEX_COLS + nCellX;
+        pCollect->anIndexList[--pCollect->anIndexCellStart[nCell]] = nInd;
+      }
+    }
+  }
+  return true;
+  #endif // GSLC_FEATURE_COLLECT_INDEX
+}
+
 #if (GSLC_FEATURE_COMPOUND)
 // Go through all elements in a collection and set the parent
 // element pointer.
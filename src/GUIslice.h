@@ -68,6 +68,232 @@ extern "C" {
   #define GSLC_FEATURE_FOCUS_ON_TOUCH 1
 #endif
 
+// Provide default for the maximum number of separate invalidation regions
+// - Each region is redrawn in its own clipped pass by gslc_PageRedrawGo()
+// - If more regions are added than can be tracked, the regions are
+//   collapsed into a single bounding region
+// - A value of 1 tracks a single bounding region only
+#if !defined(GSLC_INVALIDATE_RECT_MAX)
+  #define GSLC_INVALIDATE_RECT_MAX 4
+#endif
+
+// Provide default for clipped redraw of transparent elements
+// - When enabled, a transparent element that requires redraw causes
+//   only the invalidated region(s) to be redrawn: the background and
+//   all elements that overlap the region are redrawn, clipped to it
+// - When disabled, a transparent element that requires redraw forces
+//   a full page redraw
+#if !defined(GSLC_REDRAW_TRANSP_CLIP)
+  #define GSLC_REDRAW_TRANSP_CLIP 1
+#endif
+
+// Provide default for the padding applied to an element's invalidated region
+// - Some elements draw slightly beyond their rect (eg. the outer edge
+//   of a ring gauge). When an element is redrawn within a clipped
+//   region, the region is padded by this many pixels on each side so
+//   that such pixels are also updated.
+#if !defined(GSLC_INVALIDATE_PAD)
+  #define GSLC_INVALIDATE_PAD 1
+#endif
+
+// Provide default for the invalidation region merge threshold
+// - Two separate regions are merged into their bounding region if the
+//   area it adds (beyond the two regions) is no more than this
+//   percentage of the combined area of the regions
+// - Overlapping regions are always merged
+#if !defined(GSLC_INVALIDATE_MERGE_PCT)
+  #define GSLC_INVALIDATE_MERGE_PCT 25
+#endif
+
+// Provide default for the bitmap run buffer length (in pixels)
+// - Drivers that stream bitmaps in runs copy each run of pixels
+//   into a stack buffer of this size before pushing it to the
+//   display in a single transfer
+#if !defined(GSLC_BMP_ROW_BUF_LEN)
+  #define GSLC_BMP_ROW_BUF_LEN 32
+#endif
+
+// Provide default for the collection spatial index (see gslc_PageSetIndex)
+// - When enabled, a collection that has been assigned index storage
+//   divides the region covered by its elements into a grid of
+//   GSLC_COLLECT_INDEX_COLS x GSLC_COLLECT_INDEX_ROWS cells. Touch
+//   hit-testing then only examines the elements that overlap the
+//   touched cell.
+// - The index is rebuilt on demand after elements are added or moved
+#if !defined(GSLC_FEATURE_COLLECT_INDEX)
+  #define GSLC_FEATURE_COLLECT_INDEX 0
+#endif
+#if !defined(GSLC_COLLECT_INDEX_COLS)
+  #define GSLC_COLLECT_INDEX_COLS 4
+#endif
+#if !defined(GSLC_COLLECT_INDEX_ROWS)
+  #define GSLC_COLLECT_INDEX_ROWS 4
+#endif
+
+// Provide default for the runtime statistics (see gslc_GetStats)
+// - When enabled, gslc_Update() records the number of redraws,
+//   invalidated area, input events, tick time, elements redrawn
+//   and driver drawing calls
+// - When disabled, the counters are not stored in the GUI and
+//   all of the collection code is compiled out
+#if !defined(GSLC_STATS_EN)
+  #define GSLC_STATS_EN 0
+#endif
+
+// Provide default for the number of extended element types
+// tracked separately in the runtime statistics
+// - Extended types (GSLC_TYPEX_*) are counted by their offset from
+//   GSLC_TYPE_BASE_EXTEND. Any type beyond this range is counted
+//   in the last entry.
+#if !defined(GSLC_STATS_TYPEX_MAX)
+  #define GSLC_STATS_TYPEX_MAX 64
+#endif
+
+// Provide default for the band renderer
+// - When enabled (and supported by the driver, DRV_HAS_BAND), each
+//   redraw region is composed in horizontal bands of GSLC_BAND_H
+//   lines within a RAM buffer. Each band (background plus all of the
+//   overlapping elements) is pushed to the display in one transfer,
+//   which avoids flicker and per-primitive bus overhead.
+// - The band buffer occupies (display width x GSLC_BAND_H) pixels,
+//   eg. 320 x 8 x 2 bytes = 5KB for a 16-bit 320 pixel wide display
+#if !defined(GSLC_BAND_EN)
+  #define GSLC_BAND_EN 0
+#endif
+#if !defined(GSLC_BAND_H)
+  #define GSLC_BAND_H 8
+#endif
+
+// Provide default for the polar vertex cache (see gslc_PolarCacheToXY)
+// - When enabled, elements that draw rings and sectors (XRingGauge,
+//   XGlowball) keep a table of the sine and cosine values for each
+//   segment boundary, so that redraws no longer evaluate any
+//   trigonometry. Radial indicators (XRadial, XGauge) also retain
+//   the vertices of the last indicator drawn.
+// - The table holds up to GSLC_POLAR_CACHE_MAX segments per full
+//   revolution, occupying 4 bytes per segment in each element's
+//   extended data. Finer quality settings fall back to direct
+//   calculation.
+#if !defined(GSLC_POLAR_CACHE_EN)
+  #define GSLC_POLAR_CACHE_EN 0
+#endif
+#if !defined(GSLC_POLAR_CACHE_MAX)
+  #define GSLC_POLAR_CACHE_MAX 72
+#endif
+
+// Provide default for the input event queue (see gslc_InputQueuePush)
+// - Each gslc_Update() first collects the pending touch, keyboard
+//   and pin inputs into a queue of up to GSLC_INPUT_Q_MAX events,
+//   then handles the queued events. Consecutive touch moves are
+//   coalesced into a single queue entry.
+// - If GSLC_INPUT_Q_BUDGET_MS is non-zero, queued events are handled
+//   until the queue is empty or the time budget has been used
+//   (instead of handling at most GSLC_TOUCH_MAX_EVT events)
+// - GSLC_EVENT_PEND_MAX defines the number of element events that
+//   can be deferred to the next update (see gslc_ElemSendEventTouch)
+//   - Previously only a single event could be deferred, and sending
+//     a second event in the same update issued the first one
+//     immediately. With the default of 2, both events are now
+//     deferred and issued (in order) at the start of the next update.
+//   - Set GSLC_EVENT_PEND_MAX to 1 to restore the previous behavior
+#if !defined(GSLC_INPUT_Q_MAX)
+  #define GSLC_INPUT_Q_MAX 8
+#endif
+#if !defined(GSLC_INPUT_Q_BUDGET_MS)
+  #define GSLC_INPUT_Q_BUDGET_MS 0
+#endif
+#if !defined(GSLC_EVENT_PEND_MAX)
+  #define GSLC_EVENT_PEND_MAX 2
+#endif
+
+// Provide default for the tick scheduler (see gslc_ElemSetTickFuncInterval)
+// - When enabled, elements with a tick callback are registered in a
+//   timing wheel of GSLC_TICK_WHEEL_SLOTS slots, each covering
+//   GSLC_TICK_WHEEL_RES_MS. gslc_Update() only visits the slots that
+//   have come due, so elements without a tick callback are never
+//   visited and each callback can run at its own interval. Up to
+//   GSLC_TICK_SCHED_MAX elements can be registered. If more are
+//   added, every page is ticked on each update instead (as when
+//   disabled).
+// - When disabled, every element on every page is sent a tick on each
+//   gslc_Update() and the tick intervals are ignored
+// - When GSLC_TICK_STACK_ONLY is enabled, only the elements on pages
+//   in the page stack (base, current and overlay) receive ticks
+#if !defined(GSLC_FEATURE_TICK_SCHED)
+  #define GSLC_FEATURE_TICK_SCHED 0
+#endif
+#if !defined(GSLC_TICK_SCHED_MAX)
+  #define GSLC_TICK_SCHED_MAX 8
+#endif
+#if !defined(GSLC_TICK_WHEEL_SLOTS)
+  #define GSLC_TICK_WHEEL_SLOTS 16
+#endif
+#if !defined(GSLC_TICK_WHEEL_RES_MS)
+  #define GSLC_TICK_WHEEL_RES_MS 10
+#endif
+#if !defined(GSLC_TICK_STACK_ONLY)
+  #define GSLC_TICK_STACK_ONLY 0
+#endif
+
+// Provide default for the text extent cache (see gslc_TxtCacheGetSize)
+// - When enabled, the text extents reported by the driver are remembered
+//   in a small table of GSLC_TXT_CACHE_MAX entries, keyed by the font,
+//   the text flags and a hash of the string. Redrawing an unchanged
+//   text string then avoids another (often slow) driver measurement.
+// - When GSLC_TXT_MEMO_EN is enabled, each element added to a page also
+//   remembers the position of its text, so that a redraw of the element
+//   doesn't need to measure or align the text at all. The memo is
+//   discarded by the gslc_ElemSetTxt*(), gslc_ElemUpdateFont() and
+//   gslc_ElemSetRect() family of calls. The memo also records a hash
+//   of the string, so a text buffer that is modified in place (eg.
+//   GSLC_TXT_ALLOC_EXT) is measured again on its next redraw.
+#if !defined(GSLC_TXT_CACHE_EN)
+  #define GSLC_TXT_CACHE_EN 0
+#endif
+#if !defined(GSLC_TXT_CACHE_MAX)
+  #define GSLC_TXT_CACHE_MAX 8
+#endif
+#if !defined(GSLC_TXT_MEMO_EN)
+  #define GSLC_TXT_MEMO_EN 0
+#endif
+
+// Provide default for the page snapshot cache (see gslc_PageSetCacheEn)
+// - When enabled (and supported by the driver, DRV_HAS_PAGE_SNAP), the
+//   display of a page that has been marked for caching is retained in
+//   an off-screen snapshot when gslc_SetPageCur() selects another page.
+//   Returning to the page restores the snapshot and then only redraws
+//   the regions of the elements that changed while it was hidden
+//   (including those on the base page), rather than the whole page.
+// - Up to GSLC_PAGE_CACHE_MAX snapshots are retained, replacing the
+//   least recently used one first. If GSLC_PAGE_CACHE_BUDGET is
+//   non-zero, the snapshots (together with any popup save-under
+//   buffer) are further limited to that many bytes.
+// - Each snapshot holds a full display of pixels, eg.
+//   320 x 240 x 2 bytes = 150KB for a 16-bit display
+#if !defined(GSLC_PAGE_CACHE_EN)
+  #define GSLC_PAGE_CACHE_EN 0
+#endif
+#if !defined(GSLC_PAGE_CACHE_MAX)
+  #define GSLC_PAGE_CACHE_MAX 2
+#endif
+#if !defined(GSLC_PAGE_CACHE_BUDGET)
+  #define GSLC_PAGE_CACHE_BUDGET 0
+#endif
+
+// Provide default for the popup save-under buffer
+// - When enabled (and supported by the driver, DRV_HAS_PAGE_SNAP),
+//   gslc_PopupShow() saves the region of the display beneath the
+//   popup's bounds. gslc_PopupHide() then restores it and only
+//   redraws the elements beneath it that changed while the popup was
+//   shown, rather than the whole region of the base and current pages.
+// - The buffer is allocated in the same way as a page snapshot, but
+//   only holds the region beneath the popup. It counts towards
+//   GSLC_PAGE_CACHE_BUDGET, and isn't taken if it doesn't fit
+//   alongside the page snapshots already held.
+#if !defined(GSLC_POPUP_SAVE_EN)
+  #define GSLC_POPUP_SAVE_EN 0
+#endif
+
 // Ensure that touch/input drivers have not been disabled if FEATURE_INPUT has been requested
 // - Either use DRV_TOUCH_INPUT if no touch-screen is used (but external pins are being used)
 // - Or select a DRV_TOUCH_* driver specific to the touch-screen device
@@ -94,6 +320,8 @@ extern GSLC_CB_DEBUG_OUT g_pfDebugOut;
 // -----------------------------------------------------------------------
 #define GSLC_2PI  6.28318530718
 
+#define GSLC_FILL_POLY_PT_MAX  8  ///< Maximum number of vertices in gslc_DrawFillPoly()
+
 // -----------------------------------------------------------------------
 // Enumerations
 // -----------------------------------------------------------------------
@@ -507,6 +735,13 @@ typedef enum {
   GSLC_TXT_DEFAULT        = GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_NONE | GSLC_TXT_ENC_PLAIN,
 } gslc_teTxtFlags;
 
+/// Result of testing a region against the clipping region
+typedef enum {
+  GSLC_CLIP_OUT,          ///< Region is entirely outside of the clipping region
+  GSLC_CLIP_PART,         ///< Region is partially inside of the clipping region
+  GSLC_CLIP_IN,           ///< Region is entirely inside of the clipping region
+} gslc_teClipRes;
+
 
 // -----------------------------------------------------------------------
 // Forward declarations
@@ -539,6 +774,13 @@ typedef bool (*GSLC_CB_PIN_POLL)(void* pvGui,int16_t* pnPinInd,int16_t* pnPinVal
 /// Callback function for element input ready
 typedef bool (*GSLC_CB_INPUT)(void* pvGui,void* pvElemRef,int16_t nStatus,void* pvData);
 
+/// Callback function for reading from a BMP image stream
+/// - Returns the number of bytes read
+typedef uint16_t (*GSLC_CB_BMP_READ)(void* pvStream,uint8_t* pBuf,uint16_t nLen);
+
+/// Callback function for seeking to an absolute position in a BMP image stream
+typedef bool (*GSLC_CB_BMP_SEEK)(void* pvStream,uint32_t nPos);
+
 // -----------------------------------------------------------------------
 // Structures
 // -----------------------------------------------------------------------
@@ -559,6 +801,47 @@ typedef struct gslc_tsPt {
   int16_t   y;        ///< Y coordinate
 } gslc_tsPt;
 
+/// Polygon edge state for the scanline filler (gslc_DrawFillPoly)
+/// - The X coordinate is tracked incrementally as an integer part
+///   plus a fraction (in units of 1/nDY)
+typedef struct gslc_tsPolyEdge {
+  int16_t   nY0;      ///< First row covered by the edge
+  int16_t   nY1;      ///< Row following the last row covered by the edge
+  int16_t   nDY;      ///< Edge height
+  int16_t   nX;       ///< X coordinate at the current row (integer part)
+  int16_t   nErr;     ///< X coordinate at the current row (fraction)
+  int16_t   nStep;    ///< X increment per row (integer part)
+  int16_t   nRem;     ///< X increment per row (fraction)
+  uint8_t   nTri;     ///< Index of the triangle that owns the edge
+  bool      bTieUp;   ///< Round crossings exactly between pixels up (else down)
+} gslc_tsPolyEdge;
+
+/// Cached unit vectors at each segment boundary of a circle
+/// - Filled in by gslc_PolarCacheSetStep() and used by gslc_PolarCacheToXY()
+/// - Entry i holds the vector for the angle (i * nStep64)
+typedef struct gslc_tsPolarCache {
+  int16_t   nStep64;  ///< Angular step between entries (degrees*64), 0 if not set
+  uint16_t  nNumPts;  ///< Number of valid entries (0 if the step can't be cached)
+#if (GSLC_POLAR_CACHE_EN)
+  int16_t   anSin[GSLC_POLAR_CACHE_MAX+1];  ///< Sine at each entry (as returned by gslc_sinFX)
+  int16_t   anCos[GSLC_POLAR_CACHE_MAX+1];  ///< Cosine at each entry (as returned by gslc_cosFX)
+#endif // GSLC_POLAR_CACHE_EN
+} gslc_tsPolarCache;
+
+/// Cached vertices of a radial gauge indicator (pointer)
+/// - Offsets are relative to the pivot of the indicator
+/// - Filled in by gslc_PolarIndicCalc()
+typedef struct gslc_tsPolarIndic {
+  bool      bValid;   ///< Vertices have been calculated
+  int16_t   n64Ang;   ///< Indicator angle (degrees*64)
+  uint16_t  nLen;     ///< Indicator length
+  uint16_t  nTip;     ///< Size of tip at end of indicator
+  gslc_tsPt sTip;     ///< Offset to the tip
+  gslc_tsPt sTipBase; ///< Offset to the base of the tip (along the indicator)
+  gslc_tsPt sBase1;   ///< Offset to the first corner of the base
+  gslc_tsPt sBase2;   ///< Offset to the second corner of the base
+} gslc_tsPolarIndic;
+
 /// Color structure. Defines RGB triplet.
 typedef struct gslc_tsColor {
   uint8_t r;      ///< RGB red value
@@ -602,6 +885,17 @@ typedef struct gslc_tsEventTouch {
   int16_t           nY;               ///< Touch Y coordinate (or param2)
 } gslc_tsEventTouch;
 
+/// Raw input event held in the input event queue
+typedef struct gslc_tsInputEvt {
+  uint32_t              nTime;        ///< Timestamp when queued (in ms, see gslc_GetTimeMs)
+  gslc_teInputRawEvent  eInputEvent;  ///< Input event type
+  int16_t               nInputVal;    ///< Additional data for event type (eg. key or pin)
+  int16_t               nX;           ///< Touch X coordinate
+  int16_t               nY;           ///< Touch Y coordinate
+  uint16_t              nPress;       ///< Touch pressure (0=none)
+  bool                  bMove;        ///< Touch with the previous touch also pressed (can be coalesced)
+} gslc_tsInputEvt;
+
 /// Font reference structure
 typedef struct {
   int16_t               nId;            ///< Font ID specified by user
@@ -611,6 +905,49 @@ typedef struct {
   uint16_t              nSize;          ///< Font size
 } gslc_tsFont;
 
+/// Cached text extent, as reported by gslc_DrvGetTxtSize()
+/// - Entries are looked up by gslc_TxtCacheGetSize()
+typedef struct gslc_tsTxtCacheEntry {
+  gslc_tsFont*      pFont;        ///< Font used to measure the text (NULL if entry unused)
+  uint32_t          nHash;        ///< Hash of the text string
+  uint16_t          nLen;         ///< Length of the text string
+  gslc_teTxtFlags   eTxtFlags;    ///< Text flags (memory and encoding)
+  int16_t           nTxtOffsetX;  ///< Offset of the text from its bounds (X)
+  int16_t           nTxtOffsetY;  ///< Offset of the text from its bounds (Y)
+  uint16_t          nTxtSzW;      ///< Width of the text
+  uint16_t          nTxtSzH;      ///< Height of the text
+} gslc_tsTxtCacheEntry;
+
+/// Remembered text position of an element
+/// - Recorded by gslc_ElemDrawByRef() for elements added to a page
+/// - The memo is only used if it was recorded for the same text region,
+///   string and text generation (see gslc_TxtCacheReset)
+typedef struct gslc_tsTxtMemo {
+  bool              bEn;          ///< Element owns its text (memo can be used)
+  uint8_t           nGen;         ///< Text generation at time of memo (0 if invalid)
+  gslc_tsRect       rTxt;         ///< Text region that the memo was recorded for
+  uint32_t          nHash;        ///< Hash of the string that the memo was recorded for
+  uint16_t          nLen;         ///< Length of the string that the memo was recorded for
+  gslc_tsRect       rTxtBox;      ///< Bounds of the aligned text
+  int16_t           nTxtOffsetX;  ///< Offset of the text from its bounds (X)
+  int16_t           nTxtOffsetY;  ///< Offset of the text from its bounds (Y)
+} gslc_tsTxtMemo;
+
+/// Retained snapshot of the display showing a page
+/// - Managed by gslc_SetPageCur() (see gslc_PageSetCacheEn)
+/// - Also used for the popup save-under buffer, in which case
+///   nPageId is the popup and nPageBaseId the current page
+typedef struct gslc_tsPageCache {
+  int16_t           nPageId;      ///< Page shown in the snapshot (GSLC_PAGE_NONE if entry unused)
+  int16_t           nPageBaseId;  ///< Base page shown beneath it (or GSLC_PAGE_NONE)
+  void*             pvSnap;       ///< Snapshot storage allocated by the driver (or NULL)
+  uint32_t          nSnapSize;    ///< Size of the snapshot storage in bytes (counted against GSLC_PAGE_CACHE_BUDGET)
+  gslc_tsRect       rSnap;        ///< Region of the display held in the snapshot
+  uint32_t          nLastUse;     ///< Cache tick at last save or restore (for LRU replacement)
+  gslc_tsRect       asStale[GSLC_INVALIDATE_RECT_MAX]; ///< Regions changed since the snapshot was taken
+  uint8_t           nStaleCnt;    ///< Number of regions in asStale[]
+} gslc_tsPageCache;
+
 
 /// Image reference structure
 typedef struct {
@@ -621,6 +958,28 @@ typedef struct {
 } gslc_tsImgRef;
 
 
+/// BMP image stream reader
+/// - Provides access to the BMP file (eg. on SD card or file system)
+///   independent of the storage library
+typedef struct {
+  void*                 pvStream;   ///< Void ptr to the stream handle (type defined by reader)
+  GSLC_CB_BMP_READ      pfuncRead;  ///< Callback to read bytes from the stream
+  GSLC_CB_BMP_SEEK      pfuncSeek;  ///< Callback to seek within the stream
+} gslc_tsBmpReader;
+
+/// BMP image header information
+typedef struct {
+  int16_t               nWidth;     ///< Image width (pixels)
+  int16_t               nHeight;    ///< Image height (pixels)
+  uint8_t               nDepth;     ///< Bits per pixel (16,24,32)
+  bool                  bTopDown;   ///< Rows are stored top-to-bottom
+  uint32_t              nDataOfs;   ///< File offset of pixel data
+  uint32_t              nRowSize;   ///< Size of each row in bytes (including padding)
+  uint8_t               anShift[3]; ///< Bit position of R,G,B fields (16/32-bit)
+  uint8_t               anBits[3];  ///< Bit width of R,G,B fields (16/32-bit)
+} gslc_tsBmpInfo;
+
+
 /// Element reference structure
 typedef struct {
   gslc_tsElem*          pElem;      ///< Pointer to element in memory [RAM,FLASH]
@@ -691,6 +1050,10 @@ typedef struct gslc_tsElem {
   GSLC_CB_DRAW        pfuncXDraw;       ///< Callback func ptr for custom drawing
   GSLC_CB_TOUCH       pfuncXTouch;      ///< Callback func ptr for touch
   GSLC_CB_TICK        pfuncXTick;       ///< Callback func ptr for timer/main loop tick
+
+#if (GSLC_TXT_MEMO_EN)
+  gslc_tsTxtMemo      sTxtMemo;         ///< Remembered text position
+#endif // GSLC_TXT_MEMO_EN
 } gslc_tsElem;
 
 
@@ -716,6 +1079,24 @@ typedef struct {
   gslc_tsElemRef*       pElemRefTracked;  ///< Element reference currently being touch-tracked (NULL for none)
   int16_t               nElemIndTracked;  ///< Element index currently being touch-tracked (GSLC_IND_NONE for none)
 
+  // Redraw tracking
+  uint16_t              nElemRefRedrawCnt; ///< Number of element references with a pending redraw
+  bool                  bRedrawCntEn;     ///< Redraw count is maintained (only for page collections)
+
+  #if (GSLC_FEATURE_COLLECT_INDEX)
+  // Spatial index for touch hit-testing
+  uint16_t*             anIndexList;      ///< Element reference indices for each grid cell (NULL if no index)
+  uint16_t              nIndexListMax;    ///< Maximum number of entries in anIndexList
+  uint16_t              anIndexCellStart[GSLC_COLLECT_INDEX_COLS*GSLC_COLLECT_INDEX_ROWS+1]; ///< Start of each cell in anIndexList
+  int16_t               nIndexX0;         ///< Left edge of region covered by the grid
+  int16_t               nIndexY0;         ///< Top edge of region covered by the grid
+  uint16_t              nIndexCellW;      ///< Width of each grid cell
+  uint16_t              nIndexCellH;      ///< Height of each grid cell
+  uint16_t              nIndexGen;        ///< Element geometry generation that the index was built from
+  bool                  bIndexValid;      ///< Index is current (needs rebuild if false)
+  bool                  bIndexFull;       ///< Index storage was too small (fall back to search)
+  #endif // GSLC_FEATURE_COLLECT_INDEX
+
   // Callback functions
   //GSLC_CB_EVENT         pfuncXEvent;      ///< UNUSED: Callback func ptr for events
 
@@ -740,9 +1121,45 @@ typedef struct {
   // Bounding region
   gslc_tsRect         rBounds;              ///< Bounding rect for page elements
 
+  #if (GSLC_PAGE_CACHE_EN)
+  bool                bCacheEn;             ///< Retain a snapshot of the page when hidden
+  #endif
+
 } gslc_tsPage;
 
 
+#if (GSLC_FEATURE_TICK_SCHED)
+/// Tick scheduler list identifiers
+/// - Lists 0..GSLC_TICK_WHEEL_SLOTS-1 are the timing wheel slots
+#define GSLC_TICK_LIST_NONE   -1                          ///< Entry is not in any list
+#define GSLC_TICK_LIST_EVERY  (GSLC_TICK_WHEEL_SLOTS)     ///< Entries ticked on every update
+#define GSLC_TICK_LIST_DONE   (GSLC_TICK_WHEEL_SLOTS+1)   ///< Entries already visited in this update
+#define GSLC_TICK_LIST_NEW    (GSLC_TICK_WHEEL_SLOTS+2)   ///< Entries added by a tick callback
+#define GSLC_TICK_LIST__MAX   (GSLC_TICK_WHEEL_SLOTS+3)
+
+/// Tick scheduler entry for an element with a tick callback
+typedef struct gslc_tsTickEntry {
+  gslc_tsElemRef*   pElemRef;   ///< Element reference (or NULL if entry is free)
+  gslc_tsPage*      pPage;      ///< Page containing the element
+  uint32_t          nInterval;  ///< Tick interval (ms), 0 to tick on every update
+  uint32_t          nDue;       ///< Time (ms) of next tick
+  int8_t            nPrev;      ///< Previous entry in list (or -1)
+  int8_t            nNext;      ///< Next entry in list (or -1)
+  int8_t            nList;      ///< List containing entry (GSLC_TICK_LIST_*)
+} gslc_tsTickEntry;
+
+/// Tick scheduler (timing wheel)
+typedef struct gslc_tsTickSched {
+  gslc_tsTickEntry  asEntry[GSLC_TICK_SCHED_MAX]; ///< Registered elements
+  int8_t            anHead[GSLC_TICK_LIST__MAX];  ///< First entry of each list (or -1)
+  int8_t            anTail[GSLC_TICK_LIST__MAX];  ///< Last entry of each list (or -1)
+  uint32_t          nTimeLast;  ///< Time (ms) up to which the wheel has been visited
+  bool              bBusy;      ///< Tick callbacks are being called
+  bool              bOverflow;  ///< An element couldn't be registered, so all pages are ticked
+} gslc_tsTickSched;
+#endif // GSLC_FEATURE_TICK_SCHED
+
+
 /// Input mapping
 /// - Describes mapping from keyboard or GPIO input
 ///   to a GUI action (such as changing the current
@@ -757,6 +1174,47 @@ typedef struct {
 } gslc_tsInputMap;
 
 
+/// Driver drawing calls tracked in the runtime statistics
+typedef enum {
+  GSLC_STATS_DRV_POINT = 0,         ///< gslc_DrvDrawPoint()
+  GSLC_STATS_DRV_POINTS,            ///< gslc_DrvDrawPoints()
+  GSLC_STATS_DRV_LINE,              ///< gslc_DrvDrawLine()
+  GSLC_STATS_DRV_RECT_FRAME,        ///< gslc_DrvDrawFrameRect() / gslc_DrvDrawFrameRoundRect()
+  GSLC_STATS_DRV_RECT_FILL,         ///< gslc_DrvDrawFillRect() / gslc_DrvDrawFillRoundRect()
+  GSLC_STATS_DRV_CIRCLE,            ///< gslc_DrvDrawFrameCircle() / gslc_DrvDrawFillCircle()
+  GSLC_STATS_DRV_TRI,               ///< gslc_DrvDrawFrameTriangle() / gslc_DrvDrawFillTriangle()
+  GSLC_STATS_DRV_TXT,               ///< gslc_DrvDrawTxt() / gslc_DrvDrawTxtAlign()
+  GSLC_STATS_DRV_IMAGE,             ///< gslc_DrvDrawImage()
+  GSLC_STATS_DRV_ROW,               ///< gslc_DrvDrawRow()
+  GSLC_STATS_DRV_BKGND,             ///< gslc_DrvDrawBkgnd()
+  GSLC_STATS_DRV_BAND,              ///< gslc_DrvBandFlush()
+  GSLC_STATS_DRV_COPY,              ///< gslc_DrvCopyRect()
+  GSLC_STATS_DRV__MAX               ///< Number of driver call types
+} gslc_teStatsDrv;
+
+/// Runtime statistics
+/// - Collected by gslc_Update() when GSLC_STATS_EN=1
+/// - Counters accumulate until gslc_ResetStats() is called
+/// - Times are measured in microseconds (or 0 if the platform
+///   does not provide a timer)
+typedef struct {
+  uint32_t  nUpdateCnt;                 ///< Number of calls to gslc_Update()
+  uint32_t  nRedrawFull;                ///< Number of full page redraws
+  uint32_t  nRedrawPartial;             ///< Number of partial redraws (changed elements or invalidated regions)
+  uint32_t  nRedrawPass;                ///< Number of clipped redraw passes
+  uint32_t  nInvalidateArea;            ///< Area (pixels) of the regions redrawn
+  uint16_t  nTouchEvtLast;              ///< Input events handled in the last gslc_Update()
+  uint16_t  nTouchEvtMax;               ///< Maximum input events handled in a gslc_Update()
+  uint32_t  nTouchEvtTotal;             ///< Total input events handled
+  uint32_t  nTickUsLast;                ///< Time spent in tick callbacks in the last gslc_Update()
+  uint32_t  nTickUsMax;                 ///< Maximum time spent in tick callbacks in a gslc_Update()
+  uint32_t  nTickUsTotal;               ///< Total time spent in tick callbacks
+  uint32_t  anElemRedraw[GSLC_TYPE_LINE+1]; ///< Elements redrawn by core type (GSLC_TYPE_*)
+  uint32_t  anElemRedrawX[GSLC_STATS_TYPEX_MAX]; ///< Elements redrawn by extended type (GSLC_TYPEX_*)
+  uint32_t  anDrvCall[GSLC_STATS_DRV__MAX]; ///< Driver drawing calls by type
+} gslc_tsStats;
+
+
 /// GUI structure
 /// - Contains all GUI state and content
 /// - Maintains list of one or more pages
@@ -819,9 +1277,20 @@ typedef struct {
                                         ///< page redraw command.
 
   // Pending events
-  bool                bEventPending;    ///< Is there an event pending?
-  gslc_tsEventTouch   sEventTouchPend;  ///< A touch event that has been deferred (if bEventPending=true)
-  gslc_tsEvent        sEventPend;       ///< An event that has been deferred (if bEventPending=true)
+  gslc_tsEventTouch   asEventTouchPend[GSLC_EVENT_PEND_MAX]; ///< Touch data for the deferred events
+  gslc_tsEvent        asEventPend[GSLC_EVENT_PEND_MAX];      ///< Ring buffer of deferred events
+  uint8_t             nEventPendHead;   ///< Index of oldest deferred event
+  uint8_t             nEventPendCnt;    ///< Number of deferred events
+
+  // Input event queue
+  gslc_tsInputEvt     asInputQ[GSLC_INPUT_Q_MAX]; ///< Ring buffer of queued input events
+  uint8_t             nInputQHead;      ///< Index of oldest queued input event
+  uint8_t             nInputQCnt;       ///< Number of queued input events
+  uint8_t             nInputQCntMax;    ///< Maximum queue depth observed
+  uint16_t            nInputQTouchPress;///< Pressure of the last touch queued
+  uint32_t            nInputQDropCnt;   ///< Number of input events dropped (queue full)
+  uint32_t            nInputQMergeCnt;  ///< Number of touch moves coalesced
+  uint32_t            nInputQLatency;   ///< Time in queue of the last event handled (ms)
 
   // Primary surface definitions
   gslc_tsImgRef       sImgRefBkgnd;     ///< Image reference for background
@@ -834,6 +1303,7 @@ typedef struct {
   gslc_tsPage*        asPage;           ///< Array of all pages defined in system
   uint8_t             nPageMax;         ///< Maximum number of pages that can be defined
   uint8_t             nPageCnt;         ///< Current number of pages defined
+  uint8_t             nPageIndRefLast;  ///< Index of the page last found by gslc_PageFindByElemRef()
 
   gslc_tsPage*        apPageStack[GSLC_STACK__MAX];       ///< Stack of pages
   bool                abPageStackActive[GSLC_STACK__MAX]; ///< Whether page in stack can receive touch events
@@ -841,11 +1311,15 @@ typedef struct {
 
   // Redraw of screen (ie. across page stack)
   bool                bScreenNeedRedraw; ///< Screen requires a redraw
+  bool                bScreenNeedRedrawRgn; ///< Invalidated regions require a redraw (background and overlapping elements)
   bool                bScreenNeedFlip;   ///< Screen requires a page flip
 
   // Current clip region
   bool                bInvalidateEn;     ///< A region of the display has been invalidated
-  gslc_tsRect         rInvalidateRect;   ///< The rect region that has been invalidated
+  gslc_tsRect         rInvalidateRect;   ///< The rect region that has been invalidated (bounds of all regions)
+  gslc_tsRect         asInvalidateRect[GSLC_INVALIDATE_RECT_MAX]; ///< Non-overlapping invalidated rect regions
+  uint8_t             nInvalidateRectCnt; ///< Number of regions in asInvalidateRect[]
+  int8_t              nInvalidateRectCur; ///< Region currently being redrawn (or -1 if all)
 
   // Callback functions
   //GSLC_CB_EVENT       pfuncXEvent;      ///< UNUSED: Callback func ptr for events
@@ -874,6 +1348,35 @@ typedef struct {
   int16_t             nFocusSavedElemInd; ///< Focus element index saved prior to popup/overlay
   #endif // GSLC_FEATURE_INPUT
 
+  #if (GSLC_FEATURE_COLLECT_INDEX)
+  uint16_t            nCollectIndexGen; ///< Element geometry generation (incremented when an element moves)
+  #endif // GSLC_FEATURE_COLLECT_INDEX
+
+  #if (GSLC_FEATURE_TICK_SCHED)
+  gslc_tsTickSched    sTickSched;       ///< Scheduler for element tick callbacks
+  #endif // GSLC_FEATURE_TICK_SCHED
+
+  #if (GSLC_TXT_CACHE_EN) || (GSLC_TXT_MEMO_EN)
+  uint8_t             nTxtGen;          ///< Text generation (incremented when fonts change)
+  #endif
+  #if (GSLC_TXT_CACHE_EN)
+  gslc_tsTxtCacheEntry asTxtCache[GSLC_TXT_CACHE_MAX]; ///< Text extent cache
+  uint8_t             nTxtCacheNext;    ///< Next text extent cache entry to replace
+  #endif // GSLC_TXT_CACHE_EN
+
+  #if (GSLC_PAGE_CACHE_EN)
+  gslc_tsPageCache    asPageCache[GSLC_PAGE_CACHE_MAX]; ///< Page snapshot cache
+  uint32_t            nPageCacheTick;   ///< Monotonic tick used for LRU ordering
+  #endif // GSLC_PAGE_CACHE_EN
+
+  #if (GSLC_POPUP_SAVE_EN)
+  gslc_tsPageCache    sPopupSave;       ///< Save-under buffer of the popup
+  #endif // GSLC_POPUP_SAVE_EN
+
+  #if (GSLC_STATS_EN)
+  gslc_tsStats        sStats;           ///< Runtime statistics
+  #endif // GSLC_STATS_EN
+
 } gslc_tsGui;
 
 
@@ -1102,6 +1605,16 @@ bool gslc_SetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect);
 ///
 bool gslc_IsInRect(int16_t nSelX,int16_t nSelY,gslc_tsRect rRect);
 
+///
+/// Determine if two rectangular regions overlap
+///
+/// \param[in]  rRect1:      First rectangular region
+/// \param[in]  rRect2:      Second rectangular region
+///
+/// \return true if the regions share at least one pixel, false otherwise
+///
+bool gslc_IsRectOverlap(gslc_tsRect rRect1,gslc_tsRect rRect2);
+
 
 ///
 /// Expand or contract a rectangle in width and/or height (equal
@@ -1144,6 +1657,21 @@ bool gslc_IsInWH(int16_t nSelX,int16_t nSelY,uint16_t nWidth,uint16_t nHeight);
 ///
 void gslc_UnionRect(gslc_tsRect* pRect, gslc_tsRect rAddRect);
 
+///
+/// Add a rect to a list of non-overlapping rect regions
+/// - The added rect is merged with any region in the list that it
+///   overlaps or that is close enough (see GSLC_INVALIDATE_MERGE_PCT)
+/// - If the list is full, all regions collapse into their bounds
+///
+/// \param[in]  asRect:    Array of rect regions
+/// \param[in]  pnRectCnt: Ptr to number of regions in the array (updated)
+/// \param[in]  nRectMax:  Maximum number of regions in the array
+/// \param[in]  rAddRect:  Rectangle to add to the list
+///
+/// \return true if the list was full and collapsed into one region
+///
+bool gslc_RectListAdd(gslc_tsRect* asRect,uint8_t* pnRectCnt,uint8_t nRectMax,gslc_tsRect rAddRect);
+
 ///
 /// Reset the invalidation region
 ///
@@ -1175,6 +1703,10 @@ void gslc_InvalidateRgnScreen(gslc_tsGui* pGui);
 ///
 /// Add a rectangular region to the invalidation region
 /// - This is usually called when an element has been modified
+/// - Up to GSLC_INVALIDATE_RECT_MAX separate regions are tracked.
+///   The added region is merged with any region that it overlaps
+///   or that is close enough (see GSLC_INVALIDATE_MERGE_PCT).
+///   If the list is full, all regions collapse into their bounds.
 ///
 /// \param[in]  pGui:     Pointer to GUI
 /// \param[in]  rAddRect: Rectangle to add to the invalidation region
@@ -1183,6 +1715,46 @@ void gslc_InvalidateRgnScreen(gslc_tsGui* pGui);
 ///
 void gslc_InvalidateRgnAdd(gslc_tsGui* pGui, gslc_tsRect rAddRect);
 
+///
+/// Pad an element's rectangular region in the same way as
+/// gslc_InvalidateRgnElem()
+///
+/// \param[in]  pGui:     Pointer to GUI
+/// \param[in]  rElem:    Element rectangle
+///
+/// \return Padded rectangle
+///
+gslc_tsRect gslc_InvalidateRgnPad(gslc_tsGui* pGui, gslc_tsRect rElem);
+
+///
+/// Add an element's rectangular region to the invalidation region
+/// - The region is padded by GSLC_INVALIDATE_PAD pixels (limited to
+///   the display) to cover any drawing just beyond the element's rect
+///
+/// \param[in]  pGui:     Pointer to GUI
+/// \param[in]  rElem:    Element rectangle to add to the invalidation region
+///
+/// \return none
+///
+void gslc_InvalidateRgnElem(gslc_tsGui* pGui, gslc_tsRect rElem);
+
+///
+/// Determine if a rect region needs to be drawn in the current redraw pass
+/// - When gslc_PageRedrawGo() redraws the invalidated regions one
+///   at a time, this is used to skip elements that lie outside
+///   the region being redrawn
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangle to test (eg. element region)
+/// \param[in]  bRedrawPend: Rectangle belongs to something with a pending
+///                          redraw. If it lies outside all regions, it is
+///                          passed in the final region so that its redraw
+///                          state can still be cleared.
+///
+/// \return true if the region should be drawn, false otherwise
+///
+bool gslc_InvalidateRgnTest(gslc_tsGui* pGui, gslc_tsRect rRect, bool bRedrawPend);
+
 ///
 /// Perform basic clipping of a single point to a clipping region
 ///
@@ -1220,6 +1792,19 @@ bool gslc_ClipLine(gslc_tsRect* pClipRect,int16_t* pnX0,int16_t* pnY0,int16_t* p
 ///
 bool gslc_ClipRect(gslc_tsRect* pClipRect,gslc_tsRect* pRect);
 
+///
+/// Determine how a rectangle is positioned relative to a clipping region
+/// - This is typically used by drivers to decide whether an accelerated
+///   (unclipped) drawing API can be used for a shape's bounding box
+///
+/// \param[in]  pClipRect:   Pointer to clipping region
+/// \param[in]  rRect:       Rectangle to test
+///
+/// \return GSLC_CLIP_OUT if not visible, GSLC_CLIP_IN if entirely
+///         visible or GSLC_CLIP_PART if only partially visible
+///
+gslc_teClipRes gslc_ClipRectTest(gslc_tsRect* pClipRect,gslc_tsRect rRect);
+
 
 ///
 /// Create an image reference to a bitmap file in LINUX filesystem
@@ -1279,6 +1864,62 @@ gslc_tsImgRef gslc_GetImageFromProg(const unsigned char* pImgBuf,gslc_teImgRefFl
 ///
 void gslc_PolarToXY(uint16_t nRad,int16_t n64Ang,int16_t* nDX,int16_t* nDY);
 
+///
+/// Reset a polar vertex cache
+/// - Forces the table to be recalculated on the next use
+///
+/// \param[in]  pCache:      Pointer to polar cache
+///
+/// \return none
+///
+void gslc_PolarCacheReset(gslc_tsPolarCache* pCache);
+
+///
+/// Prepare a polar vertex cache for an angular step
+/// - The table is only recalculated if the step differs from
+///   the one currently cached
+/// - Steps that don't evenly divide a full revolution, or that
+///   would need more than GSLC_POLAR_CACHE_MAX entries, leave
+///   the table empty so that gslc_PolarCacheToXY() calculates
+///   each vertex directly
+///
+/// \param[in]  pCache:      Pointer to polar cache
+/// \param[in]  nStep64:     Angular step between segments (in units of 1/64 degrees)
+///
+/// \return none
+///
+void gslc_PolarCacheSetStep(gslc_tsPolarCache* pCache,int16_t nStep64);
+
+///
+/// Convert polar coordinate to cartesian, using a polar vertex cache
+/// - Produces the same result as gslc_PolarToXY()
+/// - Angles that fall on a cached segment boundary are looked up in
+///   the table; any other angle is calculated directly
+///
+/// \param[in]   pCache       Pointer to polar cache (or NULL to always calculate)
+/// \param[in]   nRad         Radius of ray
+/// \param[in]   n64Ang       Angle of ray (in units of 1/64 degrees, 0 is up)
+/// \param[out]  nDX          X offset for ray end
+/// \param[out]  nDY          Y offset for ray end
+///
+/// \return none
+///
+void gslc_PolarCacheToXY(gslc_tsPolarCache* pCache,uint16_t nRad,int16_t n64Ang,int16_t* nDX,int16_t* nDY);
+
+///
+/// Calculate the vertices of a radial gauge indicator
+/// - When GSLC_POLAR_CACHE_EN is enabled, the vertices are only
+///   recalculated if the angle or dimensions have changed
+///
+/// \param[in]  pIndic:      Pointer to indicator vertex storage
+/// \param[in]  nLen:        Indicator length
+/// \param[in]  nTip:        Size of tip at end of indicator
+/// \param[in]  n64Ang:      Indicator angle (in units of 1/64 degrees, 0 is up)
+///
+/// \return none
+///
+void gslc_PolarIndicCalc(gslc_tsPolarIndic* pIndic,uint16_t nLen,uint16_t nTip,int16_t n64Ang);
+
 
 ///
 /// Calculate fixed-point sine function from fractional degrees
@@ -1467,6 +2108,22 @@ void gslc_DrawFrameRoundRect(gslc_tsGui* pGui, gslc_tsRect rRect, int16_t nRadiu
 ///
 void gslc_DrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 
+///
+/// Copy a rectangular region of the display to another position
+/// - Useful for scrolling content that has already been rendered
+/// - The destination is limited to the current clipping region
+/// - Only supported on drivers that define DRV_HAS_COPY_RECT.
+///   Otherwise the caller must redraw the region instead.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rSrc:        Region to copy (must be within the display)
+/// \param[in]  nDstX:       Destination X coordinate (top-left)
+/// \param[in]  nDstY:       Destination Y coordinate (top-left)
+///
+/// \return true if the region was copied, false if not supported
+///
+bool gslc_DrawCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY);
+
 ///
 /// Draw a filled rounded rectangle
 ///
@@ -1567,6 +2224,38 @@ void gslc_DrawFrameQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol);
 ///
 void gslc_DrawFillQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol);
 
+///
+/// Draw a filled convex polygon
+/// - The polygon is filled as a fan of triangles (P0,P1,P2),
+///   (P2,P0,P3), ... with the same pixel coverage as filling each
+///   triangle with gslc_DrawFillTriangle() (when emulated)
+/// - Each row is filled with horizontal spans, with the edges
+///   walked incrementally from row to row
+/// - The bottom-most row of each triangle is not filled
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  psPt:        Pointer to array of points (in order around the polygon)
+/// \param[in]  nNumPt:      Number of points (3..GSLC_FILL_POLY_PT_MAX)
+/// \param[in]  nCol:        Color RGB value for the fill
+///
+/// \return none
+///
+void gslc_DrawFillPoly(gslc_tsGui* pGui,gslc_tsPt* psPt,uint8_t nNumPt,gslc_tsColor nCol);
+
+///
+/// Add a triangle edge to the edge table of gslc_DrawFillPoly()
+///
+/// \param[out] pEdge:       Pointer to edge to initialize
+/// \param[in]  sPtA:        Upper endpoint of edge
+/// \param[in]  sPtB:        Lower endpoint of edge (sPtB.y > sPtA.y)
+/// \param[in]  bRefA:       Crossings midway between pixels are rounded away
+///                          from sPtA if true, otherwise away from sPtB
+/// \param[in]  nTri:        Index of the triangle that owns the edge
+///
+/// \return none
+///
+void gslc_DrawFillPolyEdge(gslc_tsPolyEdge* pEdge,gslc_tsPt sPtA,gslc_tsPt sPtB,bool bRefA,uint8_t nTri);
+
 ///
 /// Draw a gradient filled sector of a circle with support for inner and outer radius
 /// - Can be used to create a ring or pie chart
@@ -1624,6 +2313,32 @@ void gslc_DrawFillGradSector(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX,
 void gslc_DrawFillSector(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
   gslc_tsColor cArc, int16_t nAngSecStart, int16_t nAngSecEnd);
 
+///
+/// Draw a flat or gradient filled sector of a circle, using a polar vertex cache
+/// - Common implementation of gslc_DrawFillSector() and gslc_DrawFillGradSector()
+/// - Elements that redraw the same ring repeatedly can provide a cache
+///   so that the segment vertices are not recalculated on each redraw
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  pCache:        Pointer to polar cache (or NULL for none)
+/// \param[in]  nQuality:      Number of segments used to depict a full circle
+/// \param[in]  nMidX:         Midpoint X coordinate of circle
+/// \param[in]  nMidY:         Midpoint Y coordinate of circle
+/// \param[in]  nRad1:         Inner sector radius (0 for sector / pie, non-zero for ring)
+/// \param[in]  nRad2:         Outer sector radius. Delta from nRad1 defines ring thickness.
+/// \param[in]  cArcStart:     Start color for gradient fill (or color for flat fill)
+/// \param[in]  cArcEnd:       End color for gradient fill
+/// \param[in]  bGradient:     Use gradient fill if true, else flat fill with cArcStart
+/// \param[in]  nAngGradStart: For gradient fill, defines the starting angle associated with the starting color (cArcStart)
+/// \param[in]  nAngGradRange: For gradient fill, defines the angular range associated with the start-to-end color range (cArcStart..cArcEnd)
+/// \param[in]  nAngSecStart:  Angle of start of sector drawing (0 at top), measured in degrees.
+/// \param[in]  nAngSecEnd:    Angle of end of sector drawing (0 at top), measured in degrees.
+///
+/// \return none
+///
+void gslc_DrawFillSectorBase(gslc_tsGui* pGui, gslc_tsPolarCache* pCache, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
+  gslc_tsColor cArcStart, gslc_tsColor cArcEnd, bool bGradient, int16_t nAngGradStart, int16_t nAngGradRange, int16_t nAngSecStart, int16_t nAngSecEnd);
+
 // -----------------------------------------------------------------------
 /// @}
 /// \defgroup _Font_ Font Functions
@@ -1859,6 +2574,52 @@ void gslc_PageAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* psElem,uint16_t
 ///
 gslc_tsElemRef* gslc_PageFindElemById(gslc_tsGui* pGui,int16_t nPageId,int16_t nElemId);
 
+///
+/// Assign storage for the spatial index of a page
+/// - The index speeds up touch hit-testing on pages with
+///   many elements (requires GSLC_FEATURE_COLLECT_INDEX=1)
+/// - Each element consumes one entry for every grid cell that
+///   it overlaps. If the storage is too small, touch handling
+///   falls back to searching all elements on the page.
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  nPageId:      Page ID to assign the index to
+/// \param[in]  anIndexList:  Array of index entries (or NULL to disable)
+/// \param[in]  nIndexMax:    Number of entries in anIndexList
+///
+/// \return true if success, false if error
+///
+bool gslc_PageSetIndex(gslc_tsGui* pGui,int16_t nPageId,uint16_t* anIndexList,uint16_t nIndexMax);
+
+///
+/// Enable the snapshot cache for a page
+/// - When gslc_SetPageCur() switches away from the page, the
+///   display is retained in an off-screen snapshot. Switching back
+///   restores the snapshot and only redraws the elements that have
+///   changed in the meantime (requires GSLC_PAGE_CACHE_EN=1 and a
+///   driver that defines DRV_HAS_PAGE_SNAP).
+/// - A snapshot is only used if the same base page is shown
+///   and no popup is active
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  nPageId:      Page ID to configure
+/// \param[in]  bCacheEn:     True to retain snapshots of the page
+///
+/// \return true if success, false if error
+///
+bool gslc_PageSetCacheEn(gslc_tsGui* pGui,int16_t nPageId,bool bCacheEn);
+
+///
+/// Discard all of the page snapshots (and any popup save-under)
+/// - This should be called if the display has been drawn
+///   outside of GUIslice
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return none
+///
+void gslc_PageCacheReset(gslc_tsGui* pGui);
+
 
 // ------------------------------------------------------------------------
 /// @}
@@ -2540,6 +3301,21 @@ void gslc_ElemSetDrawFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_DRAW
 ///
 void gslc_ElemSetTickFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_TICK funcCb);
 
+///
+/// Assign the tick callback function for an element, called at an interval
+/// - The interval is only observed when the tick scheduler has been
+///   enabled (GSLC_FEATURE_TICK_SCHED=1). Otherwise the callback is
+///   called on every gslc_Update().
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  funcCb:      Function pointer to tick routine (or NULL for none))
+/// \param[in]  nIntervalMs: Time between calls (in ms), or 0 for every gslc_Update()
+///
+/// \return none
+///
+void gslc_ElemSetTickFuncInterval(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_TICK funcCb,uint32_t nIntervalMs);
+
 
 ///
 /// Determine if a coordinate is inside of an element
@@ -2701,6 +3477,93 @@ void gslc_InitInputMap(gslc_tsGui* pGui,gslc_tsInputMap* asInputMap,uint8_t nInp
 ///
 void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t nInputVal,gslc_teAction eAction,int16_t nActionVal);
 
+///
+/// Add an input event to the input event queue
+/// - The queue is normally filled by gslc_Update() from the touch driver
+///   and the pin polling callback, but other input sources (eg. an
+///   interrupt-driven encoder) can add events directly
+/// - A touch move (touch pressed following a pressed touch) replaces a
+///   touch move already at the end of the queue
+/// - If the queue is full, the event is dropped and counted
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  eInputEvent:  Input event type
+/// \param[in]  nInputVal:    Additional data for event type (eg. key or pin)
+/// \param[in]  nX:           Touch X coordinate (for GSLC_INPUT_TOUCH)
+/// \param[in]  nY:           Touch Y coordinate (for GSLC_INPUT_TOUCH)
+/// \param[in]  nPress:       Touch pressure (for GSLC_INPUT_TOUCH)
+///
+/// \return true if the event was queued (or coalesced), false if dropped
+///
+bool gslc_InputQueuePush(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t nInputVal,int16_t nX,int16_t nY,uint16_t nPress);
+
+///
+/// Remove the oldest event from the input event queue
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[out] psInputEvt:   Ptr to the structure to receive the event
+///
+/// \return true if an event was removed, false if the queue is empty
+///
+bool gslc_InputQueuePop(gslc_tsGui* pGui,gslc_tsInputEvt* psInputEvt);
+
+///
+/// Collect the pending inputs into the input event queue
+/// - Polls the pin callback and the touch driver until neither
+///   reports an event or the queue is full
+/// - Called from gslc_Update()
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return Number of events collected
+///
+uint16_t gslc_InputQueuePoll(gslc_tsGui* pGui);
+
+///
+/// Handle the events in the input event queue
+/// - Stops when the queue is empty, after GSLC_TOUCH_MAX_EVT events
+///   or, if GSLC_INPUT_Q_BUDGET_MS is non-zero, once the time budget
+///   has been used. At least one event is handled if available.
+/// - Called from gslc_Update()
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return Number of events handled
+///
+uint16_t gslc_InputQueueProcess(gslc_tsGui* pGui);
+
+///
+/// Get the number of events waiting in the input event queue
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return Queue depth
+///
+uint8_t gslc_InputQueueGetDepth(gslc_tsGui* pGui);
+
+///
+/// Get the counters associated with the input event queue
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[out] pnDepthMax:   Maximum queue depth observed (or NULL)
+/// \param[out] pnDropCnt:    Number of events dropped since the queue was full (or NULL)
+/// \param[out] pnMergeCnt:   Number of touch moves coalesced (or NULL)
+/// \param[out] pnLatency:    Time (in ms) that the last handled event spent in the queue (or NULL)
+///
+/// \return none
+///
+void gslc_InputQueueGetCnt(gslc_tsGui* pGui,uint8_t* pnDepthMax,uint32_t* pnDropCnt,uint32_t* pnMergeCnt,uint32_t* pnLatency);
+
+///
+/// Reset the counters associated with the input event queue
+/// - Queued events are retained
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return none
+///
+void gslc_InputQueueResetCnt(gslc_tsGui* pGui);
+
 ///
 /// Find the currently focused element
 ///
@@ -2758,14 +3621,44 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
 
 // ------------------------------------------------------------------------
 /// @}
-/// \defgroup _GenMacro_ General Purpose Macros
-/// Macros that are used throughout the GUI for debug
+/// \defgroup _Stats_ Statistics Functions
+/// Functions that report runtime statistics (GSLC_STATS_EN=1)
 /// @{
 // ------------------------------------------------------------------------
 
-// Create debug macro to selectively include the output code
+///
+/// Fetch a copy of the runtime statistics
+/// - The statistics accumulate across calls to gslc_Update()
+///   until gslc_ResetStats() is called. An application may call
+///   this periodically to export the counters (eg. over serial).
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pStats:      Pointer to the statistics copy
+///
+/// \return true if success, false if statistics are disabled
+///         (GSLC_STATS_EN=0) in which case pStats is cleared
+///
+bool gslc_GetStats(gslc_tsGui* pGui,gslc_tsStats* pStats);
 
-/// \def GSLC_DEBUG_PRINT(fmt, ...)
+///
+/// Reset the runtime statistics
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_ResetStats(gslc_tsGui* pGui);
+
+// ------------------------------------------------------------------------
+/// @}
+/// \defgroup _GenMacro_ General Purpose Macros
+/// Macros that are used throughout the GUI for debug
+/// @{
+// ------------------------------------------------------------------------
+
+// Create debug macro to selectively include the output code
+
+/// \def GSLC_DEBUG_PRINT(fmt, ...)
 ///
 /// Macro to enable optional debug output
 /// - Supports printf formatting via gslc_DebugPrintf()
@@ -2822,6 +3715,29 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
             }                                                   \
           } while (0)
 
+/// \def GSLC_STATS_DRV(pGui, eCall)
+///
+/// Macro to count a driver drawing call in the runtime statistics
+/// - Compiles to nothing if GSLC_STATS_EN=0
+///
+/// \param[in]  pGui:       Pointer to GUI
+/// \param[in]  eCall:      Driver call type (gslc_teStatsDrv)
+///
+
+#if (GSLC_STATS_EN)
+  #define GSLC_STATS_DRV(pGui, eCall)                           \
+          do {                                                  \
+            (pGui)->sStats.anDrvCall[eCall]++;                  \
+          } while (0)
+  #define GSLC_STATS_DRV_N(pGui, eCall, nCnt)                   \
+          do {                                                  \
+            (pGui)->sStats.anDrvCall[eCall] += (nCnt);          \
+          } while (0)
+#else
+  #define GSLC_STATS_DRV(pGui, eCall)           do { } while (0)
+  #define GSLC_STATS_DRV_N(pGui, eCall, nCnt)   do { } while (0)
+#endif
+
 
 
 // ------------------------------------------------------------------------
@@ -3432,6 +4348,34 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
 ///
 gslc_tsImgRef gslc_ResetImage();
 
+///
+/// Fetch a free-running timestamp for the runtime statistics
+/// - Uses the monotonic clock on LINUX and micros() on Arduino
+///
+/// \return Timestamp in microseconds (or 0 if not supported)
+///
+uint32_t gslc_StatsGetTimeUs();
+
+///
+/// Fetch a free-running timestamp in milliseconds
+/// - Uses the monotonic clock on LINUX and millis() on Arduino
+/// - Used to timestamp queued input events
+///
+/// \return Timestamp in milliseconds (or 0 if not supported)
+///
+uint32_t gslc_GetTimeMs();
+
+///
+/// Count an element redraw in the runtime statistics
+/// - Has no effect if GSLC_STATS_EN=0
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nType:       Element type (GSLC_TYPE_* or GSLC_TYPEX_*)
+///
+/// \return none
+///
+void gslc_StatsElemRedraw(gslc_tsGui* pGui,int16_t nType);
+
 
 // ------------------------------------------------------------------------
 /// @}
@@ -3605,6 +4549,39 @@ void gslc_ElemDraw(gslc_tsGui* pGui,int16_t nPageId,int16_t nElemId);
 void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf, gslc_tsRect rTxt, gslc_tsFont* pTxtFont, gslc_teTxtFlags eTxtFlags,
   int8_t eTxtAlign, gslc_tsColor colTxt, gslc_tsColor colBg, int16_t nMarginW, int16_t nMarginH);
 
+///
+/// Get the extent (width and height) of a text string
+/// - Produces the same result as gslc_DrvGetTxtSize()
+/// - If the text extent cache is enabled (GSLC_TXT_CACHE_EN), the
+///   extents of recently measured strings are returned without
+///   calling the driver
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pFont:       Ptr to Font structure
+/// \param[in]  pStr:        String to measure
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[out] pnTxtX:      Ptr to offset X of text
+/// \param[out] pnTxtY:      Ptr to offset Y of text
+/// \param[out] pnTxtSzW:    Ptr to width of text
+/// \param[out] pnTxtSzH:    Ptr to height of text
+///
+/// \return true if success, false if failure
+///
+bool gslc_TxtCacheGetSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,
+  int16_t* pnTxtX,int16_t* pnTxtY,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH);
+
+///
+/// Discard all cached text extents and element text memos
+/// - This is called automatically when a font is (re)loaded, but
+///   should also be called if the glyphs of a font are changed
+///   in some other way
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_TxtCacheReset(gslc_tsGui* pGui);
+
 
 ///
 /// Set the global rounded radius
@@ -3632,6 +4609,293 @@ void gslc_SetRoundRadius(gslc_tsGui* pGui, uint8_t nRadius);
 ///
 void gslc_SetFocusCol(gslc_tsGui* pGui,gslc_tsColor colFocusNone,gslc_tsColor colFocus,gslc_tsColor colFocusEdit);
 
+// ------------------------------------------------------------------------
+/// @}
+/// \defgroup _IntClip_ Internal: Clipped Drawing Functions
+/// These functions support drivers that enable GSLC_CLIP_EN. If a shape
+/// is only partially visible within the current clipping region, it is
+/// rendered with the driver's clipped point, line and rect primitives
+/// instead of the (unclipped) accelerated driver API.
+/// - Each function returns true if the shape has been handled (ie. it
+///   was either discarded or drawn in clipped form) and false if the
+///   shape is entirely visible and the caller should draw it directly.
+/// @{
+// ------------------------------------------------------------------------
+
+///
+/// Draw a horizontal span of pixels using the driver's clipped rect fill
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         Left X coordinate of span
+/// \param[in]  nX1:         Right X coordinate of span (inclusive)
+/// \param[in]  nY:          Y coordinate of span
+/// \param[in]  nCol:        Color RGB value for the span
+///
+/// \return none
+///
+void gslc_ClipDrawSpan(gslc_tsGui* pGui,int16_t nX0,int16_t nX1,int16_t nY,gslc_tsColor nCol);
+
+///
+/// Draw selected quadrants of a circle with the driver's clipped primitives
+/// - The quadrants can be separated by an offset to form the
+///   corners of a rounded rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nMidX:       Center X coordinate (of top-left quadrant)
+/// \param[in]  nMidY:       Center Y coordinate (of top-left quadrant)
+/// \param[in]  nRadius:     Radius of circle
+/// \param[in]  nQuadMask:   Quadrants to draw (0x1=top-left, 0x2=top-right,
+///                          0x4=bottom-right, 0x8=bottom-left)
+/// \param[in]  nOffsetW:    Horizontal offset of the right quadrants
+/// \param[in]  nOffsetH:    Vertical offset of the bottom quadrants
+/// \param[in]  bFill:       Fill the quadrants (true) or draw the frame (false)
+/// \param[in]  nCol:        Color RGB value
+///
+/// \return none
+///
+void gslc_ClipDrawCircleQuad(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,
+  uint8_t nQuadMask,int16_t nOffsetW,int16_t nOffsetH,bool bFill,gslc_tsColor nCol);
+
+///
+/// Determine the bounding rect of a triangle
+///
+/// \param[in]  nX0:         X Coordinate #1
+/// \param[in]  nY0:         Y Coordinate #1
+/// \param[in]  nX1:         X Coordinate #2
+/// \param[in]  nY1:         Y Coordinate #2
+/// \param[in]  nX2:         X Coordinate #3
+/// \param[in]  nY2:         Y Coordinate #3
+///
+/// \return Bounding rect
+///
+gslc_tsRect gslc_ClipTriangleBounds(int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2);
+
+///
+/// Handle clipping of a circle frame
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nMidX:       Center X coordinate
+/// \param[in]  nMidY:       Center Y coordinate
+/// \param[in]  nRadius:     Radius of circle
+/// \param[in]  nCol:        Color RGB value for the frame
+///
+/// \return true if handled, false if caller should draw directly
+///
+bool gslc_ClipDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol);
+
+///
+/// Handle clipping of a filled circle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nMidX:       Center X coordinate
+/// \param[in]  nMidY:       Center Y coordinate
+/// \param[in]  nRadius:     Radius of circle
+/// \param[in]  nCol:        Color RGB value for the fill
+///
+/// \return true if handled, false if caller should draw directly
+///
+bool gslc_ClipDrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol);
+
+///
+/// Handle clipping of a rounded rectangle frame
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to frame
+/// \param[in]  nRadius:     Radius of the rounded corners
+/// \param[in]  nCol:        Color RGB value for the frame
+///
+/// \return true if handled, false if caller should draw directly
+///
+bool gslc_ClipDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColor nCol);
+
+///
+/// Handle clipping of a filled rounded rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to fill
+/// \param[in]  nRadius:     Radius of the rounded corners
+/// \param[in]  nCol:        Color RGB value for the fill
+///
+/// \return true if handled, false if caller should draw directly
+///
+bool gslc_ClipDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColor nCol);
+
+///
+/// Handle clipping of a triangle frame
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         X Coordinate #1
+/// \param[in]  nY0:         Y Coordinate #1
+/// \param[in]  nX1:         X Coordinate #2
+/// \param[in]  nY1:         Y Coordinate #2
+/// \param[in]  nX2:         X Coordinate #3
+/// \param[in]  nY2:         Y Coordinate #3
+/// \param[in]  nCol:        Color RGB value for the frame
+///
+/// \return true if handled, false if caller should draw directly
+///
+bool gslc_ClipDrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
+        int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol);
+
+///
+/// Handle clipping of a filled triangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         X Coordinate #1
+/// \param[in]  nY0:         Y Coordinate #1
+/// \param[in]  nX1:         X Coordinate #2
+/// \param[in]  nY1:         Y Coordinate #2
+/// \param[in]  nX2:         X Coordinate #3
+/// \param[in]  nY2:         Y Coordinate #3
+/// \param[in]  nCol:        Color RGB value for the fill
+///
+/// \return true if handled, false if caller should draw directly
+///
+bool gslc_ClipDrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
+        int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol);
+
+///
+/// Determine the visible region of an image
+/// - Used by drivers to restrict bitmap rendering to the clipping region
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coordinate of image
+/// \param[in]  nDstY:       Destination Y coordinate of image
+/// \param[in]  nImgW:       Width of image
+/// \param[in]  nImgH:       Height of image
+/// \param[out] pRect:       Visible region (relative to image top-left)
+///
+/// \return true if any portion of the image is visible, false otherwise
+///
+bool gslc_ClipImgRect(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,int16_t nImgW,int16_t nImgH,gslc_tsRect* pRect);
+
+// ------------------------------------------------------------------------
+/// @}
+/// \defgroup _IntBmp_ Internal: BMP Streaming Functions
+/// - These functions decode BMP images from a stream (such as a
+///   file on SD card) and push the visible pixels to the display
+///   a scanline run at a time through gslc_DrvDrawRow()
+/// - Uncompressed 16-bit (RGB555 / bitfields), 24-bit and
+///   32-bit images are supported in both bottom-up and
+///   top-down row order
+/// @{
+// ------------------------------------------------------------------------
+
+///
+/// Fetch a 16-bit little-endian value from a buffer
+///
+/// \param[in]  pBuf:        Pointer to buffer
+///
+/// \return Value
+///
+uint16_t gslc_BmpGet16(const uint8_t* pBuf);
+
+///
+/// Fetch a 32-bit little-endian value from a buffer
+///
+/// \param[in]  pBuf:        Pointer to buffer
+///
+/// \return Value
+///
+uint32_t gslc_BmpGet32(const uint8_t* pBuf);
+
+///
+/// Determine the bit position and width of a color field mask
+///
+/// \param[in]  nMask:       Bitfield mask
+/// \param[out] pnShift:     Bit position of the least-significant bit
+/// \param[out] pnBits:      Number of bits in the field
+///
+/// \return none
+///
+void gslc_BmpMaskToField(uint32_t nMask,uint8_t* pnShift,uint8_t* pnBits);
+
+///
+/// Parse the header of a BMP image stream
+///
+/// \param[in]  pReader:     Pointer to BMP stream reader
+/// \param[out] pInfo:       Pointer to BMP info to populate
+///
+/// \return true if the image format is supported, false otherwise
+///
+bool gslc_BmpParseHeader(gslc_tsBmpReader* pReader,gslc_tsBmpInfo* pInfo);
+
+///
+/// Decode a single pixel from BMP pixel data
+///
+/// \param[in]  pInfo:       Pointer to BMP info
+/// \param[in]  pPix:        Pointer to the pixel data
+///
+/// \return Color of the pixel
+///
+gslc_tsColor gslc_BmpDecodePixel(gslc_tsBmpInfo* pInfo,const uint8_t* pPix);
+
+///
+/// Push a run of decoded BMP pixels to the display
+/// - Uses the driver's gslc_DrvDrawRow() if available (DRV_HAS_DRAW_ROW)
+///   otherwise falls back to drawing individual points
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of the first pixel
+/// \param[in]  nY:          Y coordinate of the row
+/// \param[in]  nLen:        Number of pixels in the run
+/// \param[in]  pasCol:      Array of pixel colors
+///
+/// \return none
+///
+void gslc_BmpDrawRun(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nLen,const gslc_tsColor* pasCol);
+
+///
+/// Draw a BMP image from a stream
+/// - Only the portion of the image within the clipping region is
+///   read and drawn
+/// - If GSLC_BMP_TRANS_EN is enabled, pixels matching the transparent
+///   color are skipped
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pReader:     Pointer to BMP stream reader
+/// \param[in]  nDstX:       X coordinate to draw image
+/// \param[in]  nDstY:       Y coordinate to draw image
+///
+/// \return true if success, false if error
+///
+bool gslc_BmpDraw(gslc_tsGui* pGui,gslc_tsBmpReader* pReader,int16_t nDstX,int16_t nDstY);
+
+#if defined(__linux__)
+///
+/// BMP stream read callback for a stdio file
+///
+/// \param[in]  pvStream:    Void pointer to FILE
+/// \param[out] pBuf:        Buffer to read into
+/// \param[in]  nLen:        Number of bytes to read
+///
+/// \return Number of bytes read
+///
+uint16_t gslc_BmpReadFile(void* pvStream,uint8_t* pBuf,uint16_t nLen);
+
+///
+/// BMP stream seek callback for a stdio file
+///
+/// \param[in]  pvStream:    Void pointer to FILE
+/// \param[in]  nPos:        Absolute position in file
+///
+/// \return true if success, false if error
+///
+bool gslc_BmpSeekFile(void* pvStream,uint32_t nPos);
+
+///
+/// Draw a BMP image from a file
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pFname:      Pathname of BMP file
+/// \param[in]  nDstX:       X coordinate to draw image
+/// \param[in]  nDstY:       Y coordinate to draw image
+///
+/// \return true if success, false if error
+///
+bool gslc_BmpDrawFromFile(gslc_tsGui* pGui,const char* pFname,int16_t nDstX,int16_t nDstY);
+#endif // __linux__
+
 // ------------------------------------------------------------------------
 /// @}
 /// \defgroup _IntPage_ Internal: Page Functions
@@ -3717,6 +4981,247 @@ void gslc_PageFlipGo(gslc_tsGui* pGui);
 ///
 gslc_tsPage* gslc_PageFindById(gslc_tsGui* pGui,int16_t nPageId);
 
+///
+/// Find the page containing an element reference
+/// - The page found by the previous call is checked first, as
+///   consecutive lookups usually refer to the same page
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+///
+/// \return Ptr to page or NULL if not found on any page
+///
+gslc_tsPage* gslc_PageFindByElemRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
+#if (GSLC_PAGE_CACHE_EN)
+///
+/// Save a snapshot of the current page before another page is selected
+/// - Only performed if the page has its cache enabled, no popup is
+///   shown and the display isn't waiting for a full redraw
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_PageCacheSave(gslc_tsGui* pGui);
+
+///
+/// Restore the snapshot of the page that has just been selected
+/// - On success, the pending full page redraw is replaced by a
+///   redraw of the stale region and of any elements awaiting redraw
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return true if a snapshot was restored, false otherwise
+///
+bool gslc_PageCacheRestore(gslc_tsGui* pGui);
+#endif // GSLC_PAGE_CACHE_EN
+
+#if (GSLC_POPUP_SAVE_EN)
+///
+/// Save the region of the display beneath a popup before it is shown
+/// - Only performed if no other popup is shown and the display
+///   isn't waiting for a full redraw
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nPageId:     Page ID of the popup
+///
+/// \return none
+///
+void gslc_PopupSaveTake(gslc_tsGui* pGui,int16_t nPageId);
+
+///
+/// Restore the region of the display beneath a popup that has just been hidden
+/// - On success, the pending redraw of the popup region is replaced by
+///   a redraw of the stale region and of any elements awaiting redraw
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asRectPend:  Regions that were awaiting redraw before the popup was hidden
+/// \param[in]  nRectPend:   Number of regions in asRectPend
+///
+/// \return true if the save-under was restored, false otherwise
+///
+bool gslc_PopupSaveRestore(gslc_tsGui* pGui,gslc_tsRect* asRectPend,uint8_t nRectPend);
+#endif // GSLC_POPUP_SAVE_EN
+
+#if (GSLC_PAGE_CACHE_EN) || (GSLC_POPUP_SAVE_EN)
+///
+/// Replace a pending redraw with a redraw (from the background
+/// upwards) of the regions that may differ from a restored snapshot
+/// - These are the stale regions and the regions of any elements
+///   in the page stack that are awaiting redraw
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pEntry:      Snapshot that was restored
+///
+/// \return none
+///
+void gslc_PageCacheRedrawStale(gslc_tsGui* pGui,gslc_tsPageCache* pEntry);
+
+///
+/// Mark a region of a page as changed in any snapshot that shows it
+/// - Called when an element on a hidden page (or on the base page
+///   beneath it, or on a page beneath the popup) is redrawn or moved
+/// - The region is padded as by gslc_InvalidateRgnElem()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pPage:       Page containing the region
+/// \param[in]  rRect:       Element region that has changed
+///
+/// \return none
+///
+void gslc_PageCacheStale(gslc_tsGui* pGui,gslc_tsPage* pPage,gslc_tsRect rRect);
+
+///
+/// Discard a snapshot and release its storage
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pEntry:      Snapshot to release
+///
+/// \return none
+///
+void gslc_PageCacheRelease(gslc_tsGui* pGui,gslc_tsPageCache* pEntry);
+
+///
+/// Discard all of the page snapshots and release their storage
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_PageCacheFree(gslc_tsGui* pGui);
+#endif // GSLC_PAGE_CACHE_EN || GSLC_POPUP_SAVE_EN
+
+///
+/// Send a tick event to the elements that need one
+/// - Called from gslc_Update()
+/// - With the tick scheduler enabled (GSLC_FEATURE_TICK_SCHED=1),
+///   only the registered elements that are due are called.
+///   Otherwise (or if the scheduler overflowed) each page is sent
+///   a GSLC_EVT_TICK event.
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_PageTick(gslc_tsGui* pGui);
+
+///
+/// Send a GSLC_EVT_TICK event to each page
+/// - Only the pages in the page stack are ticked if
+///   GSLC_TICK_STACK_ONLY is enabled
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_PageTickAll(gslc_tsGui* pGui);
+
+///
+/// Check whether a page is in the page stack
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pPage:       Ptr to page
+///
+/// \return true if the page is the base, current or overlay page
+///
+bool gslc_PageInStack(gslc_tsGui* pGui,gslc_tsPage* pPage);
+
+#if (GSLC_FEATURE_TICK_SCHED)
+///
+/// Register an element with the tick scheduler
+/// - If the element is already registered, its interval is updated
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  pPage:       Page containing the element
+/// \param[in]  nIntervalMs: Time between calls (in ms), or 0 for every gslc_Update()
+///
+/// \return true if success, false if the scheduler is full (in which
+///         case every page is ticked on each update from then on,
+///         ignoring the tick intervals)
+///
+bool gslc_TickSchedAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsPage* pPage,uint32_t nIntervalMs);
+
+///
+/// Remove an element from the tick scheduler
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+///
+/// \return none
+///
+void gslc_TickSchedRemove(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
+///
+/// Link a tick scheduler entry to the end of a list
+///
+/// \param[in]  pSched:      Pointer to tick scheduler
+/// \param[in]  nEntry:      Entry index
+/// \param[in]  nList:       List identifier (GSLC_TICK_LIST_* or slot index)
+///
+/// \return none
+///
+void gslc_TickSchedLink(gslc_tsTickSched* pSched,int8_t nEntry,int8_t nList);
+
+///
+/// Unlink a tick scheduler entry from its list
+///
+/// \param[in]  pSched:      Pointer to tick scheduler
+/// \param[in]  nEntry:      Entry index
+///
+/// \return none
+///
+void gslc_TickSchedUnlink(gslc_tsTickSched* pSched,int8_t nEntry);
+
+///
+/// Determine the list that holds a tick scheduler entry until its next tick
+///
+/// \param[in]  pEntry:      Pointer to entry
+///
+/// \return GSLC_TICK_LIST_EVERY or the wheel slot index
+///
+int8_t gslc_TickSchedGetList(gslc_tsTickEntry* pEntry);
+
+///
+/// Move all of the entries from one tick scheduler list to their own lists
+///
+/// \param[in]  pSched:      Pointer to tick scheduler
+/// \param[in]  nListSrc:    List identifier to empty
+///
+/// \return none
+///
+void gslc_TickSchedRelink(gslc_tsTickSched* pSched,int8_t nListSrc);
+
+///
+/// Call the tick callback of an entry and move it to the list for its next tick
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nEntry:      Entry index (already unlinked)
+/// \param[in]  nTimeNow:    Current time (ms)
+/// \param[in]  nSlotCur:    Wheel slot being visited (or -1 for none)
+///
+/// \return none
+///
+void gslc_TickSchedFire(gslc_tsGui* pGui,int8_t nEntry,uint32_t nTimeNow,int8_t nSlotCur);
+#endif // GSLC_FEATURE_TICK_SCHED
+
+///
+/// Redraw the background (if forced) and issue a draw event to
+/// each page in the stack, limited to the current clipping region
+/// - Called by gslc_PageRedrawGo() for each redraw pass (and for
+///   each band when the band renderer is enabled)
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  bForce:       If true, redraw the background and all
+///                           elements (page or region redraw). If false,
+///                           only elements that require redraw are drawn.
+///
+/// \return none
+///
+/// \internal
+void gslc_PageRedrawStack(gslc_tsGui* pGui,bool bForce);
+
 /// Perform a redraw calculation on the page to determine if additional
 /// elements should also be redrawn. This routine checks to see if any
 /// transparent elements have been marked as needing redraw. If so, the
@@ -3762,6 +5267,9 @@ bool gslc_ElemEvent(void* pvGui,gslc_tsEvent sEvent);
 ///
 /// Trigger an element's touch event. This is an optional
 /// behavior useful in some extended element types.
+/// - The event is deferred until the start of the next gslc_Update()
+/// - Up to GSLC_EVENT_PEND_MAX events can be deferred. If they are
+///   all in use, the oldest deferred event is issued immediately.
 ///
 /// \param[in]  pGui:             Pointer to GUI
 /// \param[in]  pElemRefTracked:  Pointer to tracked Element reference (or NULL for none))
@@ -3773,6 +5281,17 @@ bool gslc_ElemEvent(void* pvGui,gslc_tsEvent sEvent);
 ///
 bool gslc_ElemSendEventTouch(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefTracked,
         gslc_teTouch eTouch,int16_t nX,int16_t nY);
+
+///
+/// Issue the oldest deferred element event
+/// - Deferred events are queued by gslc_ElemSendEventTouch() and
+///   issued at the start of the next gslc_Update()
+///
+/// \param[in]  pGui:             Pointer to GUI
+///
+/// \return true if an event was issued, false if none were pending
+///
+bool gslc_ElemEventPendIssue(gslc_tsGui* pGui);
 #endif // !DRV_TOUCH_NONE
 
 
@@ -3863,6 +5382,31 @@ gslc_tsElemRef* gslc_CollectFindElemById(gslc_tsGui* pGui,gslc_tsCollect* pColle
 ///
 gslc_tsElemRef* gslc_CollectFindElemFromCoord(gslc_tsGui* pGui,gslc_tsCollect* pCollect,int16_t nX, int16_t nY, int16_t* pnElemInd);
 
+///
+/// Assign storage for the spatial index of a collection
+/// - Compound elements may call this for their internal collection
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pCollect:     Pointer to the collection
+/// \param[in]  anIndexList:  Array of index entries (or NULL to disable)
+/// \param[in]  nIndexMax:    Number of entries in anIndexList
+///
+/// \return true if success, false if error
+///
+bool gslc_CollectSetIndex(gslc_tsGui* pGui,gslc_tsCollect* pCollect,uint16_t* anIndexList,uint16_t nIndexMax);
+
+///
+/// Rebuild the spatial index of a collection from the current
+/// element positions
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pCollect:     Pointer to the collection
+///
+/// \return true if the index is usable, false if there is no index
+///         or its storage is too small
+///
+bool gslc_CollectIndexBuild(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
+
 
 /// Allocate the next available Element ID in a collection
 ///
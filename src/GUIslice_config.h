@@ -156,6 +156,8 @@ extern "C" {
   //#include "../configs/rpi-sdl1-default-tslib.h"
   //#include "../configs/rpi-sdl1-default-sdl.h"
   //#include "../configs/linux-sdl1-default-mouse.h"
+  //#include "../configs/linux-memfb-default-script.h"
+  //#include "../configs/linux-fb-default-tslib.h"
 
 #endif // USER_CONFIG_LOADED
 
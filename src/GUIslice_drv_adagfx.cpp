@@ -475,6 +475,128 @@ extern "C" {
 #endif // DRV_DISP_ADAGFX_*
 
 
+// ------------------------------------------------------------------------
+// Band renderer
+// ------------------------------------------------------------------------
+#if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+  // Adafruit-GFX drawing target that renders into a RAM buffer
+  // covering a band of up to GSLC_BAND_H lines of the display
+  // - Drawing uses display coordinates. Any pixels outside of the
+  //   band are discarded.
+  // - The Adafruit-GFX primitives (lines, circles, triangles and
+  //   text) all reduce to the pixel and rectangle fills below
+  class gslc_tcDrvBand : public Adafruit_GFX {
+  public:
+    gslc_tcDrvBand() : Adafruit_GFX(0,0) {
+      m_pnBuf = NULL;
+      m_nBufLen = 0;
+      m_rBand.x = 0;
+      m_rBand.y = 0;
+      m_rBand.w = 0;
+      m_rBand.h = 0;
+    }
+
+    // Allocate the band buffer (in pixels)
+    bool Alloc(uint32_t nLen) {
+      m_pnBuf = (uint16_t*)malloc(nLen*sizeof(uint16_t));
+      m_nBufLen = (m_pnBuf)? nLen : 0;
+      return (m_pnBuf != NULL);
+    }
+
+    // Start a band covering rBand of a display with size nDispW x nDispH
+    // - The band pixels are stored contiguously (stride of rBand.w)
+    bool Start(gslc_tsRect rBand,int16_t nDispW,int16_t nDispH) {
+      if ((uint32_t)rBand.w*rBand.h > m_nBufLen) {
+        return false;
+      }
+      m_rBand = rBand;
+      // Text wrapping and clipping in Adafruit-GFX uses the display size
+      _width  = nDispW;
+      _height = nDispH;
+      return true;
+    }
+
+    gslc_tsRect GetRect() { return m_rBand; }
+    uint16_t*   GetBuf()  { return m_pnBuf; }
+
+    void drawPixel(int16_t nX,int16_t nY,uint16_t nColRaw) {
+      nX -= m_rBand.x;
+      nY -= m_rBand.y;
+      if ((nX < 0) || (nY < 0) || (nX >= (int16_t)m_rBand.w) || (nY >= (int16_t)m_rBand.h)) {
+        return;
+      }
+      m_pnBuf[(int32_t)nY*m_rBand.w+nX] = nColRaw;
+    }
+
+    void fillRect(int16_t nX,int16_t nY,int16_t nW,int16_t nH,uint16_t nColRaw) {
+      // Normalize the rectangle and clip it to the band
+      if (nW < 0) { nX += nW+1; nW = -nW; }
+      if (nH < 0) { nY += nH+1; nH = -nH; }
+      int16_t nX0 = nX - m_rBand.x;
+      int16_t nY0 = nY - m_rBand.y;
+      int16_t nX1 = nX0 + nW;
+      int16_t nY1 = nY0 + nH;
+      if (nX0 < 0) { nX0 = 0; }
+      if (nY0 < 0) { nY0 = 0; }
+      if (nX1 > (int16_t)m_rBand.w) { nX1 = m_rBand.w; }
+      if (nY1 > (int16_t)m_rBand.h) { nY1 = m_rBand.h; }
+      int16_t   nRow,nCol;
+      uint16_t* pnDst;
+      for (nRow=nY0;nRow<nY1;nRow++) {
+        pnDst = m_pnBuf + (int32_t)nRow*m_rBand.w + nX0;
+        for (nCol=nX0;nCol<nX1;nCol++) {
+          *(pnDst++) = nColRaw;
+        }
+      }
+    }
+
+    void drawFastHLine(int16_t nX,int16_t nY,int16_t nW,uint16_t nColRaw) {
+      fillRect(nX,nY,nW,1,nColRaw);
+    }
+
+    void drawFastVLine(int16_t nX,int16_t nY,int16_t nH,uint16_t nColRaw) {
+      fillRect(nX,nY,1,nH,nColRaw);
+    }
+
+    // Copy a block of raw pixels from RAM (clipped to the band)
+    void drawRGBBitmap(int16_t nX,int16_t nY,const uint16_t* pnCol,int16_t nW,int16_t nH) {
+      int16_t nRow,nCol;
+      for (nRow=0;nRow<nH;nRow++) {
+        for (nCol=0;nCol<nW;nCol++) {
+          drawPixel(nX+nCol,nY+nRow,*(pnCol++));
+        }
+      }
+    }
+
+  private:
+    uint16_t*   m_pnBuf;      // Band buffer
+    uint32_t    m_nBufLen;    // Band buffer size (in pixels)
+    gslc_tsRect m_rBand;      // Region of the display covered by the band
+  };
+
+  gslc_tcDrvBand m_drvBand;
+
+  // Current drawing target: the band while a band is being
+  // composed (see gslc_DrvBandStart), otherwise the display
+  Adafruit_GFX* m_pDrvGfx = &m_disp;
+  #define DRV_GFX (*m_pDrvGfx)
+#else
+  #define DRV_GFX m_disp
+#endif // GSLC_BAND_EN && DRV_HAS_BAND
+
+// Text rendered through Adafruit-GFX is clipped one glyph at a time
+// - Partially visible glyphs are rendered through a GFXcanvas1
+// - Only available for the display libraries that are built upon
+//   Adafruit-GFX (see the includes above)
+#if !(GSLC_CLIP_EN) || defined(DRV_DISP_ADAGFX_AS) || defined(DRV_DISP_LCDGFX)
+  #define DRV_CLIP_GLYPH 0
+#elif defined(DRV_DISP_ADAGFX_ILI9341_T3) || defined(DRV_DISP_ADAGFX_RA8876) || defined(DRV_DISP_ADAGFX_RA8876_GV) || defined(DRV_DISP_ADAGFX_ILI9225_DUE)
+  #define DRV_CLIP_GLYPH 0
+#else
+  #define DRV_CLIP_GLYPH 1
+#endif
+
+
 
 // ------------------------------------------------------------------------
 #if defined(DRV_TOUCH_ADA_STMPE610)
@@ -760,6 +882,14 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
     // the rotation parameters and clipping region
     gslc_DrvRotate(pGui,GSLC_ROTATE);
 
+    #if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+    // Allocate the band buffer for the widest orientation
+    // - If this fails, the redraw falls back to drawing directly
+    if (!m_drvBand.Alloc((uint32_t)GSLC_MAX(pGui->nDisp0W,pGui->nDisp0H)*GSLC_BAND_H)) {
+      GSLC_DEBUG_PRINT("WARNING: DrvInit() band buffer alloc failed\n",0);
+    }
+    #endif
+
 
     // Initialize SD card usage
     #if (GSLC_SD_EN == 1)
@@ -886,9 +1016,8 @@ void gslc_DrvImageDestruct(void* pvImg)
 
 bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
 {
-  // NOTE: The clipping rect is currently saved in the
-  // driver struct, but the drawing code does not currently
-  // use it.
+  // NOTE: The clipping rect is saved in the driver struct
+  // and is used by the drawing code when GSLC_CLIP_EN is set.
   gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   if (pRect == NULL) {
     // Default to entire display
@@ -1195,6 +1324,65 @@ bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gsl
 
 }
 
+#if (DRV_CLIP_GLYPH)
+// Draw a character at the text cursor, clipped to the clipping region
+// - Returns false if the character is entirely visible (or doesn't
+//   draw anything), in which case the caller renders it directly
+// - Otherwise the character is skipped (if outside the clipping
+//   region) or only its visible pixels are drawn, and the text
+//   cursor is advanced
+bool gslc_DrvDrawCharClip(gslc_tsGui* pGui,gslc_tsFont* pFont,char ch,uint16_t nColRaw)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  char            acStr[2] = { ch, 0 };
+  int16_t         nCurX = DRV_GFX.getCursorX();
+  int16_t         nCurY = DRV_GFX.getCursorY();
+  int16_t         nGlyphX,nGlyphY;
+  uint16_t        nGlyphW,nGlyphH;
+  int16_t         nRow,nCol;
+
+  if ((ch == '\n') || (ch == '\r')) {
+    return false;
+  }
+  DRV_GFX.getTextBounds(acStr,nCurX,nCurY,&nGlyphX,&nGlyphY,&nGlyphW,&nGlyphH);
+  if ((nGlyphW == 0) || (nGlyphH == 0)) {
+    return false;
+  }
+  gslc_tsRect rGlyph = (gslc_tsRect) { nGlyphX, nGlyphY, nGlyphW, nGlyphH };
+  gslc_teClipRes eClip = gslc_ClipRectTest(&pDriver->rClipRect,rGlyph);
+  if (eClip == GSLC_CLIP_IN) {
+    return false;
+  }
+
+  // Render the glyph into a 1-bit canvas covering its bounds. This
+  // also provides the cursor advance for glyphs that are skipped.
+  GFXcanvas1 cvsGlyph(nGlyphW,nGlyphH);
+  if (cvsGlyph.getBuffer() == NULL) {
+    // Insufficient memory, so render the glyph unclipped
+    return false;
+  }
+  cvsGlyph.setTextWrap(false);
+  cvsGlyph.setFont((const GFXfont*)pFont->pvFont);
+  cvsGlyph.setTextSize(pFont->nSize);
+  cvsGlyph.setCursor(nCurX-nGlyphX,nCurY-nGlyphY);
+  cvsGlyph.print(ch);
+
+  if (eClip == GSLC_CLIP_PART) {
+    for (nRow=0;nRow<(int16_t)nGlyphH;nRow++) {
+      for (nCol=0;nCol<(int16_t)nGlyphW;nCol++) {
+        if ((cvsGlyph.getPixel(nCol,nRow)) && (gslc_ClipPt(&pDriver->rClipRect,nGlyphX+nCol,nGlyphY+nRow))) {
+          DRV_GFX.drawPixel(nGlyphX+nCol,nGlyphY+nRow,nColRaw);
+        }
+      }
+    }
+  }
+
+  // Advance the text cursor
+  DRV_GFX.setCursor(nGlyphX+cvsGlyph.getCursorX(),nCurY);
+  return true;
+}
+#endif // DRV_CLIP_GLYPH
+
 bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt, gslc_tsColor colBg=GSLC_COL_BLACK)
 {
   uint16_t  nColRaw = gslc_DrvAdaptColorToRaw(colTxt);
@@ -1282,14 +1470,14 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
       m_disp.setFont((const FONT_INFO *)pFont->pvFont);
     }
   #else
-    m_disp.setFont((const GFXfont *)pFont->pvFont);
+    DRV_GFX.setFont((const GFXfont *)pFont->pvFont);
   #endif
-  m_disp.setTextColor(nColRaw);
-  m_disp.setCursor(nTxtX,nTxtY);
+  DRV_GFX.setTextColor(nColRaw);
+  DRV_GFX.setCursor(nTxtX,nTxtY);
   #if defined(DRV_DISP_ADAGFX_RA8876_GV)
     m_disp.setTextScale(nTxtScale); // TODO: Support scaling
   #else
-    m_disp.setTextSize(nTxtScale);
+    DRV_GFX.setTextSize(nTxtScale);
   #endif
 #endif
 
@@ -1400,9 +1588,15 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
 	    m_nTxtX += m_disp.getFont().getTextSize(chStr, NULL);
 
     #else
+      #if (DRV_CLIP_GLYPH)
+      // Clip the text one glyph at a time
+      if (gslc_DrvDrawCharClip(pGui,pFont,ch,nColRaw)) {
+        continue;
+      }
+      #endif // DRV_CLIP_GLYPH
       // Call Adafruit-GFX for rendering
       // NOTE: This should automatically advance the "cursor" (current text position)
-      m_disp.print(ch);
+      DRV_GFX.print(ch);
     #endif
 
     // Handle multi-line text:
@@ -1435,8 +1629,8 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
 
       #else
         int16_t   nCurPosY = 0;
-        nCurPosY = m_disp.getCursorY();
-        m_disp.setCursor(nTxtX,nCurPosY);
+        nCurPosY = DRV_GFX.getCursorY();
+        DRV_GFX.setCursor(nTxtX,nCurPosY);
       #endif
     }
 
@@ -1470,7 +1664,7 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
 #elif defined(DRV_DISP_ADAGFX_RA8875_SUMO)
   // TODO
 #else
-  m_disp.setFont();
+  DRV_GFX.setFont();
 #endif
 
   return true;
@@ -1497,6 +1691,43 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
 }
 
 
+// -----------------------------------------------------------------------
+// Band rendering Functions
+// -----------------------------------------------------------------------
+
+bool gslc_DrvBandStart(gslc_tsGui* pGui,gslc_tsRect rBand)
+{
+  #if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+  if (!m_drvBand.Start(rBand,pGui->nDispW,pGui->nDispH)) {
+    return false;
+  }
+  m_pDrvGfx = &m_drvBand;
+  return true;
+  #else
+  (void)pGui; // Unused
+  (void)rBand; // Unused
+  return false;
+  #endif
+}
+
+bool gslc_DrvBandFlush(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  #if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+  if (m_pDrvGfx != &m_drvBand) {
+    return false;
+  }
+  m_pDrvGfx = &m_disp;
+  // Push the band with a single address window transfer
+  gslc_tsRect rBand = m_drvBand.GetRect();
+  m_disp.drawRGBBitmap(rBand.x,rBand.y,m_drvBand.GetBuf(),rBand.w,rBand.h);
+  return true;
+  #else
+  return false;
+  #endif
+}
+
+
 // -----------------------------------------------------------------------
 // Graphics Primitives Functions
 // -----------------------------------------------------------------------
@@ -1509,7 +1740,7 @@ inline void gslc_DrvDrawPoint_base(int16_t nX, int16_t nY, uint16_t nColRaw)
     m_disp.setColor(nColRaw);
     m_disp.putPixel(nX,nY);
   #else
-    m_disp.drawPixel(nX,nY,nColRaw);
+    DRV_GFX.drawPixel(nX,nY,nColRaw);
   #endif
 }
 
@@ -1519,7 +1750,7 @@ inline void gslc_DrvDrawLine_base(int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY
     m_disp.setColor(nColRaw);
     m_disp.drawLine(nX0,nY0,nX1,nY1);
   #else
-    m_disp.drawLine(nX0,nY0,nX1,nY1,nColRaw);
+    DRV_GFX.drawLine(nX0,nY0,nX1,nY1,nColRaw);
   #endif	
 }
 
@@ -1566,7 +1797,7 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
     m_disp.fillRect(rRect.x,rRect.y,rRect.x+rRect.w-1,rRect.y+rRect.h-1,nColRaw);
   #else
     //NOTE:tested for ILI9225_DUE
-    m_disp.fillRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
+    DRV_GFX.fillRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
   #endif
   return true;
 }
@@ -1575,10 +1806,13 @@ bool gslc_DrvDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadiu
 {
   (void)pGui; // Unused
 #if (DRV_HAS_DRAW_RECT_ROUND_FILL)
-  // TODO: Support GSLC_CLIP_EN
-  // - Would need to determine how to clip the rounded corners
+#if (GSLC_CLIP_EN)
+  // Perform clipping
+  // - Partially visible rounded rects are drawn with clipped primitives
+  if (gslc_ClipDrawFillRoundRect(pGui,rRect,nRadius,nCol)) { return true; }
+#endif
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.fillRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
+  DRV_GFX.fillRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
 #else
   (void)rRect; // Unused
   (void)nRadius; // Unused
@@ -1630,7 +1864,7 @@ bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   #elif defined(DRV_DISP_ADAGFX_RA8876) || defined(DRV_DISP_ADAGFX_RA8876_GV)
     m_disp.drawRect(rRect.x,rRect.y,rRect.x+rRect.w-1,rRect.y+rRect.h-1,nColRaw);
   #else
-    m_disp.drawRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
+    DRV_GFX.drawRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
   #endif
 #endif
   return true;
@@ -1642,9 +1876,12 @@ bool gslc_DrvDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadi
 #if (DRV_HAS_DRAW_RECT_ROUND_FRAME)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
 
-  // TODO: Support GSLC_CLIP_EN
-  // - Would need to determine how to clip the rounded corners
-  m_disp.drawRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
+#if (GSLC_CLIP_EN)
+  // Perform clipping
+  // - Partially visible rounded rects are drawn with clipped primitives
+  if (gslc_ClipDrawFrameRoundRect(pGui,rRect,nRadius,nCol)) { return true; }
+#endif
+  DRV_GFX.drawRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
 #else
   (void)rRect; // Unused
   (void)nRadius; // Unused
@@ -1673,12 +1910,14 @@ bool gslc_DrvDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16
 {
   (void)pGui;
 #if (GSLC_CLIP_EN)
-  // TODO
+  // Perform clipping
+  // - Partially visible circles are drawn with clipped primitives
+  if (gslc_ClipDrawFrameCircle(pGui,nMidX,nMidY,nRadius,nCol)) { return true; }
 #endif
 
 #if (DRV_HAS_DRAW_CIRCLE_FRAME)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.drawCircle(nMidX,nMidY,nRadius,nColRaw);
+  DRV_GFX.drawCircle(nMidX,nMidY,nRadius,nColRaw);
 #else
   (void)nMidX; // Unused
   (void)nMidY; // Unused
@@ -1692,12 +1931,14 @@ bool gslc_DrvDrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_
 {
   (void)pGui; // Unused
 #if (GSLC_CLIP_EN)
-  // TODO
+  // Perform clipping
+  // - Partially visible circles are drawn with clipped primitives
+  if (gslc_ClipDrawFillCircle(pGui,nMidX,nMidY,nRadius,nCol)) { return true; }
 #endif
 
 #if (DRV_HAS_DRAW_CIRCLE_FILL)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.fillCircle(nMidX,nMidY,nRadius,nColRaw);
+  DRV_GFX.fillCircle(nMidX,nMidY,nRadius,nColRaw);
 #else
   (void)nMidX; // Unused
   (void)nMidY; // Unused
@@ -1715,11 +1956,13 @@ bool gslc_DrvDrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 #if (DRV_HAS_DRAW_TRI_FRAME)
 
 #if (GSLC_CLIP_EN)
-  // TODO
+  // Perform clipping
+  // - Partially visible triangles are drawn with clipped primitives
+  if (gslc_ClipDrawFrameTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol)) { return true; }
 #endif
 
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.drawTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
+  DRV_GFX.drawTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
 #else
   (void)nX0; // Unused
   (void)nY0; // Unused
@@ -1737,11 +1980,13 @@ bool gslc_DrvDrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 #if (DRV_HAS_DRAW_TRI_FILL)
 
 #if (GSLC_CLIP_EN)
-  // TODO
+  // Perform clipping
+  // - Partially visible triangles are drawn with clipped primitives
+  if (gslc_ClipDrawFillTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol)) { return true; }
 #endif
 
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.fillTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
+  DRV_GFX.fillTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
 #else
   (void)nX0; // Unused
   (void)nY0; // Unused
@@ -1814,9 +2059,23 @@ void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,
 }
 // ----- REFERENCE CODE end
 
+#if (DRV_HAS_DRAW_BMP_MEM)
+// Push a run of raw pixels (from RAM) into a single display row
+// - This uses a single address window transfer in the library
+inline void gslc_DrvDrawBmpRun_base(int16_t nX, int16_t nY, uint16_t* pnRun, uint16_t nLen)
+{
+  #if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+  if (m_pDrvGfx == &m_drvBand) {
+    m_drvBand.drawRGBBitmap(nX,nY,pnRun,nLen,1);
+    return;
+  }
+  #endif
+  m_disp.drawRGBBitmap(nX,nY,pnRun,nLen,1);
+}
+#endif
+
 void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem)
 {
-  // AdaFruit GFX doesn't have a routine for this so we output pixel by pixel
   const uint16_t* pImage = (const uint16_t*)pBitmap;
   int16_t h, w;
   if (bProgMem) {
@@ -1829,197 +2088,159 @@ void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,cons
   #if defined(DBG_DRIVER)
   GSLC_DEBUG_PRINT("DBG: DrvDrawBmp24FromMem() w=%d h=%d\n", w, h);
   #endif
-  #if (DRV_HAS_DRAW_BMP_MEM)
-  if (!bProgMem) {
+  // Determine the visible region of the image
+  gslc_tsRect rVis = { 0, 0, (uint16_t)w, (uint16_t)h };
+  #if (GSLC_CLIP_EN)
+  if (!gslc_ClipImgRect(pGui,nDstX,nDstY,w,h,&rVis)) {
+    return;
+  }
+  #endif
+  #if (DRV_HAS_DRAW_BMP_MEM) && !(GSLC_BMP_TRANS_EN)
+  // The bulk transfer doesn't support clipping, so it is only
+  // used when the image is entirely visible
+  if ((!bProgMem) && (rVis.w == (uint16_t)w) && (rVis.h == (uint16_t)h)) {
+    #if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+    if (m_pDrvGfx == &m_drvBand) {
+      m_drvBand.drawRGBBitmap(nDstX, nDstY, pImage, w, h);
+      return;
+    }
+    #endif
     m_disp.drawRGBBitmap(nDstX, nDstY, (uint16_t*) pImage,w, h); 
     return;
   }
   #endif
+
+  // If transparency is enabled, convert the transparent color once
+  bool     bTransEn = (GSLC_BMP_TRANS_EN) ? true : false;
+  uint16_t nTransRaw = gslc_DrvAdaptColorToRaw(pGui->sTransCol);
+
   int row, col;
   uint16_t nColRaw;
-  for (row=0; row<h; row++) { // For each scanline...
-    for (col=0; col<w; col++) { // For each pixel...
+  const uint16_t* pRow;
+  #if (DRV_HAS_DRAW_BMP_MEM)
+  // Each row is streamed in runs of opaque pixels
+  // - The pixels are copied into a line buffer (as flash memory
+  //   can't be passed to the library) and each run is then pushed
+  //   to the display in a single transfer
+  uint16_t anRunBuf[GSLC_BMP_ROW_BUF_LEN];
+  uint16_t nRunLen;
+  #endif
+  for (row=rVis.y; row<rVis.y+rVis.h; row++) { // For each scanline...
+    pRow = pImage + (int32_t)row*w + rVis.x;
+    #if (DRV_HAS_DRAW_BMP_MEM)
+    nRunLen = 0;
+    #endif
+    for (col=rVis.x; col<rVis.x+rVis.w; col++) { // For each pixel...
 
       // Fetch the requested pixel value
       if (bProgMem) {
         // To read from Flash Memory, pgm_read_XXX is required.
         // Since image is stored as uint16_t, pgm_read_word is used as it uses 16bit address
-        nColRaw = pgm_read_word(pImage++);
+        nColRaw = pgm_read_word(pRow++);
       } else {
-        nColRaw = *(pImage++);
+        nColRaw = *(pRow++);
       }
 
-      // If transparency is enabled, check to see if pixel should be masked
-      bool bDrawBit = true;
-      if (GSLC_BMP_TRANS_EN) {
-        uint16_t nTransRaw = gslc_DrvAdaptColorToRaw(pGui->sTransCol);
-        if (nColRaw == nTransRaw) {
-          bDrawBit = false;
+      // Skip the pixel if it is masked by transparency
+      if ((bTransEn) && (nColRaw == nTransRaw)) {
+        #if (DRV_HAS_DRAW_BMP_MEM)
+        // End the current run
+        if (nRunLen > 0) {
+          gslc_DrvDrawBmpRun_base(nDstX+col-nRunLen, nDstY+row, anRunBuf, nRunLen);
+          nRunLen = 0;
         }
+        #endif
+        continue;
       }
 
-      // Draw the pixel if not masked
-      if (bDrawBit) {
-        gslc_DrvDrawPoint_base(nDstX+col, nDstY+row, nColRaw);
+      #if (DRV_HAS_DRAW_BMP_MEM)
+      // Append the pixel to the current run
+      anRunBuf[nRunLen++] = nColRaw;
+      if (nRunLen == GSLC_BMP_ROW_BUF_LEN) {
+        gslc_DrvDrawBmpRun_base(nDstX+col+1-nRunLen, nDstY+row, anRunBuf, nRunLen);
+        nRunLen = 0;
       }
+      #else
+      gslc_DrvDrawPoint_base(nDstX+col, nDstY+row, nColRaw);
+      #endif
     } // end pixel
+
+    #if (DRV_HAS_DRAW_BMP_MEM)
+    // Flush the remainder of the row
+    if (nRunLen > 0) {
+      gslc_DrvDrawBmpRun_base(nDstX+col-nRunLen, nDstY+row, anRunBuf, nRunLen);
+    }
+    #endif
+  }
+}
+
+// Push a run of pixels into a single display row
+// - The run is converted to raw colors and pushed with a single address window transfer where
+//   the library supports it
+bool gslc_DrvDrawRow(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nLen,const gslc_tsColor* pasCol)
+{
+  (void)pGui; // Unused
+  uint16_t anRowBuf[GSLC_BMP_ROW_BUF_LEN];
+  uint16_t nChunk,nInd;
+  while (nLen > 0) {
+    nChunk = (nLen > GSLC_BMP_ROW_BUF_LEN) ? GSLC_BMP_ROW_BUF_LEN : nLen;
+    for (nInd=0;nInd<nChunk;nInd++) {
+      anRowBuf[nInd] = gslc_DrvAdaptColorToRaw(pasCol[nInd]);
+    }
+    #if (DRV_HAS_DRAW_BMP_MEM)
+    gslc_DrvDrawBmpRun_base(nX,nY,anRowBuf,nChunk);
+    #else
+    for (nInd=0;nInd<nChunk;nInd++) {
+      gslc_DrvDrawPoint_base(nX+nInd,nY,anRowBuf[nInd]);
+    }
+    #endif
+    nX     += nChunk;
+    pasCol += nChunk;
+    nLen   -= nChunk;
   }
+  return true;
 }
 
 #if (GSLC_SD_EN)
-// ----- REFERENCE CODE begin
-// The following code was based upon the following reference code but modified to
-// adapt for use in GUIslice.
-//
-//   URL:              https://github.com/adafruit/Adafruit_ILI9341/blob/master/examples/spitftbitmap/spitftbitmap.ino
-//   Original author:  Adafruit
-//   Function:         bmpDraw()
-
-// These read 16- and 32-bit types from the SD card file.
-// BMP data is stored little-endian, Arduino is little-endian too.
-// May need to reverse subscript order if porting elsewhere.
-uint16_t gslc_DrvRead16SD(File &f) {
-  uint16_t result;
-  ((uint8_t *)&result)[0] = f.read(); // LSB
-  ((uint8_t *)&result)[1] = f.read(); // MSB
-  return result;
+// BMP stream read callback for a file on SD card
+uint16_t gslc_DrvReadSD(void* pvStream,uint8_t* pBuf,uint16_t nLen)
+{
+  File* pFile = (File*)pvStream;
+  return (uint16_t)pFile->read(pBuf,nLen);
 }
 
-uint32_t gslc_DrvRead32SD(File &f) {
-  uint32_t result;
-  ((uint8_t *)&result)[0] = f.read(); // LSB
-  ((uint8_t *)&result)[1] = f.read();
-  ((uint8_t *)&result)[2] = f.read();
-  ((uint8_t *)&result)[3] = f.read(); // MSB
-  return result;
+// BMP stream seek callback for a file on SD card
+// - The seek is skipped if the file is already positioned
+//   (avoids a lot of cluster math in the SD library)
+bool gslc_DrvSeekSD(void* pvStream,uint32_t nPos)
+{
+  File* pFile = (File*)pvStream;
+  if (pFile->position() == nPos) {
+    return true;
+  }
+  return pFile->seek(nPos);
 }
 
 void gslc_DrvDrawBmp24FromSD(gslc_tsGui* pGui,const char *filename, uint16_t x, uint16_t y)
 {
-  File     bmpFile;
-  int      bmpWidth, bmpHeight;   // W+H in pixels
-  uint8_t  bmpDepth;              // Bit depth (currently must be 24)
-  uint32_t bmpImageoffset;        // Start of image data in file
-  uint32_t rowSize;               // Not always = bmpWidth; may have padding
-  uint8_t  sdbuffer[3*GSLC_SD_BUFFPIXEL]; // pixel buffer (R+G+B per pixel)
-  uint8_t  buffidx = sizeof(sdbuffer); // Current position in sdbuffer
-  boolean  goodBmp = false;       // Set to true on valid header parse
-  boolean  flip    = true;        // BMP is stored bottom-to-top
-  int      w, h, row, col;
-  uint8_t  r, g, b;
-  uint32_t pos = 0, startTime = millis();
-  (void)startTime; // Unused
-
-  if((x >= pGui->nDispW) || (y >= pGui->nDispH)) return;
-
-  //Serial.println();
-  //Serial.print("Loading image '");
-  //Serial.print(filename);
-  //Serial.println('\'');
+  File bmpFile;
 
   // Open requested file on SD card
   if ((bmpFile = SD.open(filename)) == 0) {
     GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() file not found [%s]",filename);
     return;
   }
-  // Parse BMP header
-  if(gslc_DrvRead16SD(bmpFile) == 0x4D42) { // BMP signature
-    uint32_t nFileSize = gslc_DrvRead32SD(bmpFile);
-    (void)nFileSize; // Unused
-    //Serial.print("File size: "); Serial.println(nFileSize);
-    (void)gslc_DrvRead32SD(bmpFile); // Read & ignore creator bytes
-    bmpImageoffset = gslc_DrvRead32SD(bmpFile); // Start of image data
-    //Serial.print("Image Offset: "); Serial.println(bmpImageoffset, DEC);
-    // Read DIB header
-    uint32_t nHdrSize = gslc_DrvRead32SD(bmpFile);
-    (void)nHdrSize; // Unused
-    //Serial.print("Header size: "); Serial.println(nHdrSize);
-    bmpWidth  = gslc_DrvRead32SD(bmpFile);
-    bmpHeight = gslc_DrvRead32SD(bmpFile);
-    if(gslc_DrvRead16SD(bmpFile) == 1) { // # planes -- must be '1'
-      bmpDepth = gslc_DrvRead16SD(bmpFile); // bits per pixel
-      //Serial.print("Bit Depth: "); Serial.println(bmpDepth);
-      if((bmpDepth == 24) && (gslc_DrvRead32SD(bmpFile) == 0)) { // 0 = uncompressed
-        goodBmp = true; // Supported BMP format -- proceed!
-        //Serial.print("Image size: ");
-        //Serial.print(bmpWidth);
-        //Serial.print('x');
-        //Serial.println(bmpHeight);
-
-        // BMP rows are padded (if needed) to 4-byte boundary
-        rowSize = (bmpWidth * 3 + 3) & ~3;
-
-        // If bmpHeight is negative, image is in top-down order.
-        // This is not canon but has been observed in the wild.
-        if(bmpHeight < 0) {
-          bmpHeight = -bmpHeight;
-          flip      = false;
-        }
 
-        // Crop area to be loaded
-        w = bmpWidth;
-        h = bmpHeight;
-        if((x+w-1) >= pGui->nDispW) w = pGui->nDispW  - x;
-        if((y+h-1) >= pGui->nDispH) h = pGui->nDispH - y;
-
-        // Set TFT address window to clipped image bounds
-        //xxx tft.setAddrWindow(x, y, x+w-1, y+h-1);
-
-        for (row=0; row<h; row++) { // For each scanline...
-
-          // Seek to start of scan line.  It might seem labor-
-          // intensive to be doing this on every line, but this
-          // method covers a lot of gritty details like cropping
-          // and scanline padding.  Also, the seek only takes
-          // place if the file position actually needs to change
-          // (avoids a lot of cluster math in SD library).
-          if(flip) // Bitmap is stored bottom-to-top order (normal BMP)
-            pos = bmpImageoffset + (bmpHeight - 1 - row) * rowSize;
-          else     // Bitmap is stored top-to-bottom
-            pos = bmpImageoffset + row * rowSize;
-          if(bmpFile.position() != pos) { // Need seek?
-            bmpFile.seek(pos);
-            buffidx = sizeof(sdbuffer); // Force buffer reload
-          }
-
-          for (col=0; col<w; col++) { // For each pixel...
-            // Time to read more pixel data?
-            if (buffidx >= sizeof(sdbuffer)) { // Indeed
-              bmpFile.read(sdbuffer, sizeof(sdbuffer));
-              buffidx = 0; // Set index to beginning
-            }
-
-            // Convert pixel from BMP to TFT format, push to display
-            b = sdbuffer[buffidx++];
-            g = sdbuffer[buffidx++];
-            r = sdbuffer[buffidx++];
-            //xxx tft.pushColor(tft.Color565(r,g,b));
-            gslc_tsColor nCol = (gslc_tsColor){r,g,b};
-            bool bDrawBit = true;
-            if (GSLC_BMP_TRANS_EN) {
-              gslc_tsColor nColTrans = pGui->sTransCol;
-              if ((nCol.r == nColTrans.r) && (nCol.g == nColTrans.g) && (nCol.b == nColTrans.b)) {
-                bDrawBit = false;
-              }
-            }
-            if (bDrawBit) {
-              gslc_DrvDrawPoint(pGui,x+col,y+row,nCol);
-            }
-
-          } // end pixel
-        } // end scanline
-        //Serial.print("Loaded in ");
-        //Serial.print(millis() - startTime);
-        //Serial.println(" ms");
-      } // end goodBmp
-    }
-  }
-  bmpFile.close();
-  if(!goodBmp) {
+  // Stream the visible portion of the image to the display
+  gslc_tsBmpReader sReader;
+  sReader.pvStream  = (void*)&bmpFile;
+  sReader.pfuncRead = &gslc_DrvReadSD;
+  sReader.pfuncSeek = &gslc_DrvSeekSD;
+  if (!gslc_BmpDraw(pGui,&sReader,(int16_t)x,(int16_t)y)) {
     GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() BMP format unknown [%s]",filename);
   }
+  bmpFile.close();
 }
-// ----- REFERENCE CODE end
 #endif // GSLC_SD_EN
 
 
@@ -2112,8 +2333,12 @@ void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
       //       that API doesn't support clipping. Since
       //       we may be redrawing the page with a clipping
       //       region enabled, it is important that we don't
-      //       redraw the entire screen.
+      //       redraw the entire screen. Only the current
+      //       clipping region is filled.
       gslc_tsRect rRect = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+      if (!gslc_ClipRect(&pDriver->rClipRect, &rRect)) {
+        return;
+      }
       gslc_DrvDrawFillRect(pGui, rRect, pDriver->nColBkgnd);
     } else {
       // An image should be loaded
@@ -137,6 +137,11 @@ extern "C" {
 #define DRV_HAS_DRAW_TRI_FILL          1 ///< Support gslc_DrvDrawFillTriangle()
 #define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
 #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
+#define DRV_HAS_DRAW_ROW               1 ///< Support gslc_DrvDrawRow()
+#define DRV_HAS_BAND                   0 ///< Support gslc_DrvBandStart() / gslc_DrvBandFlush()
+#define DRV_HAS_COPY_RECT              0 ///< Support gslc_DrvCopyRect()
+#define DRV_HAS_FRAME_LOCK             0 ///< Support gslc_DrvFrameLock() / gslc_DrvFrameUnlock()
+#define DRV_HAS_PAGE_SNAP              0 ///< Support gslc_DrvPageSnapSave() / gslc_DrvPageSnapRestore()
 
 #define DRV_OVERRIDE_TXT_ALIGN         0 ///< Driver provides text alignment
 
@@ -186,10 +191,13 @@ extern "C" {
   #define DRV_HAS_DRAW_RECT_ROUND_FILL   0
 
 
-#elif defined(DRV_DISP_ADAGFX_ILI9341)
-  // BLIT support in library
+#elif defined(DRV_DISP_ADAGFX_ILI9341) || defined(DRV_DISP_ADAGFX_ST7735) || defined(DRV_DISP_ADAGFX_HX8357)
+  // BLIT support in library (Adafruit_SPITFT drawRGBBitmap)
   #undef  DRV_HAS_DRAW_BMP_MEM
   #define DRV_HAS_DRAW_BMP_MEM           1
+  // Band renderer (band buffer pushed with drawRGBBitmap)
+  #undef  DRV_HAS_BAND
+  #define DRV_HAS_BAND                   1
 #endif
 
 
@@ -465,6 +473,35 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
 void gslc_DrvPageFlipNow(gslc_tsGui* pGui);
 
 
+// -----------------------------------------------------------------------
+// Band rendering Functions
+// -----------------------------------------------------------------------
+
+///
+/// Start composing a band of the display in the band buffer
+/// - All drawing is redirected to the band buffer until
+///   gslc_DrvBandFlush() is called
+/// - Only supported on displays that define DRV_HAS_BAND
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rBand:       Region of the display covered by the band
+///                          (at most GSLC_BAND_H lines)
+///
+/// \return true if success, false if the band buffer is unavailable
+///
+bool gslc_DrvBandStart(gslc_tsGui* pGui,gslc_tsRect rBand);
+
+///
+/// Push the completed band to the display in a single transfer
+/// and end the redirection started by gslc_DrvBandStart()
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return true if success, false if no band was started
+///
+bool gslc_DrvBandFlush(gslc_tsGui* pGui);
+
+
 // -----------------------------------------------------------------------
 // Graphics Primitives Functions
 // -----------------------------------------------------------------------
@@ -671,7 +708,44 @@ void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY, cons
 void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem);
 
 ///
-/// Draw a color 24-bit depth bitmap from SD card
+/// Draw a horizontal run of pixels
+/// - Used by the BMP streaming decoder (gslc_BmpDraw) to push the
+///   visible portion of each scanline
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of the first pixel
+/// \param[in]  nY:          Y coordinate of the row
+/// \param[in]  nLen:        Number of pixels in the run
+/// \param[in]  pasCol:      Array of pixel colors
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawRow(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nLen,const gslc_tsColor* pasCol);
+
+///
+/// BMP stream read callback for a file on SD card
+///
+/// \param[in]  pvStream:    Void pointer to File
+/// \param[out] pBuf:        Buffer to read into
+/// \param[in]  nLen:        Number of bytes to read
+///
+/// \return Number of bytes read
+///
+uint16_t gslc_DrvReadSD(void* pvStream,uint8_t* pBuf,uint16_t nLen);
+
+///
+/// BMP stream seek callback for a file on SD card
+///
+/// \param[in]  pvStream:    Void pointer to File
+/// \param[in]  nPos:        Absolute position in file
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSeekSD(void* pvStream,uint32_t nPos);
+
+///
+/// Draw a BMP image (16, 24 or 32-bit depth) from SD card
+/// - The image is decoded by gslc_BmpDraw()
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  filename:    Filename on SD card (usually in form "/pic.bmp")
@@ -0,0 +1,1257 @@
+// =======================================================================
+// GUIslice library (driver layer for LINUX framebuffer)
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2020 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+/// \file GUIslice_drv_linuxfb.c
+
+// Compiler guard for requested driver
+#include "GUIslice_config.h" // Sets DRV_DISP_*
+#if defined(DRV_DISP_LINUXFB)
+
+// =======================================================================
+// Driver Layer for LINUX framebuffer device
+// =======================================================================
+
+
+// GUIslice library
+#include "GUIslice_drv_linuxfb.h"
+
+#include <stdio.h>
+#include <stdlib.h>     // For getenv(), malloc()
+#include <string.h>
+#include <fcntl.h>      // For open()
+#include <unistd.h>     // For close(), ftruncate()
+#include <sys/ioctl.h>
+#include <sys/mman.h>   // For mmap()
+#include <sys/stat.h>
+#include <linux/fb.h>
+
+// Define driver names
+const char* m_acDrvDisp = "LINUXFB";
+
+#if defined(DRV_TOUCH_TSLIB)
+  const char* m_acDrvTouch = "TSLIB";
+#else
+  const char* m_acDrvTouch = "NONE";
+#endif
+
+// Header of a page snapshot
+// - The rows of the saved region (in the framebuffer layout)
+//   follow the header
+typedef struct {
+  gslc_tsRect rSnap;    // Region of the framebuffer held in the snapshot
+  uint32_t    nSize;    // Storage allocated for the rows (in bytes)
+} gslc_tsDrvSnap;
+
+// Built-in font
+// - Classic 5x7 font covering printable ASCII (0x20..0x7E)
+// - Each character is 5 columns, with the LSB at the top row.
+//   Bit 7 is used by the descenders.
+// - Characters are drawn in a 6x8 cell (multiplied by the text scale)
+#define DRV_LINUXFB_FONT_FIRST  0x20
+#define DRV_LINUXFB_FONT_LAST   0x7E
+#define DRV_LINUXFB_FONT_COLS   5
+#define DRV_LINUXFB_FONT_CELL_W 6
+#define DRV_LINUXFB_FONT_CELL_H 8
+
+static const uint8_t m_anFont5x7[] = {
+  0x00,0x00,0x00,0x00,0x00, // ' '
+  0x00,0x00,0x5F,0x00,0x00, // '!'
+  0x00,0x07,0x00,0x07,0x00, // '"'
+  0x14,0x7F,0x14,0x7F,0x14, // '#'
+  0x24,0x2A,0x7F,0x2A,0x12, // '$'
+  0x23,0x13,0x08,0x64,0x62, // '%'
+  0x36,0x49,0x56,0x20,0x50, // '&'
+  0x00,0x08,0x07,0x03,0x00, // '''
+  0x00,0x1C,0x22,0x41,0x00, // '('
+  0x00,0x41,0x22,0x1C,0x00, // ')'
+  0x2A,0x1C,0x7F,0x1C,0x2A, // '*'
+  0x08,0x08,0x3E,0x08,0x08, // '+'
+  0x00,0x80,0x70,0x30,0x00, // ','
+  0x08,0x08,0x08,0x08,0x08, // '-'
+  0x00,0x00,0x60,0x60,0x00, // '.'
+  0x20,0x10,0x08,0x04,0x02, // '/'
+  0x3E,0x51,0x49,0x45,0x3E, // '0'
+  0x00,0x42,0x7F,0x40,0x00, // '1'
+  0x72,0x49,0x49,0x49,0x46, // '2'
+  0x21,0x41,0x49,0x4D,0x33, // '3'
+  0x18,0x14,0x12,0x7F,0x10, // '4'
+  0x27,0x45,0x45,0x45,0x39, // '5'
+  0x3C,0x4A,0x49,0x49,0x31, // '6'
+  0x41,0x21,0x11,0x09,0x07, // '7'
+  0x36,0x49,0x49,0x49,0x36, // '8'
+  0x46,0x49,0x49,0x29,0x1E, // '9'
+  0x00,0x00,0x14,0x00,0x00, // ':'
+  0x00,0x40,0x34,0x00,0x00, // ';'
+  0x00,0x08,0x14,0x22,0x41, // '<'
+  0x14,0x14,0x14,0x14,0x14, // '='
+  0x00,0x41,0x22,0x14,0x08, // '>'
+  0x02,0x01,0x59,0x09,0x06, // '?'
+  0x3E,0x41,0x5D,0x59,0x4E, // '@'
+  0x7C,0x12,0x11,0x12,0x7C, // 'A'
+  0x7F,0x49,0x49,0x49,0x36, // 'B'
+  0x3E,0x41,0x41,0x41,0x22, // 'C'
+  0x7F,0x41,0x41,0x41,0x3E, // 'D'
+  0x7F,0x49,0x49,0x49,0x41, // 'E'
+  0x7F,0x09,0x09,0x09,0x01, // 'F'
+  0x3E,0x41,0x41,0x51,0x73, // 'G'
+  0x7F,0x08,0x08,0x08,0x7F, // 'H'
+  0x00,0x41,0x7F,0x41,0x00, // 'I'
+  0x20,0x40,0x41,0x3F,0x01, // 'J'
+  0x7F,0x08,0x14,0x22,0x41, // 'K'
+  0x7F,0x40,0x40,0x40,0x40, // 'L'
+  0x7F,0x02,0x1C,0x02,0x7F, // 'M'
+  0x7F,0x04,0x08,0x10,0x7F, // 'N'
+  0x3E,0x41,0x41,0x41,0x3E, // 'O'
+  0x7F,0x09,0x09,0x09,0x06, // 'P'
+  0x3E,0x41,0x51,0x21,0x5E, // 'Q'
+  0x7F,0x09,0x19,0x29,0x46, // 'R'
+  0x26,0x49,0x49,0x49,0x32, // 'S'
+  0x03,0x01,0x7F,0x01,0x03, // 'T'
+  0x3F,0x40,0x40,0x40,0x3F, // 'U'
+  0x1F,0x20,0x40,0x20,0x1F, // 'V'
+  0x3F,0x40,0x38,0x40,0x3F, // 'W'
+  0x63,0x14,0x08,0x14,0x63, // 'X'
+  0x03,0x04,0x78,0x04,0x03, // 'Y'
+  0x61,0x59,0x49,0x4D,0x43, // 'Z'
+  0x00,0x7F,0x41,0x41,0x41, // '['
+  0x02,0x04,0x08,0x10,0x20, // '\'
+  0x00,0x41,0x41,0x41,0x7F, // ']'
+  0x04,0x02,0x01,0x02,0x04, // '^'
+  0x40,0x40,0x40,0x40,0x40, // '_'
+  0x00,0x03,0x07,0x08,0x00, // '`'
+  0x20,0x54,0x54,0x78,0x40, // 'a'
+  0x7F,0x28,0x44,0x44,0x38, // 'b'
+  0x38,0x44,0x44,0x44,0x28, // 'c'
+  0x38,0x44,0x44,0x28,0x7F, // 'd'
+  0x38,0x54,0x54,0x54,0x18, // 'e'
+  0x00,0x08,0x7E,0x09,0x02, // 'f'
+  0x18,0xA4,0xA4,0x9C,0x78, // 'g'
+  0x7F,0x08,0x04,0x04,0x78, // 'h'
+  0x00,0x44,0x7D,0x40,0x00, // 'i'
+  0x20,0x40,0x40,0x3D,0x00, // 'j'
+  0x7F,0x10,0x28,0x44,0x00, // 'k'
+  0x00,0x41,0x7F,0x40,0x00, // 'l'
+  0x7C,0x04,0x78,0x04,0x78, // 'm'
+  0x7C,0x08,0x04,0x04,0x78, // 'n'
+  0x38,0x44,0x44,0x44,0x38, // 'o'
+  0xFC,0x18,0x24,0x24,0x18, // 'p'
+  0x18,0x24,0x24,0x18,0xFC, // 'q'
+  0x7C,0x08,0x04,0x04,0x08, // 'r'
+  0x48,0x54,0x54,0x54,0x24, // 's'
+  0x04,0x04,0x3F,0x44,0x24, // 't'
+  0x3C,0x40,0x40,0x20,0x7C, // 'u'
+  0x1C,0x20,0x40,0x20,0x1C, // 'v'
+  0x3C,0x40,0x30,0x40,0x3C, // 'w'
+  0x44,0x28,0x10,0x28,0x44, // 'x'
+  0x4C,0x90,0x90,0x90,0x7C, // 'y'
+  0x44,0x64,0x54,0x4C,0x44, // 'z'
+  0x00,0x08,0x36,0x41,0x00, // '{'
+  0x00,0x00,0x77,0x00,0x00, // '|'
+  0x00,0x41,0x36,0x08,0x00, // '}'
+  0x02,0x01,0x02,0x04,0x02, // '~'
+};
+
+
+// =======================================================================
+// Public APIs to GUIslice core library
+// =======================================================================
+
+// -----------------------------------------------------------------------
+// Configuration Functions
+// -----------------------------------------------------------------------
+
+bool gslc_DrvInit(gslc_tsGui* pGui)
+{
+  // Primary surface definitions
+  pGui->sImgRefBkgnd = gslc_ResetImage();
+
+  if (pGui->pvDriver == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInit(%s) called with NULL driver\n","");
+    return false;
+  }
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  pDriver->nFd        = -1;
+  pDriver->pFbMem     = NULL;
+  pDriver->nFbSize    = 0;
+  pDriver->pDrawBuf   = NULL;
+  pDriver->nColBkgnd  = GSLC_COL_BLACK;
+  #if (DRV_LINUXFB_SHADOW_EN)
+  pDriver->pShadowBuf = NULL;
+  pDriver->rDirty     = (gslc_tsRect){0,0,0,0};
+  #endif
+  #if defined(DRV_TOUCH_TSLIB)
+  pDriver->pTsDev     = NULL;
+  #endif
+
+  // The environment overrides the configured device path
+  const char* pDev = getenv("GSLC_LINUXFB_DEV");
+  #if defined(GSLC_DEV_FB)
+  if ((pDev == NULL) || (pDev[0] == '\0')) {
+    pDev = GSLC_DEV_FB;
+  }
+  #endif
+  if ((pDev == NULL) || (pDev[0] == '\0')) {
+    pDev = DRV_LINUXFB_DEV_DEFAULT;
+  }
+
+  pDriver->nFd = open(pDev,O_RDWR);
+  if (pDriver->nFd < 0) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInit() can't open framebuffer (%s)\n",pDev);
+    return false;
+  }
+  if (!gslc_DrvGetFbInfo(pGui)) {
+    gslc_DrvDestruct(pGui);
+    return false;
+  }
+
+  // A regular file standing in for the device must be large
+  // enough to hold the whole framebuffer before it is mapped
+  struct stat sStat;
+  if ((fstat(pDriver->nFd,&sStat) == 0) && (S_ISREG(sStat.st_mode)) &&
+      ((uint32_t)sStat.st_size < pDriver->nFbSize)) {
+    if (ftruncate(pDriver->nFd,(off_t)pDriver->nFbSize) != 0) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvInit() can't resize framebuffer file (%s)\n",pDev);
+      gslc_DrvDestruct(pGui);
+      return false;
+    }
+  }
+
+  void* pvMem = mmap(NULL,pDriver->nFbSize,PROT_READ|PROT_WRITE,MAP_SHARED,pDriver->nFd,0);
+  if (pvMem == MAP_FAILED) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInit() can't map framebuffer (%s)\n",pDev);
+    gslc_DrvDestruct(pGui);
+    return false;
+  }
+  pDriver->pFbMem   = (uint8_t*)pvMem;
+  pDriver->pDrawBuf = pDriver->pFbMem;
+
+  #if (DRV_LINUXFB_SHADOW_EN)
+  // Start the shadow buffer from the current display contents
+  // so that the first flip only writes what has been drawn
+  pDriver->pShadowBuf = (uint8_t*)malloc(pDriver->nFbSize);
+  if (pDriver->pShadowBuf == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInit() can't allocate shadow buffer (%u bytes)\n",
+      (unsigned)pDriver->nFbSize);
+    gslc_DrvDestruct(pGui);
+    return false;
+  }
+  memcpy(pDriver->pShadowBuf,pDriver->pFbMem,pDriver->nFbSize);
+  pDriver->pDrawBuf = pDriver->pShadowBuf;
+  #endif
+
+  // The framebuffer retains its contents between frames
+  // so partial redraw can be supported
+  pGui->bRedrawPartialEn = true;
+
+  pGui->nRotation   = 0;
+  pGui->nDispW      = pGui->nDisp0W;
+  pGui->nDispH      = pGui->nDisp0H;
+  pGui->nDispDepth  = pDriver->nBytesPP * 8;
+  pDriver->nPixStep = pDriver->nBytesPP;
+
+  gslc_DrvSetClipRect(pGui,NULL);
+
+  #if defined(GSLC_ROTATE)
+  gslc_DrvRotate(pGui,GSLC_ROTATE);
+  #endif
+
+  return true;
+}
+
+void* gslc_DrvGetDriverDisp(gslc_tsGui* pGui)
+{
+  return (void*)(pGui->pvDriver);
+}
+
+void gslc_DrvDestruct(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver == NULL) {
+    return;
+  }
+  #if (DRV_LINUXFB_SHADOW_EN)
+  if (pDriver->pShadowBuf) {
+    free(pDriver->pShadowBuf);
+    pDriver->pShadowBuf = NULL;
+  }
+  #endif
+  if (pDriver->pFbMem) {
+    munmap(pDriver->pFbMem,pDriver->nFbSize);
+    pDriver->pFbMem = NULL;
+  }
+  pDriver->pDrawBuf = NULL;
+  if (pDriver->nFd >= 0) {
+    close(pDriver->nFd);
+    pDriver->nFd = -1;
+  }
+}
+
+const char* gslc_DrvGetNameDisp(gslc_tsGui* pGui)
+{
+  return m_acDrvDisp;
+}
+
+const char* gslc_DrvGetNameTouch(gslc_tsGui* pGui)
+{
+  return m_acDrvTouch;
+}
+
+// -----------------------------------------------------------------------
+// Image/surface handling Functions
+// -----------------------------------------------------------------------
+
+void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
+{
+  // Images are not preloaded. Instead they are decoded
+  // from their source at the time of drawing.
+  return NULL;
+}
+
+
+bool gslc_DrvSetBkgndImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
+{
+  // Dispose of previous background
+  if (pGui->sImgRefBkgnd.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pGui->sImgRefBkgnd.pvImgRaw);
+    pGui->sImgRefBkgnd = gslc_ResetImage();
+  }
+  pGui->sImgRefBkgnd = sImgRef;
+  pGui->sImgRefBkgnd.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  return true;
+}
+
+
+bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol)
+{
+  if (pGui->pvDriver) {
+    gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+    pDriver->nColBkgnd = nCol;
+  }
+  // Dispose of any background image so that the color is used
+  pGui->sImgRefBkgnd = gslc_ResetImage();
+  return true;
+}
+
+
+bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
+{
+  // Dispose of previous image, if any
+  if (pElem->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pElem->sImgRefNorm.pvImgRaw);
+    pElem->sImgRefNorm = gslc_ResetImage();
+  }
+  pElem->sImgRefNorm = sImgRef;
+  pElem->sImgRefNorm.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  return true;
+}
+
+
+bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
+{
+  // Dispose of previous image, if any
+  if (pElem->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pElem->sImgRefGlow.pvImgRaw);
+    pElem->sImgRefGlow = gslc_ResetImage();
+  }
+  pElem->sImgRefGlow = sImgRef;
+  pElem->sImgRefGlow.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  return true;
+}
+
+
+void gslc_DrvImageDestruct(void* pvImg)
+{
+  // Nothing to release as images are not preloaded
+}
+
+bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  // The clipping region is always constrained to the display
+  // so that the drawing routines only need a single test
+  gslc_tsRect rScreen = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+  if (pRect == NULL) {
+    pDriver->rClipRect = rScreen;
+  } else {
+    pDriver->rClipRect = *pRect;
+    if (!gslc_ClipRect(&rScreen,&pDriver->rClipRect)) {
+      pDriver->rClipRect = (gslc_tsRect) { 0, 0, 0, 0 };
+    }
+  }
+  return true;
+}
+
+
+// -----------------------------------------------------------------------
+// Font handling Functions
+// -----------------------------------------------------------------------
+
+const void* gslc_DrvFontAdd(gslc_teFontRefType eFontRefType,const void* pvFontRef,uint16_t nFontSz)
+{
+  // All fonts use the built-in font, so the reference is
+  // only retained to mark the font as valid. The scale is
+  // derived from the font size when drawing.
+  if (pvFontRef == NULL) {
+    // Permit a NULL reference to select the built-in font,
+    // as done in the Arduino drivers
+    return (const void*)m_anFont5x7;
+  }
+  return pvFontRef;
+}
+
+void gslc_DrvFontsDestruct(gslc_tsGui* pGui)
+{
+  // Nothing to release
+}
+
+uint8_t gslc_DrvFontScale(gslc_tsFont* pFont)
+{
+  uint16_t nScale;
+  if (pFont->eFontRefType == GSLC_FONTREF_FNAME) {
+    nScale = (pFont->nSize + 4) / DRV_LINUXFB_FONT_CELL_H;
+  } else {
+    nScale = pFont->nSize;
+  }
+  if (nScale < 1) { nScale = 1; }
+  if (nScale > 8) { nScale = 8; }
+  return (uint8_t)nScale;
+}
+
+bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,
+        int16_t* pnTxtX,int16_t* pnTxtY,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH)
+{
+  if ((pFont == NULL) || (pStr == NULL)) { return false; }
+  uint8_t   nScale = gslc_DrvFontScale(pFont);
+  uint16_t  nCols = 0;
+  uint16_t  nColsMax = 0;
+  uint16_t  nLines = 1;
+  const char* pCh;
+
+  for (pCh=pStr;*pCh;pCh++) {
+    if (*pCh == '\n') {
+      nLines++;
+      nCols = 0;
+    } else {
+      nCols++;
+      if (nCols > nColsMax) { nColsMax = nCols; }
+    }
+  }
+  *pnTxtSzW = nColsMax * DRV_LINUXFB_FONT_CELL_W * nScale;
+  *pnTxtSzH = nLines * DRV_LINUXFB_FONT_CELL_H * nScale;
+  // No offset coordinates used
+  *pnTxtX = 0;
+  *pnTxtY = 0;
+  return true;
+}
+
+
+bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt, gslc_tsColor colBg)
+{
+  if ((pGui == NULL) || (pFont == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawTxt(%s) with NULL ptr\n","");
+    return false;
+  }
+  if (pStr == NULL) { return true; }
+
+  uint32_t  nColRaw = gslc_DrvAdaptColorRaw(pGui,colTxt);
+  uint8_t   nScale = gslc_DrvFontScale(pFont);
+  int16_t   nCurX = nTxtX;
+  int16_t   nCurY = nTxtY;
+  uint8_t   nCh;
+  const uint8_t* pGlyph;
+  uint8_t   nCol,nRow,nBits,nRep;
+  int16_t   nRunStart;
+
+  for (;*pStr;pStr++) {
+    nCh = (uint8_t)*pStr;
+    if (nCh == '\n') {
+      nCurX  = nTxtX;
+      nCurY += DRV_LINUXFB_FONT_CELL_H * nScale;
+      continue;
+    }
+    if ((nCh < DRV_LINUXFB_FONT_FIRST) || (nCh > DRV_LINUXFB_FONT_LAST)) {
+      nCh = '?';
+    }
+    pGlyph = &m_anFont5x7[(nCh - DRV_LINUXFB_FONT_FIRST) * DRV_LINUXFB_FONT_COLS];
+
+    // Draw the glyph a row at a time so that horizontal runs
+    // of set bits become single span fills
+    for (nRow=0;nRow<DRV_LINUXFB_FONT_CELL_H;nRow++) {
+      nRunStart = -1;
+      for (nCol=0;nCol<=DRV_LINUXFB_FONT_COLS;nCol++) {
+        nBits = (nCol < DRV_LINUXFB_FONT_COLS)? pGlyph[nCol] : 0;
+        if (nBits & (1 << nRow)) {
+          if (nRunStart < 0) { nRunStart = nCol; }
+        } else if (nRunStart >= 0) {
+          for (nRep=0;nRep<nScale;nRep++) {
+            gslc_DrvFillSpanRaw(pGui,nCurX+nRunStart*nScale,nCurY+nRow*nScale+nRep,
+              (nCol-nRunStart)*nScale,nColRaw);
+          }
+          nRunStart = -1;
+        }
+      }
+    }
+    nCurX += DRV_LINUXFB_FONT_CELL_W * nScale;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------
+// Screen Management Functions
+// -----------------------------------------------------------------------
+
+void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
+{
+  #if (DRV_LINUXFB_SHADOW_EN)
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if ((pDriver->pFbMem == NULL) || (pDriver->rDirty.w == 0)) {
+    return;
+  }
+  // Only copy the rows of the changed region
+  gslc_tsRect rDirty  = pDriver->rDirty;
+  uint32_t    nOffset = (uint32_t)rDirty.y*pDriver->nLineLen + (uint32_t)rDirty.x*pDriver->nBytesPP;
+  uint32_t    nRowLen = (uint32_t)rDirty.w*pDriver->nBytesPP;
+  int16_t     nRow;
+  for (nRow=0;nRow<(int16_t)rDirty.h;nRow++) {
+    memcpy(pDriver->pFbMem+nOffset,pDriver->pShadowBuf+nOffset,nRowLen);
+    nOffset += pDriver->nLineLen;
+  }
+  pDriver->rDirty = (gslc_tsRect){0,0,0,0};
+  #else
+  // Drawing is made directly to the display
+  (void)pGui; // Unused
+  #endif // DRV_LINUXFB_SHADOW_EN
+}
+
+
+// -----------------------------------------------------------------------
+// Page Snapshot Functions
+// -----------------------------------------------------------------------
+
+uint32_t gslc_DrvPageSnapGetSize(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  return (uint32_t)sizeof(gslc_tsDrvSnap) + (uint32_t)rRect.w*rRect.h*pDriver->nBytesPP;
+}
+
+bool gslc_DrvPageSnapSave(gslc_tsGui* pGui,void** ppvSnap,gslc_tsRect rRect)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsDrvSnap* pSnap   = (gslc_tsDrvSnap*)(*ppvSnap);
+  gslc_tsRect     rDisp   = { 0, 0, pGui->nDispW, pGui->nDispH };
+  gslc_tsRect     rFb;
+  uint32_t        nRowLen;
+  uint32_t        nSize;
+  uint32_t        nOffset;
+  uint8_t*        pPixels;
+  int16_t         nRow;
+  if (pDriver->pDrawBuf == NULL) {
+    return false;
+  }
+  if ((rRect.w == 0) || (rRect.h == 0) || (!gslc_ClipRect(&rDisp,&rRect))) {
+    return false;
+  }
+  // The snapshot is taken in the framebuffer layout
+  // so that it is independent of the rotation
+  rFb     = gslc_DrvRectToFb(pGui,rRect);
+  nRowLen = (uint32_t)rFb.w*pDriver->nBytesPP;
+  nSize   = nRowLen*rFb.h;
+  if ((pSnap == NULL) || (pSnap->nSize < nSize)) {
+    pSnap = (gslc_tsDrvSnap*)realloc(pSnap,sizeof(gslc_tsDrvSnap)+nSize);
+    if (pSnap == NULL) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvPageSnapSave() can't allocate %u bytes\n",(unsigned)nSize);
+      return false;
+    }
+    pSnap->nSize = nSize;
+    *ppvSnap = (void*)pSnap;
+  }
+  pSnap->rSnap = rFb;
+  pPixels = (uint8_t*)(pSnap+1);
+  for (nRow=0;nRow<(int16_t)rFb.h;nRow++) {
+    nOffset = (uint32_t)(rFb.y+nRow)*pDriver->nLineLen + (uint32_t)rFb.x*pDriver->nBytesPP;
+    memcpy(pPixels+nRow*nRowLen,pDriver->pDrawBuf+nOffset,nRowLen);
+  }
+  return true;
+}
+
+bool gslc_DrvPageSnapRestore(gslc_tsGui* pGui,void* pvSnap,gslc_tsRect rRect)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsDrvSnap* pSnap   = (gslc_tsDrvSnap*)pvSnap;
+  uint32_t        nSnapRowLen = (uint32_t)pSnap->rSnap.w*pDriver->nBytesPP;
+  gslc_tsRect     rFb;
+  uint32_t        nRowLen;
+  uint32_t        nOffset;
+  uint8_t*        pPixels;
+  int16_t         nRow;
+  bool            bChanged = false;
+  if (pDriver->pDrawBuf == NULL) {
+    return false;
+  }
+  if ((rRect.w == 0) || (rRect.h == 0)) {
+    return true;
+  }
+  // Only the part of the region held in the snapshot is restored
+  rFb = gslc_DrvRectToFb(pGui,rRect);
+  if (!gslc_ClipRect(&(pSnap->rSnap),&rFb)) {
+    return true;
+  }
+  nRowLen = (uint32_t)rFb.w*pDriver->nBytesPP;
+  pPixels = (uint8_t*)(pSnap+1) + (uint32_t)(rFb.y-pSnap->rSnap.y)*nSnapRowLen
+    + (uint32_t)(rFb.x-pSnap->rSnap.x)*pDriver->nBytesPP;
+  for (nRow=0;nRow<(int16_t)rFb.h;nRow++) {
+    // Rows that still match the snapshot are left untouched
+    nOffset = (uint32_t)(rFb.y+nRow)*pDriver->nLineLen + (uint32_t)rFb.x*pDriver->nBytesPP;
+    if (memcmp(pDriver->pDrawBuf+nOffset,pPixels+nRow*nSnapRowLen,nRowLen) == 0) {
+      continue;
+    }
+    memcpy(pDriver->pDrawBuf+nOffset,pPixels+nRow*nSnapRowLen,nRowLen);
+    bChanged = true;
+  }
+  #if (DRV_LINUXFB_SHADOW_EN)
+  if (bChanged) {
+    gslc_DrvDirtyAdd(pGui,rRect);
+  }
+  #else
+  (void)bChanged; // Unused
+  #endif
+  return true;
+}
+
+void gslc_DrvPageSnapFree(gslc_tsGui* pGui,void* pvSnap)
+{
+  (void)pGui; // Unused
+  free(pvSnap);
+}
+
+
+// -----------------------------------------------------------------------
+// Graphics Primitives Functions
+// -----------------------------------------------------------------------
+
+bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
+{
+  gslc_DrvFillSpanRaw(pGui,nX,nY,1,gslc_DrvAdaptColorRaw(pGui,nCol));
+  return true;
+}
+
+bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
+{
+  uint32_t  nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
+  uint16_t  nIndPt;
+  for (nIndPt=0;nIndPt<nNumPt;nIndPt++) {
+    gslc_DrvFillSpanRaw(pGui,asPt[nIndPt].x,asPt[nIndPt].y,1,nColRaw);
+  }
+  return true;
+}
+
+bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  uint32_t  nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
+  int16_t   nY;
+  for (nY=rRect.y;nY<rRect.y+(int16_t)rRect.h;nY++) {
+    gslc_DrvFillSpanRaw(pGui,rRect.x,nY,rRect.w,nColRaw);
+  }
+  return true;
+}
+
+bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect     rDst = { nDstX, nDstY, rSrc.w, rSrc.h };
+
+  // A rotated rectangle is still a rectangle in the framebuffer,
+  // so the copy can always be made a framebuffer row at a time
+  gslc_tsRect     rFbSrc = gslc_DrvRectToFb(pGui,rSrc);
+  gslc_tsRect     rFbDst = gslc_DrvRectToFb(pGui,rDst);
+  uint32_t        nRowLen = (uint32_t)rFbSrc.w*pDriver->nBytesPP;
+  int16_t         nRow,nRowCur;
+  uint8_t*        pSrc;
+  uint8_t*        pDst;
+
+  // Copy the rows in an order that doesn't overwrite
+  // source rows before they have been read
+  for (nRow=0;nRow<(int16_t)rFbSrc.h;nRow++) {
+    nRowCur = (rFbDst.y > rFbSrc.y)? (int16_t)rFbSrc.h-1-nRow : nRow;
+    pSrc = pDriver->pDrawBuf + (uint32_t)(rFbSrc.y+nRowCur)*pDriver->nLineLen + (uint32_t)rFbSrc.x*pDriver->nBytesPP;
+    pDst = pDriver->pDrawBuf + (uint32_t)(rFbDst.y+nRowCur)*pDriver->nLineLen + (uint32_t)rFbDst.x*pDriver->nBytesPP;
+    memmove(pDst,pSrc,nRowLen);
+  }
+  #if (DRV_LINUXFB_SHADOW_EN)
+  gslc_DrvDirtyAdd(pGui,rDst);
+  #endif
+  return true;
+}
+
+bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  if ((rRect.w == 0) || (rRect.h == 0)) { return true; }
+  uint32_t  nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
+  int16_t   nY;
+  int16_t   nY1 = rRect.y+rRect.h-1;
+  gslc_DrvFillSpanRaw(pGui,rRect.x,rRect.y,rRect.w,nColRaw);
+  if (rRect.h > 1) {
+    gslc_DrvFillSpanRaw(pGui,rRect.x,nY1,rRect.w,nColRaw);
+  }
+  for (nY=rRect.y+1;nY<nY1;nY++) {
+    gslc_DrvFillSpanRaw(pGui,rRect.x,nY,1,nColRaw);
+    if (rRect.w > 1) {
+      gslc_DrvFillSpanRaw(pGui,rRect.x+rRect.w-1,nY,1,nColRaw);
+    }
+  }
+  return true;
+}
+
+bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
+{
+  uint32_t  nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
+  int16_t   nTmp;
+
+  // Horizontal lines are filled as a single span
+  if (nY0 == nY1) {
+    if (nX1 < nX0) { nTmp = nX0; nX0 = nX1; nX1 = nTmp; }
+    gslc_DrvFillSpanRaw(pGui,nX0,nY0,nX1-nX0+1,nColRaw);
+    return true;
+  }
+
+  // Bresenham's algorithm
+  int16_t nDX = (nX1 > nX0)? (nX1-nX0) : (nX0-nX1);
+  int16_t nDY = (nY1 > nY0)? (nY0-nY1) : (nY1-nY0);
+  int16_t nSX = (nX0 < nX1)? 1 : -1;
+  int16_t nSY = (nY0 < nY1)? 1 : -1;
+  int32_t nErr = nDX + nDY;
+  int32_t nErr2;
+  while (true) {
+    gslc_DrvFillSpanRaw(pGui,nX0,nY0,1,nColRaw);
+    if ((nX0 == nX1) && (nY0 == nY1)) { break; }
+    nErr2 = 2*nErr;
+    if (nErr2 >= nDY) { nErr += nDY; nX0 += nSX; }
+    if (nErr2 <= nDX) { nErr += nDX; nY0 += nSY; }
+  }
+  return true;
+}
+
+bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef)
+{
+  // The framebuffer driver does not pre-load image data into memory
+  // before calling DrvDrawImage(), so we handle the loading now
+  // (when rendering).
+  if (sImgRef.eImgFlags == GSLC_IMGREF_NONE) {
+    return true;  // Nothing to do
+
+  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) {
+    if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_BMP24) {
+      // Stream the visible region of the bitmap from the file
+      return gslc_BmpDrawFromFile(pGui,sImgRef.pFname,nDstX,nDstY);
+    } else {
+      GSLC_DEBUG2_PRINT("ERROR: DrvDrawImage(%s) unsupported image format\n",sImgRef.pFname);
+      return false;
+    }
+
+  } else if (((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_RAM) ||
+             ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_PROG)) {
+    // On LINUX there is no separate program memory space
+    if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RAW1) {
+      // Draw a monochrome bitmap
+      // - Dimensions and output color are defined in array header
+      gslc_DrvDrawMonoFromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,false);
+      return true;
+    } else if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_BMP24) {
+      // 24-bit Bitmap (stored as RGB565)
+      gslc_DrvDrawBmp24FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,false);
+      return true;
+    } else {
+      GSLC_DEBUG2_PRINT("ERROR: DrvDrawImage(%s) unsupported image format\n","");
+      return false;
+    }
+
+  } else {
+    // Unsupported source
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawImage() unsupported source eImgFlags=%d\n", sImgRef.eImgFlags);
+    return false;
+  }
+}
+
+void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,
+ const unsigned char *pBitmap,bool bProgMem)
+{
+  const unsigned char*  bmap_base = pBitmap;
+  int16_t         w,h;
+  gslc_tsColor    nCol;
+
+  // Read header
+  w       = *(bmap_base++) << 8;
+  w      |= *(bmap_base++) << 0;
+  h       = *(bmap_base++) << 8;
+  h      |= *(bmap_base++) << 0;
+  nCol.r  = *(bmap_base++);
+  nCol.g  = *(bmap_base++);
+  nCol.b  = *(bmap_base++);
+  bmap_base++;
+
+  uint32_t  nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
+  int16_t   i, j, byteWidth = (w + 7) / 8;
+  int16_t   nRunStart;
+  uint8_t   nByte = 0;
+
+  // Set bits are pushed as horizontal runs
+  for (j=0; j<h; j++) {
+    nRunStart = -1;
+    for (i=0; i<w; i++) {
+      if (i & 7) nByte <<= 1;
+      else nByte = bmap_base[j * byteWidth + i / 8];
+      if (nByte & 0x80) {
+        if (nRunStart < 0) { nRunStart = i; }
+      } else if (nRunStart >= 0) {
+        gslc_DrvFillSpanRaw(pGui,nDstX+nRunStart,nDstY+j,i-nRunStart,nColRaw);
+        nRunStart = -1;
+      }
+    }
+    if (nRunStart >= 0) {
+      gslc_DrvFillSpanRaw(pGui,nDstX+nRunStart,nDstY+j,w-nRunStart,nColRaw);
+    }
+  }
+}
+
+void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  const uint16_t* pImage = (const uint16_t*)pBitmap;
+  int16_t h, w;
+  h = *(pImage++);
+  w = *(pImage++);
+
+  // Determine the visible region of the image
+  gslc_tsRect rVis = { 0, 0, (uint16_t)w, (uint16_t)h };
+  if (!gslc_ClipImgRect(pGui,nDstX,nDstY,w,h,&rVis)) {
+    return;
+  }
+
+  // If transparency is enabled, convert the transparent color once
+  bool      bTransEn = (GSLC_BMP_TRANS_EN) ? true : false;
+  gslc_tsColor sTransCol = pGui->sTransCol;
+  uint16_t  nTransRaw = ((sTransCol.r & 0xF8) << 8) | ((sTransCol.g & 0xFC) << 3) | (sTransCol.b >> 3);
+
+  // When the framebuffer is RGB565 and not rotated, the image
+  // rows can be copied as they are (between transparent pixels)
+  bool      bRowCopy = (pDriver->bNative565) && (pDriver->nPixStep == 2);
+
+  int16_t   row, col, nRunStart;
+  uint16_t  nColRaw;
+  const uint16_t* pRow;
+  uint8_t*  pDst;
+  gslc_tsColor nCol;
+  for (row=rVis.y; row<rVis.y+(int16_t)rVis.h; row++) {
+    pRow = pImage + (int32_t)row*w + rVis.x;
+    pDst = gslc_DrvPixelAddr(pGui,nDstX+rVis.x,nDstY+row);
+    if ((bRowCopy) && (!bTransEn)) {
+      memcpy(pDst,pRow,(uint32_t)rVis.w*2);
+      continue;
+    }
+    if (bRowCopy) {
+      nRunStart = -1;
+      for (col=0; col<=(int16_t)rVis.w; col++) {
+        if ((col < (int16_t)rVis.w) && (pRow[col] != nTransRaw)) {
+          if (nRunStart < 0) { nRunStart = col; }
+        } else if (nRunStart >= 0) {
+          memcpy(pDst+nRunStart*2,pRow+nRunStart,(uint32_t)(col-nRunStart)*2);
+          nRunStart = -1;
+        }
+      }
+      continue;
+    }
+    for (col=rVis.x; col<rVis.x+(int16_t)rVis.w; col++) {
+      nColRaw = *(pRow++);
+      if ((!bTransEn) || (nColRaw != nTransRaw)) {
+        nCol.r = (uint8_t)(((nColRaw >> 11) & 0x1F) << 3);
+        nCol.g = (uint8_t)(((nColRaw >>  5) & 0x3F) << 2);
+        nCol.b = (uint8_t)(((nColRaw >>  0) & 0x1F) << 3);
+        gslc_DrvPutPixelRaw(pDriver,pDst,gslc_DrvAdaptColorRaw(pGui,nCol));
+      }
+      pDst += pDriver->nPixStep;
+    }
+  }
+  #if (DRV_LINUXFB_SHADOW_EN)
+  rVis.x += nDstX;
+  rVis.y += nDstY;
+  gslc_DrvDirtyAdd(pGui,rVis);
+  #endif
+}
+
+bool gslc_DrvDrawRow(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nLen,const gslc_tsColor* pasCol)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect*    pClip = &pDriver->rClipRect;
+
+  // Clip the run against the clipping region
+  if ((nY < pClip->y) || (nY >= pClip->y+(int16_t)pClip->h)) { return true; }
+  int16_t nX0 = nX;
+  int16_t nX1 = nX+(int16_t)nLen;
+  if (nX0 < pClip->x) { nX0 = pClip->x; }
+  if (nX1 > pClip->x+(int16_t)pClip->w) { nX1 = pClip->x+(int16_t)pClip->w; }
+  if (nX0 >= nX1) { return true; }
+
+  uint8_t*  pDst = gslc_DrvPixelAddr(pGui,nX0,nY);
+  int16_t   nInd;
+  for (nInd=nX0;nInd<nX1;nInd++) {
+    gslc_DrvPutPixelRaw(pDriver,pDst,gslc_DrvAdaptColorRaw(pGui,pasCol[nInd-nX]));
+    pDst += pDriver->nPixStep;
+  }
+  #if (DRV_LINUXFB_SHADOW_EN)
+  gslc_DrvDirtyAdd(pGui,(gslc_tsRect){nX0,nY,(uint16_t)(nX1-nX0),1});
+  #endif
+  return true;
+}
+
+void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
+{
+  if (pGui->pvDriver) {
+    gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+    // Check to see if an image has been assigned to the background
+    if (pGui->sImgRefBkgnd.eImgFlags == GSLC_IMGREF_NONE) {
+      // No image assigned, so assume flat color background
+      // - Only the current clipping region is filled
+      gslc_tsRect rClip = pDriver->rClipRect;
+      uint32_t    nColRaw = gslc_DrvAdaptColorRaw(pGui,pDriver->nColBkgnd);
+      int16_t     nY;
+      for (nY=rClip.y;nY<rClip.y+(int16_t)rClip.h;nY++) {
+        gslc_DrvFillSpanRaw(pGui,rClip.x,nY,rClip.w,nColRaw);
+      }
+    } else {
+      gslc_DrvDrawImage(pGui,0,0,pGui->sImgRefBkgnd);
+    }
+  }
+}
+
+
+
+// ------------------------------------------------------------------------
+// Touch Functions
+// ------------------------------------------------------------------------
+
+bool gslc_DrvInitTouch(gslc_tsGui* pGui,const char* acDev)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInitTouch(%s) called with NULL ptr\n","");
+    return false;
+  }
+  // Touch input is handled by tslib (gslc_TDrvInitTouch)
+  return true;
+}
+
+void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui)
+{
+  return NULL;
+}
+
+bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPress,gslc_teInputRawEvent* peInputEvent,int16_t* pnInputVal)
+{
+  // Touch input is handled by tslib (gslc_TDrvGetTouch)
+  return false;
+}
+
+// -----------------------------------------------------------------------
+// Dynamic Screen rotation and Touch axes swap/flip functions
+// -----------------------------------------------------------------------
+
+bool gslc_DrvRotate(gslc_tsGui* pGui, uint8_t nRotation)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  bool            bChange = (nRotation != pGui->nRotation);
+
+  // The framebuffer keeps its native orientation, so
+  // only the mapping of the drawing coordinates changes
+  pGui->nRotation = nRotation;
+  if ((nRotation == 1) || (nRotation == 3)) {
+    pGui->nDispW = pGui->nDisp0H;
+    pGui->nDispH = pGui->nDisp0W;
+  } else {
+    pGui->nDispW = pGui->nDisp0W;
+    pGui->nDispH = pGui->nDisp0H;
+  }
+
+  // Determine the address step between horizontally
+  // adjacent pixels (see gslc_DrvPixelAddr)
+  switch (nRotation) {
+    case 1:  pDriver->nPixStep =  (int32_t)pDriver->nLineLen; break;
+    case 2:  pDriver->nPixStep = -(int32_t)pDriver->nBytesPP; break;
+    case 3:  pDriver->nPixStep = -(int32_t)pDriver->nLineLen; break;
+    default: pDriver->nPixStep =  (int32_t)pDriver->nBytesPP; break;
+  }
+
+  // Update the clipping region
+  gslc_DrvSetClipRect(pGui,NULL);
+
+  return bChange;
+}
+
+
+// ------------------------------------------------------------------------
+// Touch Functions (via external tslib)
+// ------------------------------------------------------------------------
+
+#if defined(DRV_TOUCH_TSLIB)
+
+// POST:
+// - pDriver->pTsDev mapped to touchscreen device
+bool gslc_TDrvInitTouch(gslc_tsGui* pGui,const char* acDev)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: TDrvInitTouch(%s) called with NULL ptr\n","");
+    return false;
+  }
+
+  // Assign default
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->pTsDev = NULL;
+
+  // Open in non-blocking mode
+  pDriver->pTsDev = ts_open(acDev,1);
+  if (!pDriver->pTsDev) {
+    GSLC_DEBUG2_PRINT("ERROR: TsOpen(%s) failed\n",acDev);
+    return false;
+  }
+
+  if (ts_config(pDriver->pTsDev)) {
+    GSLC_DEBUG2_PRINT("ERROR: ts_config(%s) failed\n","");
+    // Clear the tslib pointer so we don't try to call it again
+    pDriver->pTsDev = NULL;
+    return false;
+  }
+
+  return true;
+}
+
+
+bool gslc_TDrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPress,gslc_teInputRawEvent* peInputEvent,int16_t* pnInputVal)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: TDrvGetTouch(%s) called with NULL ptr\n","");
+    return false;
+  }
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  // In case tslib was not loaded, exit now
+  if (pDriver->pTsDev == NULL) {
+    return false;
+  }
+  struct ts_sample   pSamp;
+  int32_t nRet = ts_read(pDriver->pTsDev,&pSamp,1);
+  // ts_read returns the number of samples actually fetched
+  if (nRet > 0) {
+    (*pnX)          = pSamp.x;
+    (*pnY)          = pSamp.y;
+    (*pnPress)      = pSamp.pressure;
+    (*peInputEvent) = GSLC_INPUT_TOUCH;
+    (*pnInputVal)   = 0;
+    return true;
+  } else {
+    // No sample returned
+    return false;
+  }
+}
+
+#endif // DRV_TOUCH_TSLIB
+
+
+// =======================================================================
+// Private Functions
+// =======================================================================
+
+bool gslc_DrvGetFbInfo(gslc_tsGui* pGui)
+{
+  gslc_tsDriver*            pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  struct fb_var_screeninfo  sVarInfo;
+  struct fb_fix_screeninfo  sFixInfo;
+  uint32_t                  nBitsPP;
+
+  if ((ioctl(pDriver->nFd,FBIOGET_VSCREENINFO,&sVarInfo) == 0) &&
+      (ioctl(pDriver->nFd,FBIOGET_FSCREENINFO,&sFixInfo) == 0)) {
+    pGui->nDisp0W         = (uint16_t)sVarInfo.xres;
+    pGui->nDisp0H         = (uint16_t)sVarInfo.yres;
+    nBitsPP               = sVarInfo.bits_per_pixel;
+    pDriver->nLineLen     = sFixInfo.line_length;
+    pDriver->nRedOffset   = (uint8_t)sVarInfo.red.offset;
+    pDriver->nRedLen      = (uint8_t)sVarInfo.red.length;
+    pDriver->nGreenOffset = (uint8_t)sVarInfo.green.offset;
+    pDriver->nGreenLen    = (uint8_t)sVarInfo.green.length;
+    pDriver->nBlueOffset  = (uint8_t)sVarInfo.blue.offset;
+    pDriver->nBlueLen     = (uint8_t)sVarInfo.blue.length;
+  } else {
+    // Not a framebuffer device (eg. a regular file used for
+    // testing), so use the configured format
+    pGui->nDisp0W         = DRV_LINUXFB_WIDTH;
+    pGui->nDisp0H         = DRV_LINUXFB_HEIGHT;
+    nBitsPP               = DRV_LINUXFB_DEPTH;
+    pDriver->nLineLen     = (uint32_t)DRV_LINUXFB_WIDTH*(DRV_LINUXFB_DEPTH/8);
+    if (nBitsPP == 16) {
+      // RGB565
+      pDriver->nRedOffset   = 11;  pDriver->nRedLen   = 5;
+      pDriver->nGreenOffset = 5;   pDriver->nGreenLen = 6;
+      pDriver->nBlueOffset  = 0;   pDriver->nBlueLen  = 5;
+    } else {
+      // XRGB8888
+      pDriver->nRedOffset   = 16;  pDriver->nRedLen   = 8;
+      pDriver->nGreenOffset = 8;   pDriver->nGreenLen = 8;
+      pDriver->nBlueOffset  = 0;   pDriver->nBlueLen  = 8;
+    }
+  }
+
+  if (((nBitsPP != 16) && (nBitsPP != 32)) ||
+      (pDriver->nRedLen > 8) || (pDriver->nGreenLen > 8) || (pDriver->nBlueLen > 8)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInit() unsupported framebuffer format (%u bpp)\n",(unsigned)nBitsPP);
+    return false;
+  }
+  pDriver->nBytesPP   = (uint8_t)(nBitsPP/8);
+  pDriver->nFbSize    = pDriver->nLineLen*pGui->nDisp0H;
+  pDriver->bNative565 = (pDriver->nBytesPP == 2) &&
+    (pDriver->nRedOffset == 11) && (pDriver->nRedLen == 5) &&
+    (pDriver->nGreenOffset == 5) && (pDriver->nGreenLen == 6) &&
+    (pDriver->nBlueOffset == 0) && (pDriver->nBlueLen == 5);
+  return true;
+}
+
+uint32_t gslc_DrvAdaptColorRaw(gslc_tsGui* pGui,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  return ((uint32_t)(nCol.r >> (8-pDriver->nRedLen))   << pDriver->nRedOffset) |
+         ((uint32_t)(nCol.g >> (8-pDriver->nGreenLen)) << pDriver->nGreenOffset) |
+         ((uint32_t)(nCol.b >> (8-pDriver->nBlueLen))  << pDriver->nBlueOffset);
+}
+
+void gslc_DrvFillSpanRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,int16_t nW,uint32_t nColRaw)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect*    pClip = &pDriver->rClipRect;
+
+  // Clip the span against the clipping region
+  // - The clipping region is always within the display
+  if ((nY < pClip->y) || (nY >= pClip->y+(int16_t)pClip->h)) { return; }
+  int16_t nX1 = nX+nW;
+  if (nX < pClip->x) { nX = pClip->x; }
+  if (nX1 > pClip->x+(int16_t)pClip->w) { nX1 = pClip->x+(int16_t)pClip->w; }
+  if (nX >= nX1) { return; }
+
+  int16_t   nLen = nX1-nX;
+  uint8_t*  pDst;
+  if ((pGui->nRotation == 1) || (pGui->nRotation == 3)) {
+    // The span is a column of the framebuffer
+    pDst = gslc_DrvPixelAddr(pGui,nX,nY);
+    for (;nLen>0;nLen--) {
+      gslc_DrvPutPixelRaw(pDriver,pDst,nColRaw);
+      pDst += pDriver->nPixStep;
+    }
+  } else {
+    // The span is contiguous in the framebuffer, starting
+    // from its right end if rotated by 180 degrees
+    pDst = gslc_DrvPixelAddr(pGui,(pGui->nRotation == 2)? nX1-1 : nX,nY);
+    if (pDriver->nBytesPP == 2) {
+      uint16_t* pDst16 = (uint16_t*)pDst;
+      uint32_t* pDst32;
+      // Write pairs of pixels once 32-bit aligned
+      if ((((uintptr_t)pDst16) & 2) != 0) {
+        *(pDst16++) = (uint16_t)nColRaw;
+        nLen--;
+      }
+      nColRaw = (nColRaw & 0xFFFF) | (nColRaw << 16);
+      for (pDst32=(uint32_t*)pDst16;nLen>=2;nLen-=2) {
+        *(pDst32++) = nColRaw;
+      }
+      if (nLen > 0) {
+        *((uint16_t*)pDst32) = (uint16_t)nColRaw;
+      }
+    } else {
+      uint32_t* pDst32 = (uint32_t*)pDst;
+      for (;nLen>0;nLen--) {
+        *(pDst32++) = nColRaw;
+      }
+    }
+  }
+  #if (DRV_LINUXFB_SHADOW_EN)
+  gslc_DrvDirtyAdd(pGui,(gslc_tsRect){nX,nY,(uint16_t)(nX1-nX),1});
+  #endif
+}
+
+uint8_t* gslc_DrvPixelAddr(gslc_tsGui* pGui,int16_t nX,int16_t nY)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  int16_t         nFbX,nFbY;
+  // Rotation is clockwise
+  switch (pGui->nRotation) {
+    case 1:  nFbX = pGui->nDisp0W-1-nY; nFbY = nX;                  break;
+    case 2:  nFbX = pGui->nDisp0W-1-nX; nFbY = pGui->nDisp0H-1-nY;  break;
+    case 3:  nFbX = nY;                 nFbY = pGui->nDisp0H-1-nX;  break;
+    default: nFbX = nX;                 nFbY = nY;                  break;
+  }
+  return pDriver->pDrawBuf + (uint32_t)nFbY*pDriver->nLineLen + (uint32_t)nFbX*pDriver->nBytesPP;
+}
+
+void gslc_DrvPutPixelRaw(gslc_tsDriver* pDriver,uint8_t* pDst,uint32_t nColRaw)
+{
+  if (pDriver->nBytesPP == 2) {
+    *((uint16_t*)pDst) = (uint16_t)nColRaw;
+  } else {
+    *((uint32_t*)pDst) = nColRaw;
+  }
+}
+
+gslc_tsRect gslc_DrvRectToFb(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  gslc_tsRect rFb;
+  switch (pGui->nRotation) {
+    case 1:
+      rFb = (gslc_tsRect){ pGui->nDisp0W-rRect.y-rRect.h, rRect.x, rRect.h, rRect.w };
+      break;
+    case 2:
+      rFb = (gslc_tsRect){ pGui->nDisp0W-rRect.x-rRect.w, pGui->nDisp0H-rRect.y-rRect.h, rRect.w, rRect.h };
+      break;
+    case 3:
+      rFb = (gslc_tsRect){ rRect.y, pGui->nDisp0H-rRect.x-rRect.w, rRect.h, rRect.w };
+      break;
+    default:
+      rFb = rRect;
+      break;
+  }
+  return rFb;
+}
+
+#if (DRV_LINUXFB_SHADOW_EN)
+void gslc_DrvDirtyAdd(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_UnionRect(&pDriver->rDirty,gslc_DrvRectToFb(pGui,rRect));
+}
+#endif // DRV_LINUXFB_SHADOW_EN
+
+// =======================================================================
+
+#endif // Compiler guard for requested driver
@@ -0,0 +1,804 @@
+#ifndef _GUISLICE_DRV_LINUXFB_H_
+#define _GUISLICE_DRV_LINUXFB_H_
+
+// =======================================================================
+// GUIslice library (driver layer for LINUX framebuffer)
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2020 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+/// \file GUIslice_drv_linuxfb.h
+/// \brief GUIslice library (driver layer for LINUX framebuffer device)
+
+
+// =======================================================================
+// Driver Layer for LINUX framebuffer device
+// - Draws directly into a memory-mapped framebuffer device (eg.
+//   /dev/fb0) without SDL or any other graphics library
+// - Supports RGB565 (16-bit) and XRGB8888 (32-bit) pixel formats.
+//   The channel layout is read from the device.
+// - Rectangle fills are written a span at a time and images a row
+//   at a time. As the framebuffer is the display, a page flip is not
+//   required unless the optional shadow buffer is enabled.
+// - If the device path names an existing regular file instead of a
+//   framebuffer device, the file is mapped with the configured
+//   dimensions (and extended if necessary). This allows the driver
+//   to be tested without display hardware.
+// - Text is rendered with a built-in 5x7 font. Font files passed
+//   to gslc_FontSet() are not loaded; the font size selects the
+//   text scale instead.
+// - Touch input is read through tslib (DRV_TOUCH_TSLIB)
+// =======================================================================
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include "GUIslice.h"
+
+#include <stdio.h>
+
+// Includes for optional tslib touch handling
+#if defined(DRV_TOUCH_TSLIB)
+  #include "tslib.h"
+#endif
+
+
+// =======================================================================
+// API support definitions
+// - These defines indicate whether the driver includes optimized
+//   support for various APIs. If a define is set to 0, then the
+//   GUIslice core emulation will be used instead.
+// - At the very minimum, the point draw routine must be available:
+//   gslc_DrvDrawPoint()
+// =======================================================================
+
+#define DRV_HAS_DRAW_POINT             1 ///< Support gslc_DrvDrawPoint()
+
+#define DRV_HAS_DRAW_POINTS            1 ///< Support gslc_DrvDrawPoints()
+#define DRV_HAS_DRAW_LINE              1 ///< Support gslc_DrvDrawLine()
+#define DRV_HAS_DRAW_RECT_FRAME        1 ///< Support gslc_DrvDrawFrameRect()
+#define DRV_HAS_DRAW_RECT_FILL         1 ///< Support gslc_DrvDrawFillRect()
+#define DRV_HAS_DRAW_RECT_ROUND_FRAME  0 ///< Support gslc_DrvDrawFrameRoundRect()
+#define DRV_HAS_DRAW_RECT_ROUND_FILL   0 ///< Support gslc_DrvDrawFillRoundRect()
+#define DRV_HAS_DRAW_CIRCLE_FRAME      0 ///< Support gslc_DrvDrawFrameCircle()
+#define DRV_HAS_DRAW_CIRCLE_FILL       0 ///< Support gslc_DrvDrawFillCircle()
+#define DRV_HAS_DRAW_TRI_FRAME         0 ///< Support gslc_DrvDrawFrameTriangle()
+#define DRV_HAS_DRAW_TRI_FILL          0 ///< Support gslc_DrvDrawFillTriangle()
+#define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
+#define DRV_HAS_DRAW_BMP_MEM           1 ///< Support gslc_DrvDrawBmp24FromMem()
+#define DRV_HAS_DRAW_ROW               1 ///< Support gslc_DrvDrawRow()
+#define DRV_HAS_BAND                   0 ///< Support gslc_DrvBandStart() / gslc_DrvBandFlush()
+#define DRV_HAS_COPY_RECT              1 ///< Support gslc_DrvCopyRect()
+#define DRV_HAS_FRAME_LOCK             0 ///< Support gslc_DrvFrameLock() / gslc_DrvFrameUnlock()
+#define DRV_HAS_PAGE_SNAP              1 ///< Support gslc_DrvPageSnapSave() / gslc_DrvPageSnapRestore()
+
+#define DRV_OVERRIDE_TXT_ALIGN         0 ///< Driver provides text alignment
+
+// -----------------------------------------------------------------------
+// Additional defines
+// - Provide default if not in config file
+// -----------------------------------------------------------------------
+
+// Framebuffer device
+// - The environment variable GSLC_LINUXFB_DEV overrides the device
+//   path configured in GSLC_DEV_FB
+#define DRV_LINUXFB_DEV_DEFAULT   "/dev/fb0"
+
+// Framebuffer dimensions (in native orientation) and depth (16 or 32)
+// - Only used when the device path names a regular file. The geometry
+//   of a framebuffer device is read from the device itself.
+#if !defined(DRV_LINUXFB_WIDTH)
+  #define DRV_LINUXFB_WIDTH       320
+#endif
+#if !defined(DRV_LINUXFB_HEIGHT)
+  #define DRV_LINUXFB_HEIGHT      240
+#endif
+#if !defined(DRV_LINUXFB_DEPTH)
+  #define DRV_LINUXFB_DEPTH       16
+#endif
+
+// Shadow buffer
+// - Set DRV_LINUXFB_SHADOW_EN to 1 to draw into a buffer in RAM and
+//   only copy the rows that changed to the framebuffer on a page flip.
+//   This avoids showing partially drawn frames and reads from the
+//   (often uncached) framebuffer memory.
+// - Set to 0 to draw directly into the framebuffer
+#if !defined(DRV_LINUXFB_SHADOW_EN)
+  #define DRV_LINUXFB_SHADOW_EN   0
+#endif
+
+
+// =======================================================================
+// Driver-specific members
+// =======================================================================
+typedef struct {
+  int                 nFd;              ///< Framebuffer device file descriptor (or -1)
+  uint8_t*            pFbMem;           ///< Memory-mapped framebuffer
+  uint32_t            nFbSize;          ///< Size of the mapped framebuffer (bytes)
+  uint8_t*            pDrawBuf;         ///< Drawing target (framebuffer or shadow buffer)
+  uint32_t            nLineLen;         ///< Bytes per framebuffer line
+  uint8_t             nBytesPP;         ///< Bytes per pixel (2 or 4)
+  int32_t             nPixStep;         ///< Address step for one pixel in X (depends on rotation)
+
+  uint8_t             nRedOffset;       ///< Bit offset of the red channel
+  uint8_t             nRedLen;          ///< Bit length of the red channel
+  uint8_t             nGreenOffset;     ///< Bit offset of the green channel
+  uint8_t             nGreenLen;        ///< Bit length of the green channel
+  uint8_t             nBlueOffset;      ///< Bit offset of the blue channel
+  uint8_t             nBlueLen;         ///< Bit length of the blue channel
+  bool                bNative565;       ///< Pixel format matches the RGB565 image data
+
+  gslc_tsColor        nColBkgnd;        ///< Background color (if not image-based)
+
+  gslc_tsRect         rClipRect;        ///< Clipping rectangle
+
+  #if (DRV_LINUXFB_SHADOW_EN)
+  uint8_t*            pShadowBuf;       ///< Shadow buffer (same layout as the framebuffer)
+  gslc_tsRect         rDirty;           ///< Region changed since the last flip (in framebuffer
+                                        ///< coordinates, empty if unchanged)
+  #endif
+
+  #if defined(DRV_TOUCH_TSLIB)
+  struct tsdev*       pTsDev;           ///< Ptr to touchscreen device
+  #endif
+
+} gslc_tsDriver;
+
+
+
+// =======================================================================
+// Public APIs to GUIslice core library
+// - These functions define the renderer / driver-dependent
+//   implementations for the core drawing operations within
+//   GUIslice.
+// =======================================================================
+
+
+// -----------------------------------------------------------------------
+// Configuration Functions
+// -----------------------------------------------------------------------
+
+///
+/// Initialize the framebuffer device
+/// - Opens and maps the device named by GSLC_DEV_FB
+///   (or the GSLC_LINUXFB_DEV environment variable)
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvInit(gslc_tsGui* pGui);
+
+///
+/// Free up any members associated with the driver
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvDestruct(gslc_tsGui* pGui);
+
+
+///
+/// Get the display driver name
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return String containing driver name
+///
+const char* gslc_DrvGetNameDisp(gslc_tsGui* pGui);
+
+
+///
+/// Get the touch driver name
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return String containing driver name
+///
+const char* gslc_DrvGetNameTouch(gslc_tsGui* pGui);
+
+///
+/// Get the native display driver instance
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return Void pointer to the display driver instance (gslc_tsDriver)
+///
+void* gslc_DrvGetDriverDisp(gslc_tsGui* pGui);
+
+///
+/// Get the native touch driver instance
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return Void pointer to the touch driver instance (NULL as
+///         tslib is accessed through the display driver)
+///
+void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui);
+
+
+// -----------------------------------------------------------------------
+// Image/surface handling Functions
+// -----------------------------------------------------------------------
+
+///
+/// Load a bitmap (*.bmp) and create a new image resource.
+/// Transparency is enabled by GSLC_BMP_TRANS_EN
+/// through use of color (GSLC_BMP_TRANS_RGB).
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return Image pointer (surface/texture) or NULL if error
+///
+void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef);
+
+
+///
+/// Configure the background to use a bitmap image
+/// - The background is used when redrawing the entire page
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSetBkgndImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef);
+
+
+///
+/// Configure the background to use a solid color
+/// - The background is used when redrawing the entire page
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nCol:        RGB Color to use
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol);
+
+
+///
+/// Set an element's normal-state image
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element to update
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef);
+
+
+///
+/// Set an element's glow-state image
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element to update
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef);
+
+
+///
+/// Release an image surface
+///
+/// \param[in]  pvImg:          Void ptr to image
+///
+/// \return none
+///
+void gslc_DrvImageDestruct(void* pvImg);
+
+
+///
+/// Set the clipping rectangle for future drawing updates
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  pRect:         Rectangular region to constrain edits
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect);
+
+
+// -----------------------------------------------------------------------
+// Font handling Functions
+// -----------------------------------------------------------------------
+
+///
+/// Load a font from a resource and return pointer to it
+/// - All fonts are rendered with the built-in 5x7 font
+/// - For GSLC_FONTREF_PTR, nFontSz is the text scale (as in
+///   the Arduino drivers). For GSLC_FONTREF_FNAME, the font file
+///   is not loaded and nFontSz (points) is mapped to the nearest
+///   text scale.
+///
+/// \param[in]  eFontRefType:   Font reference type
+/// \param[in]  pvFontRef:      Font reference pointer
+/// \param[in]  nFontSz:        Typeface size to use
+///
+/// \return Void ptr to driver-specific font (the font reference)
+///
+const void* gslc_DrvFontAdd(gslc_teFontRefType eFontRefType,const void* pvFontRef,uint16_t nFontSz);
+
+///
+/// Release all fonts defined in the GUI
+///
+/// \param[in]  pGui:          Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvFontsDestruct(gslc_tsGui* pGui);
+
+
+///
+/// Get the extent (width and height) of a text string
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pFont:       Ptr to Font structure
+/// \param[in]  pStr:        String to display
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[out] pnTxtX:      Ptr to offset X of text
+/// \param[out] pnTxtY:      Ptr to offset Y of text
+/// \param[out] pnTxtSzW:    Ptr to width of text
+/// \param[out] pnTxtSzH:    Ptr to height of text
+///
+/// \return true if success, false if failure
+///
+bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,
+        int16_t* pnTxtX,int16_t* pnTxtY,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH);
+
+
+///
+/// Draw a text string at the given coordinate
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nTxtX:       X coordinate of top-left text string
+/// \param[in]  nTxtY:       Y coordinate of top-left text string
+/// \param[in]  pFont:       Ptr to Font
+/// \param[in]  pStr:        String to display
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[in]  colTxt:      Color to draw text
+/// \param[in]  colBg:       unused (text is drawn transparently)
+///
+/// \return true if success, false if failure
+///
+bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt,gslc_tsColor colBg);
+
+
+// -----------------------------------------------------------------------
+// Screen Management Functions
+// -----------------------------------------------------------------------
+
+///
+/// Force a page flip to occur
+/// - Drawing is made directly to the framebuffer, so this only
+///   needs to copy the changed region of the shadow buffer
+///   (if DRV_LINUXFB_SHADOW_EN is set)
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvPageFlipNow(gslc_tsGui* pGui);
+
+
+// -----------------------------------------------------------------------
+// Page Snapshot Functions
+// -----------------------------------------------------------------------
+
+///
+/// Get the storage required for a snapshot of a region of the display
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the display
+///
+/// \return Size of the snapshot in bytes (or 0 if not supported)
+///
+uint32_t gslc_DrvPageSnapGetSize(gslc_tsGui* pGui,gslc_tsRect rRect);
+
+///
+/// Save a region of the display into a snapshot (see gslc_PageSetCacheEn)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in,out] ppvSnap:  Ptr to the snapshot storage. If it is NULL
+///                          (or too small for the region), the storage
+///                          is (re)allocated first.
+/// \param[in]  rRect:       Region of the display to save
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvPageSnapSave(gslc_tsGui* pGui,void** ppvSnap,gslc_tsRect rRect);
+
+///
+/// Restore a region of a snapshot of the display saved by gslc_DrvPageSnapSave()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pvSnap:      Snapshot storage
+/// \param[in]  rRect:       Region of the display to restore (within
+///                          the region saved in the snapshot)
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvPageSnapRestore(gslc_tsGui* pGui,void* pvSnap,gslc_tsRect rRect);
+
+///
+/// Release the storage of a snapshot
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pvSnap:      Snapshot storage
+///
+/// \return none
+///
+void gslc_DrvPageSnapFree(gslc_tsGui* pGui,void* pvSnap);
+
+
+// -----------------------------------------------------------------------
+// Graphics Primitives Functions
+// -----------------------------------------------------------------------
+
+///
+/// Draw a point
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of point
+/// \param[in]  nY:          Y coordinate of point
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol);
+
+///
+/// Draw a point
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asPt:        Array of points to draw
+/// \param[in]  nNumPt:      Number of points in array
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol);
+
+///
+/// Draw a framed rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to frame
+/// \param[in]  nCol:        Color RGB value to frame
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
+
+
+///
+/// Draw a filled rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to fill
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
+
+
+///
+/// Copy a rectangular region of the display to another position
+/// - The source and destination regions may overlap
+/// - The caller ensures that both regions are on the display
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rSrc:        Region to copy
+/// \param[in]  nDstX:       Destination X coordinate (top-left)
+/// \param[in]  nDstY:       Destination Y coordinate (top-left)
+///
+/// \return true if success, false if not supported
+///
+bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY);
+
+
+///
+/// Draw a line
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         Line start (X coordinate)
+/// \param[in]  nY0:         Line start (Y coordinate)
+/// \param[in]  nX1:         Line finish (X coordinate)
+/// \param[in]  nY1:         Line finish (Y coordinate)
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
+
+
+///
+/// Copy all of source image to destination screen at specified coordinate
+/// - Supports BMP files (GSLC_IMGREF_SRC_FILE) and the monochrome and
+///   24-bit bitmap arrays (GSLC_IMGREF_SRC_RAM / _PROG)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coord for copy
+/// \param[in]  nDstY:       Destination Y coord for copy
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef);
+
+
+///
+/// Draw a monochrome bitmap from a memory array
+/// - Draw from the bitmap buffer using the foreground color
+///   defined in the header (unset bits are transparent)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coord for copy
+/// \param[in]  nDstY:       Destination Y coord for copy
+/// \param[in]  pBitmap:     Pointer to bitmap buffer
+/// \param[in]  bProgMem:    Bitmap is stored in Flash if true, RAM otherwise
+///
+/// \return none
+///
+void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY, const unsigned char *pBitmap,bool bProgMem);
+
+
+///
+/// Draw a color 24-bit depth bitmap from a memory array
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       X coord for copy
+/// \param[in]  nDstY:       Y coord for copy
+/// \param[in]  pBitmap:     Pointer to bitmap buffer
+/// \param[in]  bProgMem:    Bitmap is stored in Flash if true, RAM otherwise
+///
+/// \return none
+///
+void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem);
+
+
+///
+/// Draw a horizontal run of pixels
+/// - Used by the BMP streaming decoder (gslc_BmpDraw) to push the
+///   visible portion of each scanline
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of the first pixel
+/// \param[in]  nY:          Y coordinate of the row
+/// \param[in]  nLen:        Number of pixels in the run
+/// \param[in]  pasCol:      Array of pixel colors
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawRow(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nLen,const gslc_tsColor* pasCol);
+
+
+///
+/// Copy the background image to destination screen
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return true if success, false if fail
+///
+void gslc_DrvDrawBkgnd(gslc_tsGui* pGui);
+
+
+// -----------------------------------------------------------------------
+// Touch Functions
+// -----------------------------------------------------------------------
+
+///
+/// Perform any touchscreen-specific initialization
+/// - Touch input is handled by tslib (gslc_TDrvInitTouch)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  acDev:       Device path to touchscreen
+///
+/// \return true if successful
+///
+bool gslc_DrvInitTouch(gslc_tsGui* pGui,const char* acDev);
+
+
+///
+/// Get the last touch event
+/// - Touch input is handled by tslib (gslc_TDrvGetTouch)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnX:         Ptr to X coordinate of last touch event
+/// \param[out] pnY:         Ptr to Y coordinate of last touch event
+/// \param[out] pnPress:     Ptr to Pressure level of last touch event (0 for none, 1 for touch)
+/// \param[out] peInputEvent Indication of event type
+/// \param[out] pnInputVal   Additional data for event type
+///
+/// \return false
+///
+bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPress,gslc_teInputRawEvent* peInputEvent,int16_t* pnInputVal);
+
+
+// -----------------------------------------------------------------------
+// Dynamic Screen rotation and Touch axes swap/flip functions
+// -----------------------------------------------------------------------
+
+///
+/// Change rotation
+/// - The framebuffer keeps its native orientation and the
+///   drawing coordinates are mapped onto it
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nRotation:   Screen Rotation value (0, 1, 2 or 3)
+///
+/// \return true if successful
+///
+bool gslc_DrvRotate(gslc_tsGui* pGui, uint8_t nRotation);
+
+
+// -----------------------------------------------------------------------
+// Touchscreen Functions (if using tslib)
+// -----------------------------------------------------------------------
+
+#if defined(DRV_TOUCH_TSLIB)
+///
+/// Perform any touchscreen-specific initialization
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  acDev:       Device path to touchscreen
+///                          eg. "/dev/input/touchscreen"
+///
+/// \return true if successful
+///
+bool gslc_TDrvInitTouch(gslc_tsGui* pGui,const char* acDev);
+
+
+///
+/// Get the last touch event from the tslib handler
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnX:         Ptr to X coordinate of last touch event
+/// \param[out] pnY:         Ptr to Y coordinate of last touch event
+/// \param[out] pnPress:     Ptr to Pressure level of last touch event (0 for none, >0 for touch)
+/// \param[out] peInputEvent Indication of event type
+/// \param[out] pnInputVal   Additional data for event type
+///
+/// \return non-zero if an event was detected or 0 otherwise
+///
+bool gslc_TDrvGetTouch(gslc_tsGui* pGui, int16_t* pnX, int16_t* pnY, uint16_t* pnPress, gslc_teInputRawEvent* peInputEvent, int16_t* pnInputVal);
+
+#endif // DRV_TOUCH_TSLIB
+
+
+// =======================================================================
+// Private Functions
+// - These functions are not included in the scope of APIs used by
+//   the core GUIslice library. Instead, these functions are used
+//   to support the operations within this driver layer.
+// =======================================================================
+
+///
+/// Read the framebuffer geometry and pixel format from the device
+/// - If the device is a regular file, the configured dimensions
+///   (DRV_LINUXFB_WIDTH / _HEIGHT / _DEPTH) are used instead
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return true if success, false if the format is not supported
+///
+bool gslc_DrvGetFbInfo(gslc_tsGui* pGui);
+
+///
+/// Convert a color into the framebuffer pixel format
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nCol:        RGB color
+///
+/// \return Raw pixel value
+///
+uint32_t gslc_DrvAdaptColorRaw(gslc_tsGui* pGui,gslc_tsColor nCol);
+
+///
+/// Determine the text scale for a font
+/// - GSLC_FONTREF_PTR uses the font size as the scale
+/// - GSLC_FONTREF_FNAME maps the point size onto the 8 pixel cell
+///
+/// \param[in]  pFont:       Ptr to Font
+///
+/// \return Text scale (1..8)
+///
+uint8_t gslc_DrvFontScale(gslc_tsFont* pFont);
+
+///
+/// Fill a horizontal span with a raw pixel value
+/// - The span is clipped to the clipping rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of span start
+/// \param[in]  nY:          Y coordinate of span
+/// \param[in]  nW:          Width of span
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_DrvFillSpanRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,int16_t nW,uint32_t nColRaw);
+
+///
+/// Get the address of a pixel in the drawing target
+/// - The coordinate must lie within the display
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate
+/// \param[in]  nY:          Y coordinate
+///
+/// \return Pointer to the pixel
+///
+uint8_t* gslc_DrvPixelAddr(gslc_tsGui* pGui,int16_t nX,int16_t nY);
+
+///
+/// Write a raw pixel value to the drawing target
+///
+/// \param[in]  pDriver:     Pointer to driver
+/// \param[in]  pDst:        Pointer to the pixel
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_DrvPutPixelRaw(gslc_tsDriver* pDriver,uint8_t* pDst,uint32_t nColRaw);
+
+///
+/// Map a region of the display onto the framebuffer
+/// - Accounts for the current rotation
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region in display coordinates
+///
+/// \return Region in framebuffer coordinates
+///
+gslc_tsRect gslc_DrvRectToFb(gslc_tsGui* pGui,gslc_tsRect rRect);
+
+#if (DRV_LINUXFB_SHADOW_EN)
+///
+/// Add a region of the display to the changed region of
+/// the shadow buffer
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region in display coordinates
+///
+/// \return none
+///
+void gslc_DrvDirtyAdd(gslc_tsGui* pGui,gslc_tsRect rRect);
+#endif // DRV_LINUXFB_SHADOW_EN
+
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // _GUISLICE_DRV_LINUXFB_H_
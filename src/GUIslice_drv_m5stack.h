@@ -81,6 +81,11 @@ extern const char GSLC_PMEM ERRSTR_PXD_NULL[];
 #define DRV_HAS_DRAW_TRI_FILL          1 ///< Support gslc_DrvDrawFillTriangle()
 #define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
 #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
+#define DRV_HAS_DRAW_ROW               1 ///< Support gslc_DrvDrawRow()
+#define DRV_HAS_BAND                   0 ///< Support gslc_DrvBandStart() / gslc_DrvBandFlush()
+#define DRV_HAS_COPY_RECT              0 ///< Support gslc_DrvCopyRect()
+#define DRV_HAS_FRAME_LOCK             0 ///< Support gslc_DrvFrameLock() / gslc_DrvFrameUnlock()
+#define DRV_HAS_PAGE_SNAP              0 ///< Support gslc_DrvPageSnapSave() / gslc_DrvPageSnapRestore()
 
 #define DRV_OVERRIDE_TXT_ALIGN         1 ///< Driver provides text alignment
 
@@ -579,6 +584,42 @@ void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY, cons
 ///
 void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem);
 
+///
+/// Draw a horizontal run of pixels
+/// - Used by the BMP streaming decoder (gslc_BmpDraw) to push the
+///   visible portion of each scanline
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of the first pixel
+/// \param[in]  nY:          Y coordinate of the row
+/// \param[in]  nLen:        Number of pixels in the run
+/// \param[in]  pasCol:      Array of pixel colors
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawRow(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nLen,const gslc_tsColor* pasCol);
+
+///
+/// BMP stream read callback for a file on SD card
+///
+/// \param[in]  pvStream:    Void pointer to File
+/// \param[out] pBuf:        Buffer to read into
+/// \param[in]  nLen:        Number of bytes to read
+///
+/// \return Number of bytes read
+///
+uint16_t gslc_DrvReadSD(void* pvStream,uint8_t* pBuf,uint16_t nLen);
+
+///
+/// BMP stream seek callback for a file on SD card
+///
+/// \param[in]  pvStream:    Void pointer to File
+/// \param[in]  nPos:        Absolute position in file
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSeekSD(void* pvStream,uint32_t nPos);
+
 ///
 /// Copy the background image to destination screen
 ///
@@ -0,0 +1,1572 @@
+// =======================================================================
+// GUIslice library (driver layer for in-memory framebuffer)
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2020 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+/// \file GUIslice_drv_memfb.c
+
+// Compiler guard for requested driver
+#include "GUIslice_config.h" // Sets DRV_DISP_*
+#if defined(DRV_DISP_MEMFB)
+
+// =======================================================================
+// Driver Layer for in-memory framebuffer
+// =======================================================================
+
+
+// GUIslice library
+#include "GUIslice_drv_memfb.h"
+
+#include <stdio.h>
+#include <stdlib.h>     // For getenv(), exit()
+#include <string.h>
+#include <time.h>       // For clock_gettime()
+
+// Define driver names
+const char* m_acDrvDisp = "MEMFB";
+
+#if defined(DRV_TOUCH_SCRIPT)
+  const char* m_acDrvTouch = "SCRIPT";
+#else
+  const char* m_acDrvTouch = "NONE";
+#endif
+
+// Column names for the driver calls in the stats log
+// - Order matches gslc_teDrvCall
+static const char* m_acDrvCallName[GSLC_DRVCALL__MAX] = {
+  "point","points","line","rect_frame","rect_fill","txt","image","row","bkgnd","copy"
+};
+
+// The framebuffer storage
+// - Sized for the native orientation; a rotated display
+//   reuses the same storage with width and height swapped
+static uint8_t m_anFrameBuf[(uint32_t)DRV_MEMFB_WIDTH*DRV_MEMFB_HEIGHT*DRV_MEMFB_BYTES_PP];
+
+// Line buffer used when writing frames to a file
+// - One leading byte is reserved for the PNG row filter type
+#define DRV_MEMFB_LINE_MAX  ((DRV_MEMFB_WIDTH > DRV_MEMFB_HEIGHT)? DRV_MEMFB_WIDTH : DRV_MEMFB_HEIGHT)
+static uint8_t m_anLineBuf[1+DRV_MEMFB_LINE_MAX*3];
+
+#if (GSLC_BAND_EN)
+// Band buffer used by the band renderer
+// - Holds up to GSLC_BAND_H lines of the widest orientation
+static uint8_t m_anBandBuf[(uint32_t)DRV_MEMFB_LINE_MAX*GSLC_BAND_H*DRV_MEMFB_BYTES_PP];
+#endif
+
+// Header of a page snapshot
+// - The rows of the saved region follow the header
+typedef struct {
+  gslc_tsRect rSnap;    // Region of the display held in the snapshot
+  uint32_t    nSize;    // Storage allocated for the rows (in bytes)
+} gslc_tsDrvSnap;
+
+// Built-in font
+// - Classic 5x7 font covering printable ASCII (0x20..0x7E)
+// - Each character is 5 columns, with the LSB at the top row.
+//   Bit 7 is used by the descenders.
+// - Characters are drawn in a 6x8 cell (multiplied by the text scale)
+#define DRV_MEMFB_FONT_FIRST  0x20
+#define DRV_MEMFB_FONT_LAST   0x7E
+#define DRV_MEMFB_FONT_COLS   5
+#define DRV_MEMFB_FONT_CELL_W 6
+#define DRV_MEMFB_FONT_CELL_H 8
+
+static const uint8_t m_anFont5x7[] = {
+  0x00,0x00,0x00,0x00,0x00, // ' '
+  0x00,0x00,0x5F,0x00,0x00, // '!'
+  0x00,0x07,0x00,0x07,0x00, // '"'
+  0x14,0x7F,0x14,0x7F,0x14, // '#'
+  0x24,0x2A,0x7F,0x2A,0x12, // '$'
+  0x23,0x13,0x08,0x64,0x62, // '%'
+  0x36,0x49,0x56,0x20,0x50, // '&'
+  0x00,0x08,0x07,0x03,0x00, // '''
+  0x00,0x1C,0x22,0x41,0x00, // '('
+  0x00,0x41,0x22,0x1C,0x00, // ')'
+  0x2A,0x1C,0x7F,0x1C,0x2A, // '*'
+  0x08,0x08,0x3E,0x08,0x08, // '+'
+  0x00,0x80,0x70,0x30,0x00, // ','
+  0x08,0x08,0x08,0x08,0x08, // '-'
+  0x00,0x00,0x60,0x60,0x00, // '.'
+  0x20,0x10,0x08,0x04,0x02, // '/'
+  0x3E,0x51,0x49,0x45,0x3E, // '0'
+  0x00,0x42,0x7F,0x40,0x00, // '1'
+  0x72,0x49,0x49,0x49,0x46, // '2'
+  0x21,0x41,0x49,0x4D,0x33, // '3'
+  0x18,0x14,0x12,0x7F,0x10, // '4'
+  0x27,0x45,0x45,0x45,0x39, // '5'
+  0x3C,0x4A,0x49,0x49,0x31, // '6'
+  0x41,0x21,0x11,0x09,0x07, // '7'
+  0x36,0x49,0x49,0x49,0x36, // '8'
+  0x46,0x49,0x49,0x29,0x1E, // '9'
+  0x00,0x00,0x14,0x00,0x00, // ':'
+  0x00,0x40,0x34,0x00,0x00, // ';'
+  0x00,0x08,0x14,0x22,0x41, // '<'
+  0x14,0x14,0x14,0x14,0x14, // '='
+  0x00,0x41,0x22,0x14,0x08, // '>'
+  0x02,0x01,0x59,0x09,0x06, // '?'
+  0x3E,0x41,0x5D,0x59,0x4E, // '@'
+  0x7C,0x12,0x11,0x12,0x7C, // 'A'
+  0x7F,0x49,0x49,0x49,0x36, // 'B'
+  0x3E,0x41,0x41,0x41,0x22, // 'C'
+  0x7F,0x41,0x41,0x41,0x3E, // 'D'
+  0x7F,0x49,0x49,0x49,0x41, // 'E'
+  0x7F,0x09,0x09,0x09,0x01, // 'F'
+  0x3E,0x41,0x41,0x51,0x73, // 'G'
+  0x7F,0x08,0x08,0x08,0x7F, // 'H'
+  0x00,0x41,0x7F,0x41,0x00, // 'I'
+  0x20,0x40,0x41,0x3F,0x01, // 'J'
+  0x7F,0x08,0x14,0x22,0x41, // 'K'
+  0x7F,0x40,0x40,0x40,0x40, // 'L'
+  0x7F,0x02,0x1C,0x02,0x7F, // 'M'
+  0x7F,0x04,0x08,0x10,0x7F, // 'N'
+  0x3E,0x41,0x41,0x41,0x3E, // 'O'
+  0x7F,0x09,0x09,0x09,0x06, // 'P'
+  0x3E,0x41,0x51,0x21,0x5E, // 'Q'
+  0x7F,0x09,0x19,0x29,0x46, // 'R'
+  0x26,0x49,0x49,0x49,0x32, // 'S'
+  0x03,0x01,0x7F,0x01,0x03, // 'T'
+  0x3F,0x40,0x40,0x40,0x3F, // 'U'
+  0x1F,0x20,0x40,0x20,0x1F, // 'V'
+  0x3F,0x40,0x38,0x40,0x3F, // 'W'
+  0x63,0x14,0x08,0x14,0x63, // 'X'
+  0x03,0x04,0x78,0x04,0x03, // 'Y'
+  0x61,0x59,0x49,0x4D,0x43, // 'Z'
+  0x00,0x7F,0x41,0x41,0x41, // '['
+  0x02,0x04,0x08,0x10,0x20, // '\'
+  0x00,0x41,0x41,0x41,0x7F, // ']'
+  0x04,0x02,0x01,0x02,0x04, // '^'
+  0x40,0x40,0x40,0x40,0x40, // '_'
+  0x00,0x03,0x07,0x08,0x00, // '`'
+  0x20,0x54,0x54,0x78,0x40, // 'a'
+  0x7F,0x28,0x44,0x44,0x38, // 'b'
+  0x38,0x44,0x44,0x44,0x28, // 'c'
+  0x38,0x44,0x44,0x28,0x7F, // 'd'
+  0x38,0x54,0x54,0x54,0x18, // 'e'
+  0x00,0x08,0x7E,0x09,0x02, // 'f'
+  0x18,0xA4,0xA4,0x9C,0x78, // 'g'
+  0x7F,0x08,0x04,0x04,0x78, // 'h'
+  0x00,0x44,0x7D,0x40,0x00, // 'i'
+  0x20,0x40,0x40,0x3D,0x00, // 'j'
+  0x7F,0x10,0x28,0x44,0x00, // 'k'
+  0x00,0x41,0x7F,0x40,0x00, // 'l'
+  0x7C,0x04,0x78,0x04,0x78, // 'm'
+  0x7C,0x08,0x04,0x04,0x78, // 'n'
+  0x38,0x44,0x44,0x44,0x38, // 'o'
+  0xFC,0x18,0x24,0x24,0x18, // 'p'
+  0x18,0x24,0x24,0x18,0xFC, // 'q'
+  0x7C,0x08,0x04,0x04,0x08, // 'r'
+  0x48,0x54,0x54,0x54,0x24, // 's'
+  0x04,0x04,0x3F,0x44,0x24, // 't'
+  0x3C,0x40,0x40,0x20,0x7C, // 'u'
+  0x1C,0x20,0x40,0x20,0x1C, // 'v'
+  0x3C,0x40,0x30,0x40,0x3C, // 'w'
+  0x44,0x28,0x10,0x28,0x44, // 'x'
+  0x4C,0x90,0x90,0x90,0x7C, // 'y'
+  0x44,0x64,0x54,0x4C,0x44, // 'z'
+  0x00,0x08,0x36,0x41,0x00, // '{'
+  0x00,0x00,0x77,0x00,0x00, // '|'
+  0x00,0x41,0x36,0x08,0x00, // '}'
+  0x02,0x01,0x02,0x04,0x02, // '~'
+};
+
+
+// =======================================================================
+// Public APIs to GUIslice core library
+// =======================================================================
+
+// -----------------------------------------------------------------------
+// Configuration Functions
+// -----------------------------------------------------------------------
+
+bool gslc_DrvInit(gslc_tsGui* pGui)
+{
+  // Primary surface definitions
+  pGui->sImgRefBkgnd = gslc_ResetImage();
+
+  if (pGui->pvDriver == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInit(%s) called with NULL driver\n","");
+    return false;
+  }
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  pDriver->pFrameBuf    = m_anFrameBuf;
+  pDriver->nColBkgnd    = GSLC_COL_BLACK;
+  pDriver->nFrameCnt    = 0;
+  pDriver->nPixelCur    = 0;
+  pDriver->nPixelLast   = 0;
+  pDriver->nPixelTotal  = 0;
+  #if (GSLC_BAND_EN)
+  pDriver->bBandEn       = false;
+  pDriver->rBand         = (gslc_tsRect){0,0,0,0};
+  pDriver->nBandPixelCur = 0;
+  #endif
+  memset(pDriver->anCallCur,0,sizeof(pDriver->anCallCur));
+  memset(pDriver->anCallLast,0,sizeof(pDriver->anCallLast));
+  memset(pDriver->anCallTotal,0,sizeof(pDriver->anCallTotal));
+  pDriver->bFrameStart    = false;
+  pDriver->bFrameDraw     = false;
+  pDriver->nFrameStartUs  = 0;
+  pDriver->nFrameUsLast   = 0;
+  pDriver->nFrameUsTotal  = 0;
+  pDriver->pStatsFile     = NULL;
+
+  // Open the optional per-frame statistics log
+  const char* pStatsFname = getenv("GSLC_MEMFB_STATS");
+  if ((pStatsFname) && (pStatsFname[0] != '\0')) {
+    pDriver->pStatsFile = fopen(pStatsFname,"w");
+    if (pDriver->pStatsFile == NULL) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvInit() can't create stats log (%s)\n",pStatsFname);
+    } else {
+      uint8_t nCall;
+      fprintf(pDriver->pStatsFile,"frame,time_us,pixels,bytes");
+      for (nCall=0;nCall<GSLC_DRVCALL__MAX;nCall++) {
+        fprintf(pDriver->pStatsFile,",%s",m_acDrvCallName[nCall]);
+      }
+      fprintf(pDriver->pStatsFile,"\n");
+    }
+  }
+
+  #if defined(DRV_TOUCH_SCRIPT)
+  pDriver->pScriptFile  = NULL;
+  pDriver->pScriptStr   = NULL;
+  pDriver->nScriptLine  = 0;
+  pDriver->nScriptWait  = 0;
+  pDriver->bScriptDown  = false;
+  pDriver->bScriptPend  = false;
+  pDriver->eScriptPend  = GSLC_INPUT_NONE;
+  pDriver->nScriptPendX = 0;
+  pDriver->nScriptPendY = 0;
+  #endif
+
+  // The framebuffer retains its contents between frames
+  // so partial redraw can be supported
+  pGui->bRedrawPartialEn = true;
+
+  pGui->nRotation   = 0;
+  pGui->nDisp0W     = DRV_MEMFB_WIDTH;
+  pGui->nDisp0H     = DRV_MEMFB_HEIGHT;
+  pGui->nDispW      = DRV_MEMFB_WIDTH;
+  pGui->nDispH      = DRV_MEMFB_HEIGHT;
+  pGui->nDispDepth  = DRV_MEMFB_DEPTH;
+
+  memset(m_anFrameBuf,0,sizeof(m_anFrameBuf));
+
+  gslc_DrvSetClipRect(pGui,NULL);
+
+  return true;
+}
+
+void* gslc_DrvGetDriverDisp(gslc_tsGui* pGui)
+{
+  return (void*)(pGui->pvDriver);
+}
+
+void gslc_DrvDestruct(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver == NULL) {
+    return;
+  }
+  if (pDriver->pStatsFile) {
+    fclose(pDriver->pStatsFile);
+    pDriver->pStatsFile = NULL;
+  }
+  #if defined(DRV_TOUCH_SCRIPT)
+  if (pDriver->pScriptFile) {
+    fclose(pDriver->pScriptFile);
+    pDriver->pScriptFile = NULL;
+  }
+  #endif
+}
+
+const char* gslc_DrvGetNameDisp(gslc_tsGui* pGui)
+{
+  return m_acDrvDisp;
+}
+
+const char* gslc_DrvGetNameTouch(gslc_tsGui* pGui)
+{
+  return m_acDrvTouch;
+}
+
+// -----------------------------------------------------------------------
+// Image/surface handling Functions
+// -----------------------------------------------------------------------
+
+void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
+{
+  // Images are not preloaded. Instead they are decoded
+  // from their source at the time of drawing.
+  return NULL;
+}
+
+
+bool gslc_DrvSetBkgndImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
+{
+  // Dispose of previous background
+  if (pGui->sImgRefBkgnd.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pGui->sImgRefBkgnd.pvImgRaw);
+    pGui->sImgRefBkgnd = gslc_ResetImage();
+  }
+  pGui->sImgRefBkgnd = sImgRef;
+  pGui->sImgRefBkgnd.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  return true;
+}
+
+
+bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol)
+{
+  if (pGui->pvDriver) {
+    gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+    pDriver->nColBkgnd = nCol;
+  }
+  // Dispose of any background image so that the color is used
+  pGui->sImgRefBkgnd = gslc_ResetImage();
+  return true;
+}
+
+
+bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
+{
+  // Dispose of previous image, if any
+  if (pElem->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pElem->sImgRefNorm.pvImgRaw);
+    pElem->sImgRefNorm = gslc_ResetImage();
+  }
+  pElem->sImgRefNorm = sImgRef;
+  pElem->sImgRefNorm.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  return true;
+}
+
+
+bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
+{
+  // Dispose of previous image, if any
+  if (pElem->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pElem->sImgRefGlow.pvImgRaw);
+    pElem->sImgRefGlow = gslc_ResetImage();
+  }
+  pElem->sImgRefGlow = sImgRef;
+  pElem->sImgRefGlow.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  return true;
+}
+
+
+void gslc_DrvImageDestruct(void* pvImg)
+{
+  // Nothing to release as images are not preloaded
+}
+
+bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  // The clipping region is always constrained to the display
+  // so that the drawing routines only need a single test
+  gslc_tsRect rScreen = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+  if (pRect == NULL) {
+    pDriver->rClipRect = rScreen;
+  } else {
+    pDriver->rClipRect = *pRect;
+    if (!gslc_ClipRect(&rScreen,&pDriver->rClipRect)) {
+      pDriver->rClipRect = (gslc_tsRect) { 0, 0, 0, 0 };
+    }
+  }
+  return true;
+}
+
+
+// -----------------------------------------------------------------------
+// Font handling Functions
+// -----------------------------------------------------------------------
+
+const void* gslc_DrvFontAdd(gslc_teFontRefType eFontRefType,const void* pvFontRef,uint16_t nFontSz)
+{
+  // All fonts use the built-in font, so the reference is
+  // only retained to mark the font as valid. The scale is
+  // derived from the font size when drawing.
+  if (pvFontRef == NULL) {
+    // Permit a NULL reference to select the built-in font,
+    // as done in the Arduino drivers
+    return (const void*)m_anFont5x7;
+  }
+  return pvFontRef;
+}
+
+void gslc_DrvFontsDestruct(gslc_tsGui* pGui)
+{
+  // Nothing to release
+}
+
+uint8_t gslc_DrvFontScale(gslc_tsFont* pFont)
+{
+  uint16_t nScale;
+  if (pFont->eFontRefType == GSLC_FONTREF_FNAME) {
+    nScale = (pFont->nSize + 4) / DRV_MEMFB_FONT_CELL_H;
+  } else {
+    nScale = pFont->nSize;
+  }
+  if (nScale < 1) { nScale = 1; }
+  if (nScale > 8) { nScale = 8; }
+  return (uint8_t)nScale;
+}
+
+bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,
+        int16_t* pnTxtX,int16_t* pnTxtY,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH)
+{
+  if ((pFont == NULL) || (pStr == NULL)) { return false; }
+  uint8_t   nScale = gslc_DrvFontScale(pFont);
+  uint16_t  nCols = 0;
+  uint16_t  nColsMax = 0;
+  uint16_t  nLines = 1;
+  const char* pCh;
+
+  for (pCh=pStr;*pCh;pCh++) {
+    if (*pCh == '\n') {
+      nLines++;
+      nCols = 0;
+    } else {
+      nCols++;
+      if (nCols > nColsMax) { nColsMax = nCols; }
+    }
+  }
+  *pnTxtSzW = nColsMax * DRV_MEMFB_FONT_CELL_W * nScale;
+  *pnTxtSzH = nLines * DRV_MEMFB_FONT_CELL_H * nScale;
+  // No offset coordinates used
+  *pnTxtX = 0;
+  *pnTxtY = 0;
+  return true;
+}
+
+
+bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt, gslc_tsColor colBg)
+{
+  if ((pGui == NULL) || (pFont == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawTxt(%s) with NULL ptr\n","");
+    return false;
+  }
+  if (pStr == NULL) { return true; }
+  gslc_DrvCallCount(pGui,GSLC_DRVCALL_TXT);
+
+  uint32_t  nColRaw = gslc_DrvAdaptColorRaw(pGui,colTxt);
+  uint8_t   nScale = gslc_DrvFontScale(pFont);
+  int16_t   nCurX = nTxtX;
+  int16_t   nCurY = nTxtY;
+  uint8_t   nCh;
+  const uint8_t* pGlyph;
+  uint8_t   nCol,nRow,nBits,nRep;
+  int16_t   nRunStart;
+
+  for (;*pStr;pStr++) {
+    nCh = (uint8_t)*pStr;
+    if (nCh == '\n') {
+      nCurX  = nTxtX;
+      nCurY += DRV_MEMFB_FONT_CELL_H * nScale;
+      continue;
+    }
+    if ((nCh < DRV_MEMFB_FONT_FIRST) || (nCh > DRV_MEMFB_FONT_LAST)) {
+      nCh = '?';
+    }
+    pGlyph = &m_anFont5x7[(nCh - DRV_MEMFB_FONT_FIRST) * DRV_MEMFB_FONT_COLS];
+
+    // Draw the glyph a row at a time so that horizontal runs
+    // of set bits become single span fills
+    for (nRow=0;nRow<DRV_MEMFB_FONT_CELL_H;nRow++) {
+      nRunStart = -1;
+      for (nCol=0;nCol<=DRV_MEMFB_FONT_COLS;nCol++) {
+        nBits = (nCol < DRV_MEMFB_FONT_COLS)? pGlyph[nCol] : 0;
+        if (nBits & (1 << nRow)) {
+          if (nRunStart < 0) { nRunStart = nCol; }
+        } else if (nRunStart >= 0) {
+          for (nRep=0;nRep<nScale;nRep++) {
+            gslc_DrvFillSpanRaw(pGui,nCurX+nRunStart*nScale,nCurY+nRow*nScale+nRep,
+              (nCol-nRunStart)*nScale,nColRaw);
+          }
+          nRunStart = -1;
+        }
+      }
+    }
+    nCurX += DRV_MEMFB_FONT_CELL_W * nScale;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------
+// Screen Management Functions
+// -----------------------------------------------------------------------
+
+void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint8_t        nCall;
+
+  // Latch the statistics for the completed frame
+  pDriver->nFrameCnt++;
+  pDriver->nPixelLast   = pDriver->nPixelCur;
+  pDriver->nPixelTotal += pDriver->nPixelCur;
+  pDriver->nPixelCur    = 0;
+  for (nCall=0;nCall<GSLC_DRVCALL__MAX;nCall++) {
+    pDriver->anCallLast[nCall]   = pDriver->anCallCur[nCall];
+    pDriver->anCallTotal[nCall] += pDriver->anCallCur[nCall];
+    pDriver->anCallCur[nCall]    = 0;
+  }
+  if (pDriver->bFrameStart) {
+    pDriver->nFrameUsLast = (uint32_t)(gslc_DrvGetTimeUs() - pDriver->nFrameStartUs);
+  } else {
+    pDriver->nFrameUsLast = 0;
+  }
+  pDriver->nFrameUsTotal += pDriver->nFrameUsLast;
+  pDriver->bFrameStart = false;
+  pDriver->bFrameDraw  = false;
+
+  if (pDriver->pStatsFile) {
+    gslc_DrvStatsLog(pGui);
+  }
+
+  #if (DRV_MEMFB_DUMP_EN)
+  char acFname[128];
+  snprintf(acFname,sizeof(acFname),DRV_MEMFB_DUMP_FNAME,(unsigned)pDriver->nFrameCnt);
+  gslc_DrvDumpFrame(pGui,acFname);
+  #endif
+}
+
+
+// -----------------------------------------------------------------------
+// Band rendering Functions
+// -----------------------------------------------------------------------
+
+bool gslc_DrvBandStart(gslc_tsGui* pGui,gslc_tsRect rBand)
+{
+  #if (GSLC_BAND_EN)
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if ((rBand.w > DRV_MEMFB_LINE_MAX) || (rBand.h > GSLC_BAND_H)) {
+    return false;
+  }
+  pDriver->rBand          = rBand;
+  pDriver->bBandEn        = true;
+  pDriver->nBandPixelCur  = pDriver->nPixelCur;
+  return true;
+  #else
+  (void)pGui; // Unused
+  (void)rBand; // Unused
+  return false;
+  #endif // GSLC_BAND_EN
+}
+
+bool gslc_DrvBandFlush(gslc_tsGui* pGui)
+{
+  #if (GSLC_BAND_EN)
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect     rBand = pDriver->rBand;
+  uint32_t        nRowLen = (uint32_t)rBand.w*DRV_MEMFB_BYTES_PP;
+  int16_t         nRow;
+  if (!pDriver->bBandEn) {
+    return false;
+  }
+  pDriver->bBandEn = false;
+  for (nRow=0;nRow<(int16_t)rBand.h;nRow++) {
+    memcpy(gslc_DrvPixelAddr(pGui,rBand.x,rBand.y+nRow),m_anBandBuf+nRow*nRowLen,nRowLen);
+  }
+  // Only the pixels pushed from the band count as written
+  pDriver->nPixelCur = pDriver->nBandPixelCur + (uint32_t)rBand.w*rBand.h;
+  return true;
+  #else
+  (void)pGui; // Unused
+  return false;
+  #endif // GSLC_BAND_EN
+}
+
+
+// -----------------------------------------------------------------------
+// Page Snapshot Functions
+// -----------------------------------------------------------------------
+
+uint32_t gslc_DrvPageSnapGetSize(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  (void)pGui; // Unused
+  return (uint32_t)sizeof(gslc_tsDrvSnap) + (uint32_t)rRect.w*rRect.h*DRV_MEMFB_BYTES_PP;
+}
+
+bool gslc_DrvPageSnapSave(gslc_tsGui* pGui,void** ppvSnap,gslc_tsRect rRect)
+{
+  gslc_tsDrvSnap* pSnap   = (gslc_tsDrvSnap*)(*ppvSnap);
+  gslc_tsRect     rDisp   = { 0, 0, pGui->nDispW, pGui->nDispH };
+  uint32_t        nRowLen;
+  uint32_t        nSize;
+  uint8_t*        pPixels;
+  int16_t         nRow;
+  #if (GSLC_BAND_EN)
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->bBandEn) {
+    return false;
+  }
+  #endif // GSLC_BAND_EN
+  if ((rRect.w == 0) || (rRect.h == 0) || (!gslc_ClipRect(&rDisp,&rRect))) {
+    return false;
+  }
+  nRowLen = (uint32_t)rRect.w*DRV_MEMFB_BYTES_PP;
+  nSize   = nRowLen*rRect.h;
+  if ((pSnap == NULL) || (pSnap->nSize < nSize)) {
+    pSnap = (gslc_tsDrvSnap*)realloc(pSnap,sizeof(gslc_tsDrvSnap)+nSize);
+    if (pSnap == NULL) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvPageSnapSave() can't allocate %u bytes\n",(unsigned)nSize);
+      return false;
+    }
+    pSnap->nSize = nSize;
+    *ppvSnap = (void*)pSnap;
+  }
+  pSnap->rSnap = rRect;
+  pPixels = (uint8_t*)(pSnap+1);
+  for (nRow=0;nRow<(int16_t)rRect.h;nRow++) {
+    memcpy(pPixels+nRow*nRowLen,gslc_DrvPixelAddr(pGui,rRect.x,rRect.y+nRow),nRowLen);
+  }
+  return true;
+}
+
+bool gslc_DrvPageSnapRestore(gslc_tsGui* pGui,void* pvSnap,gslc_tsRect rRect)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsDrvSnap* pSnap   = (gslc_tsDrvSnap*)pvSnap;
+  uint32_t        nSnapRowLen = (uint32_t)pSnap->rSnap.w*DRV_MEMFB_BYTES_PP;
+  uint8_t*        pPixels;
+  uint8_t*        pSrc;
+  uint8_t*        pDst;
+  int16_t         nRow;
+  int16_t         nCol0,nCol1;
+  #if (GSLC_BAND_EN)
+  if (pDriver->bBandEn) {
+    return false;
+  }
+  #endif // GSLC_BAND_EN
+  // Only the part of the region held in the snapshot is restored
+  if ((rRect.w == 0) || (rRect.h == 0) || (!gslc_ClipRect(&(pSnap->rSnap),&rRect))) {
+    return true;
+  }
+  gslc_DrvCallCount(pGui,GSLC_DRVCALL_COPY);
+  pPixels = (uint8_t*)(pSnap+1) + (uint32_t)(rRect.y-pSnap->rSnap.y)*nSnapRowLen
+    + (uint32_t)(rRect.x-pSnap->rSnap.x)*DRV_MEMFB_BYTES_PP;
+  for (nRow=0;nRow<(int16_t)rRect.h;nRow++) {
+    // Only write the span of each row that differs from the display
+    pSrc  = pPixels+nRow*nSnapRowLen;
+    pDst  = gslc_DrvPixelAddr(pGui,rRect.x,rRect.y+nRow);
+    nCol0 = 0;
+    nCol1 = (int16_t)rRect.w-1;
+    while ((nCol0 <= nCol1) && (memcmp(pDst+nCol0*DRV_MEMFB_BYTES_PP,pSrc+nCol0*DRV_MEMFB_BYTES_PP,DRV_MEMFB_BYTES_PP) == 0)) {
+      nCol0++;
+    }
+    while ((nCol1 >= nCol0) && (memcmp(pDst+nCol1*DRV_MEMFB_BYTES_PP,pSrc+nCol1*DRV_MEMFB_BYTES_PP,DRV_MEMFB_BYTES_PP) == 0)) {
+      nCol1--;
+    }
+    if (nCol0 > nCol1) {
+      continue;
+    }
+    memcpy(pDst+nCol0*DRV_MEMFB_BYTES_PP,pSrc+nCol0*DRV_MEMFB_BYTES_PP,(uint32_t)(nCol1-nCol0+1)*DRV_MEMFB_BYTES_PP);
+    pDriver->nPixelCur += (uint32_t)(nCol1-nCol0+1);
+  }
+  return true;
+}
+
+void gslc_DrvPageSnapFree(gslc_tsGui* pGui,void* pvSnap)
+{
+  (void)pGui; // Unused
+  free(pvSnap);
+}
+
+
+// -----------------------------------------------------------------------
+// Graphics Primitives Functions
+// -----------------------------------------------------------------------
+
+bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
+{
+  gslc_DrvCallCount(pGui,GSLC_DRVCALL_POINT);
+  gslc_DrvFillSpanRaw(pGui,nX,nY,1,gslc_DrvAdaptColorRaw(pGui,nCol));
+  return true;
+}
+
+bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
+{
+  uint32_t  nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
+  uint16_t  nIndPt;
+  gslc_DrvCallCount(pGui,GSLC_DRVCALL_POINTS);
+  for (nIndPt=0;nIndPt<nNumPt;nIndPt++) {
+    gslc_DrvFillSpanRaw(pGui,asPt[nIndPt].x,asPt[nIndPt].y,1,nColRaw);
+  }
+  return true;
+}
+
+bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  gslc_DrvCallCount(pGui,GSLC_DRVCALL_RECT_FILL);
+  uint32_t  nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
+  int16_t   nY;
+  for (nY=rRect.y;nY<rRect.y+(int16_t)rRect.h;nY++) {
+    gslc_DrvFillSpanRaw(pGui,rRect.x,nY,rRect.w,nColRaw);
+  }
+  return true;
+}
+
+bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint32_t        nRowLen = (uint32_t)rSrc.w*DRV_MEMFB_BYTES_PP;
+  int16_t         nRow;
+  #if (GSLC_BAND_EN)
+  // The band buffer only holds the band itself, so
+  // the source may not be available while composing
+  if (pDriver->bBandEn) {
+    return false;
+  }
+  #endif // GSLC_BAND_EN
+  gslc_DrvCallCount(pGui,GSLC_DRVCALL_COPY);
+  // Copy the rows in an order that doesn't overwrite
+  // source rows before they have been read
+  for (nRow=0;nRow<(int16_t)rSrc.h;nRow++) {
+    int16_t nRowCur = (nDstY > rSrc.y)? (int16_t)rSrc.h-1-nRow : nRow;
+    memmove(gslc_DrvPixelAddr(pGui,nDstX,nDstY+nRowCur),
+      gslc_DrvPixelAddr(pGui,rSrc.x,rSrc.y+nRowCur),nRowLen);
+  }
+  pDriver->nPixelCur += (uint32_t)rSrc.w*rSrc.h;
+  return true;
+}
+
+bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  gslc_DrvCallCount(pGui,GSLC_DRVCALL_RECT_FRAME);
+  if ((rRect.w == 0) || (rRect.h == 0)) { return true; }
+  uint32_t  nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
+  int16_t   nY;
+  int16_t   nY1 = rRect.y+rRect.h-1;
+  gslc_DrvFillSpanRaw(pGui,rRect.x,rRect.y,rRect.w,nColRaw);
+  if (rRect.h > 1) {
+    gslc_DrvFillSpanRaw(pGui,rRect.x,nY1,rRect.w,nColRaw);
+  }
+  for (nY=rRect.y+1;nY<nY1;nY++) {
+    gslc_DrvFillSpanRaw(pGui,rRect.x,nY,1,nColRaw);
+    if (rRect.w > 1) {
+      gslc_DrvFillSpanRaw(pGui,rRect.x+rRect.w-1,nY,1,nColRaw);
+    }
+  }
+  return true;
+}
+
+bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
+{
+  uint32_t  nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
+  int16_t   nTmp;
+  gslc_DrvCallCount(pGui,GSLC_DRVCALL_LINE);
+
+  // Horizontal lines are filled as a single span
+  if (nY0 == nY1) {
+    if (nX1 < nX0) { nTmp = nX0; nX0 = nX1; nX1 = nTmp; }
+    gslc_DrvFillSpanRaw(pGui,nX0,nY0,nX1-nX0+1,nColRaw);
+    return true;
+  }
+
+  // Bresenham's algorithm
+  int16_t nDX = (nX1 > nX0)? (nX1-nX0) : (nX0-nX1);
+  int16_t nDY = (nY1 > nY0)? (nY0-nY1) : (nY1-nY0);
+  int16_t nSX = (nX0 < nX1)? 1 : -1;
+  int16_t nSY = (nY0 < nY1)? 1 : -1;
+  int32_t nErr = nDX + nDY;
+  int32_t nErr2;
+  while (true) {
+    gslc_DrvFillSpanRaw(pGui,nX0,nY0,1,nColRaw);
+    if ((nX0 == nX1) && (nY0 == nY1)) { break; }
+    nErr2 = 2*nErr;
+    if (nErr2 >= nDY) { nErr += nDY; nX0 += nSX; }
+    if (nErr2 <= nDX) { nErr += nDX; nY0 += nSY; }
+  }
+  return true;
+}
+
+bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef)
+{
+  // The in-memory driver does not pre-load image data into memory
+  // before calling DrvDrawImage(), so we handle the loading now
+  // (when rendering).
+  gslc_DrvCallCount(pGui,GSLC_DRVCALL_IMAGE);
+  if (sImgRef.eImgFlags == GSLC_IMGREF_NONE) {
+    return true;  // Nothing to do
+
+  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) {
+    if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_BMP24) {
+      // Stream the visible region of the bitmap from the file
+      return gslc_BmpDrawFromFile(pGui,sImgRef.pFname,nDstX,nDstY);
+    } else {
+      GSLC_DEBUG2_PRINT("ERROR: DrvDrawImage(%s) unsupported image format\n",sImgRef.pFname);
+      return false;
+    }
+
+  } else if (((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_RAM) ||
+             ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_PROG)) {
+    // On LINUX there is no separate program memory space
+    if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RAW1) {
+      // Draw a monochrome bitmap
+      // - Dimensions and output color are defined in array header
+      gslc_DrvDrawMonoFromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,false);
+      return true;
+    } else if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_BMP24) {
+      // 24-bit Bitmap (stored as RGB565)
+      gslc_DrvDrawBmp24FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,false);
+      return true;
+    } else {
+      GSLC_DEBUG2_PRINT("ERROR: DrvDrawImage(%s) unsupported image format\n","");
+      return false;
+    }
+
+  } else {
+    // Unsupported source
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawImage() unsupported source eImgFlags=%d\n", sImgRef.eImgFlags);
+    return false;
+  }
+}
+
+void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,
+ const unsigned char *pBitmap,bool bProgMem)
+{
+  const unsigned char*  bmap_base = pBitmap;
+  int16_t         w,h;
+  gslc_tsColor    nCol;
+
+  // Read header
+  w       = *(bmap_base++) << 8;
+  w      |= *(bmap_base++) << 0;
+  h       = *(bmap_base++) << 8;
+  h      |= *(bmap_base++) << 0;
+  nCol.r  = *(bmap_base++);
+  nCol.g  = *(bmap_base++);
+  nCol.b  = *(bmap_base++);
+  bmap_base++;
+
+  uint32_t  nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
+  int16_t   i, j, byteWidth = (w + 7) / 8;
+  int16_t   nRunStart;
+  uint8_t   nByte = 0;
+
+  // Set bits are pushed as horizontal runs
+  for (j=0; j<h; j++) {
+    nRunStart = -1;
+    for (i=0; i<w; i++) {
+      if (i & 7) nByte <<= 1;
+      else nByte = bmap_base[j * byteWidth + i / 8];
+      if (nByte & 0x80) {
+        if (nRunStart < 0) { nRunStart = i; }
+      } else if (nRunStart >= 0) {
+        gslc_DrvFillSpanRaw(pGui,nDstX+nRunStart,nDstY+j,i-nRunStart,nColRaw);
+        nRunStart = -1;
+      }
+    }
+    if (nRunStart >= 0) {
+      gslc_DrvFillSpanRaw(pGui,nDstX+nRunStart,nDstY+j,w-nRunStart,nColRaw);
+    }
+  }
+}
+
+void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  const uint16_t* pImage = (const uint16_t*)pBitmap;
+  int16_t h, w;
+  h = *(pImage++);
+  w = *(pImage++);
+
+  // Determine the visible region of the image
+  gslc_tsRect rVis = { 0, 0, (uint16_t)w, (uint16_t)h };
+  if (!gslc_ClipImgRect(pGui,nDstX,nDstY,w,h,&rVis)) {
+    return;
+  }
+
+  // If transparency is enabled, convert the transparent color once
+  bool      bTransEn = (GSLC_BMP_TRANS_EN) ? true : false;
+  gslc_tsColor sTransCol = pGui->sTransCol;
+  uint16_t  nTransRaw = ((sTransCol.r & 0xF8) << 8) | ((sTransCol.g & 0xFC) << 3) | (sTransCol.b >> 3);
+
+  int16_t   row, col;
+  uint16_t  nColRaw;
+  const uint16_t* pRow;
+  uint8_t*  pDst;
+  gslc_tsColor nCol;
+  uint32_t  nPixelCnt = 0;
+  for (row=rVis.y; row<rVis.y+(int16_t)rVis.h; row++) {
+    pRow = pImage + (int32_t)row*w + rVis.x;
+    pDst = gslc_DrvPixelAddr(pGui,nDstX+rVis.x,nDstY+row);
+    for (col=rVis.x; col<rVis.x+(int16_t)rVis.w; col++) {
+      nColRaw = *(pRow++);
+      if ((bTransEn) && (nColRaw == nTransRaw)) {
+        pDst += DRV_MEMFB_BYTES_PP;
+        continue;
+      }
+      #if (DRV_MEMFB_DEPTH == 16)
+      pDst[0] = (uint8_t)(nColRaw & 0xFF);
+      pDst[1] = (uint8_t)(nColRaw >> 8);
+      #else
+      nCol.r = (uint8_t)(((nColRaw >> 11) & 0x1F) << 3);
+      nCol.g = (uint8_t)(((nColRaw >>  5) & 0x3F) << 2);
+      nCol.b = (uint8_t)(((nColRaw >>  0) & 0x1F) << 3);
+      pDst[0] = nCol.r;
+      pDst[1] = nCol.g;
+      pDst[2] = nCol.b;
+      #endif
+      pDst += DRV_MEMFB_BYTES_PP;
+      nPixelCnt++;
+    }
+  }
+  (void)nCol; // Unused in RGB565 mode
+  pDriver->nPixelCur += nPixelCnt;
+}
+
+bool gslc_DrvDrawRow(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nLen,const gslc_tsColor* pasCol)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect*    pClip = &pDriver->rClipRect;
+  gslc_DrvCallCount(pGui,GSLC_DRVCALL_ROW);
+
+  // Clip the run against the clipping region
+  if ((nY < pClip->y) || (nY >= pClip->y+(int16_t)pClip->h)) { return true; }
+  int16_t nX0 = nX;
+  int16_t nX1 = nX+(int16_t)nLen;
+  if (nX0 < pClip->x) { nX0 = pClip->x; }
+  if (nX1 > pClip->x+(int16_t)pClip->w) { nX1 = pClip->x+(int16_t)pClip->w; }
+  if (nX0 >= nX1) { return true; }
+
+  uint8_t*  pDst = gslc_DrvPixelAddr(pGui,nX0,nY);
+  int16_t   nInd;
+  uint32_t  nColRaw;
+  for (nInd=nX0;nInd<nX1;nInd++) {
+    nColRaw = gslc_DrvAdaptColorRaw(pGui,pasCol[nInd-nX]);
+    pDst[0] = (uint8_t)(nColRaw & 0xFF);
+    pDst[1] = (uint8_t)(nColRaw >> 8);
+    #if (DRV_MEMFB_BYTES_PP == 3)
+    pDst[2] = (uint8_t)(nColRaw >> 16);
+    #endif
+    pDst += DRV_MEMFB_BYTES_PP;
+  }
+  pDriver->nPixelCur += (uint32_t)(nX1-nX0);
+  return true;
+}
+
+void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
+{
+  if (pGui->pvDriver) {
+    gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+    gslc_DrvCallCount(pGui,GSLC_DRVCALL_BKGND);
+
+    // Check to see if an image has been assigned to the background
+    if (pGui->sImgRefBkgnd.eImgFlags == GSLC_IMGREF_NONE) {
+      // No image assigned, so assume flat color background
+      // - Only the current clipping region is filled
+      gslc_tsRect rClip = pDriver->rClipRect;
+      uint32_t    nColRaw = gslc_DrvAdaptColorRaw(pGui,pDriver->nColBkgnd);
+      int16_t     nY;
+      for (nY=rClip.y;nY<rClip.y+(int16_t)rClip.h;nY++) {
+        gslc_DrvFillSpanRaw(pGui,rClip.x,nY,rClip.w,nColRaw);
+      }
+    } else {
+      gslc_DrvDrawImage(pGui,0,0,pGui->sImgRefBkgnd);
+    }
+  }
+}
+
+
+// ------------------------------------------------------------------------
+// Touch Functions (via touch script)
+// ------------------------------------------------------------------------
+
+bool gslc_DrvInitTouch(gslc_tsGui* pGui,const char* acDev)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInitTouch(%s) called with NULL ptr\n","");
+    return false;
+  }
+
+  #if defined(DRV_TOUCH_SCRIPT)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  // The environment overrides the configured script path
+  const char* pFname = getenv("GSLC_TOUCH_SCRIPT");
+  if (pFname == NULL) {
+    pFname = acDev;
+  }
+  if ((pFname == NULL) || (pFname[0] == '\0')) {
+    // No script; an in-memory script may be assigned later
+    return true;
+  }
+  pDriver->pScriptFile = fopen(pFname,"r");
+  if (pDriver->pScriptFile == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInitTouch() can't open touch script (%s)\n",pFname);
+    return false;
+  }
+  #endif
+
+  return true;
+}
+
+void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui)
+{
+  return NULL;
+}
+
+bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPress,gslc_teInputRawEvent* peInputEvent,int16_t* pnInputVal)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvGetTouch(%s) called with NULL ptr\n","");
+    return false;
+  }
+
+  // Each gslc_Update() starts by polling for input, so this
+  // marks the start of the next frame
+  gslc_DrvFrameStart(pGui);
+
+  #if defined(DRV_TOUCH_SCRIPT)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  char      acLine[DRV_TOUCH_SCRIPT_LINE_MAX];
+  char      acCmd[16];
+  char      acArg[DRV_TOUCH_SCRIPT_LINE_MAX];
+  int       nArg1,nArg2;
+  int       nArgs;
+  uint32_t  nFrameCnt,nPixelLast,nPixelTotal;
+
+  // Complete the second half of a tap or key press
+  if (pDriver->bScriptPend) {
+    pDriver->bScriptPend = false;
+    *peInputEvent = pDriver->eScriptPend;
+    if (pDriver->eScriptPend == GSLC_INPUT_TOUCH) {
+      *pnX = pDriver->nScriptPendX;
+      *pnY = pDriver->nScriptPendY;
+      *pnPress = 0;
+      pDriver->bScriptDown = false;
+    } else {
+      *pnInputVal = pDriver->nScriptPendX;
+    }
+    return true;
+  }
+
+  if (pDriver->nScriptWait > 0) {
+    pDriver->nScriptWait--;
+    return false;
+  }
+
+  while (gslc_DrvTouchScriptLine(pDriver,acLine)) {
+    acArg[0] = '\0';
+    nArg1 = 0;
+    nArg2 = 0;
+    nArgs = sscanf(acLine,"%15s %d %d",acCmd,&nArg1,&nArg2);
+
+    if ((strcmp(acCmd,"down") == 0) || (strcmp(acCmd,"move") == 0) ||
+        (strcmp(acCmd,"up") == 0) || (strcmp(acCmd,"tap") == 0)) {
+      if (nArgs != 3) {
+        GSLC_DEBUG2_PRINT("ERROR: DrvGetTouch() script line %u: expected X Y\n",
+          (unsigned)pDriver->nScriptLine);
+        continue;
+      }
+      if (acCmd[0] == 'd') {
+        pDriver->bScriptDown = true;
+      } else if (acCmd[0] == 'u') {
+        pDriver->bScriptDown = false;
+      } else if (acCmd[0] == 't') {
+        // Press now and release on the next poll
+        pDriver->bScriptDown  = true;
+        pDriver->bScriptPend  = true;
+        pDriver->eScriptPend  = GSLC_INPUT_TOUCH;
+        pDriver->nScriptPendX = (int16_t)nArg1;
+        pDriver->nScriptPendY = (int16_t)nArg2;
+      }
+      *pnX = (int16_t)nArg1;
+      *pnY = (int16_t)nArg2;
+      *pnPress = (pDriver->bScriptDown)? 1 : 0;
+      *peInputEvent = GSLC_INPUT_TOUCH;
+      *pnInputVal = 0;
+      return true;
+
+    } else if (strcmp(acCmd,"key") == 0) {
+      if (nArgs < 2) {
+        GSLC_DEBUG2_PRINT("ERROR: DrvGetTouch() script line %u: expected key value\n",
+          (unsigned)pDriver->nScriptLine);
+        continue;
+      }
+      // Key down now and key up on the next poll
+      pDriver->bScriptPend  = true;
+      pDriver->eScriptPend  = GSLC_INPUT_KEY_UP;
+      pDriver->nScriptPendX = (int16_t)nArg1;
+      *peInputEvent = GSLC_INPUT_KEY_DOWN;
+      *pnInputVal = (int16_t)nArg1;
+      return true;
+
+    } else if (strcmp(acCmd,"wait") == 0) {
+      // The current poll counts as the first one
+      if (nArg1 > 1) {
+        pDriver->nScriptWait = (uint32_t)(nArg1 - 1);
+      }
+      return false;
+
+    } else if (strcmp(acCmd,"dump") == 0) {
+      if ((sscanf(acLine,"%15s %79s",acCmd,acArg) != 2) || (!gslc_DrvDumpFrame(pGui,acArg))) {
+        GSLC_DEBUG2_PRINT("ERROR: DrvGetTouch() script line %u: dump failed\n",
+          (unsigned)pDriver->nScriptLine);
+      }
+
+    } else if (strcmp(acCmd,"exit") == 0) {
+      break;
+
+    } else {
+      GSLC_DEBUG2_PRINT("ERROR: DrvGetTouch() script line %u: unknown command (%s)\n",
+        (unsigned)pDriver->nScriptLine,acCmd);
+    }
+  }
+
+  // End of script (or exit command)
+  if ((pDriver->pScriptFile == NULL) && (pDriver->pScriptStr == NULL)) {
+    return false;
+  }
+  if (pDriver->pScriptFile) {
+    fclose(pDriver->pScriptFile);
+    pDriver->pScriptFile = NULL;
+  }
+  pDriver->pScriptStr = NULL;
+
+  gslc_DrvGetFrameStats(pGui,&nFrameCnt,&nPixelLast,&nPixelTotal);
+  if (nFrameCnt == 0) { nFrameCnt = 1; }
+  GSLC_DEBUG_PRINT("MEMFB: frames=%u pixels=%u pixels/frame=%u bytes/frame=%u us/frame=%u\n",
+    (unsigned)pDriver->nFrameCnt,(unsigned)nPixelTotal,(unsigned)(nPixelTotal/nFrameCnt),
+    (unsigned)(nPixelTotal/nFrameCnt*DRV_MEMFB_BYTES_PP),
+    (unsigned)(pDriver->nFrameUsTotal/nFrameCnt));
+  #if (DRV_TOUCH_SCRIPT_EXIT)
+  gslc_Quit(pGui);
+  exit(0);
+  #endif
+  #endif // DRV_TOUCH_SCRIPT
+
+  return false;
+}
+
+// -----------------------------------------------------------------------
+// Dynamic Screen rotation and Touch axes swap/flip functions
+// -----------------------------------------------------------------------
+
+bool gslc_DrvRotate(gslc_tsGui* pGui, uint8_t nRotation)
+{
+  bool bChange = (nRotation != pGui->nRotation);
+
+  // The framebuffer is simply reinterpreted with the
+  // width and height swapped
+  pGui->nRotation = nRotation;
+  if ((nRotation == 1) || (nRotation == 3)) {
+    pGui->nDispW = pGui->nDisp0H;
+    pGui->nDispH = pGui->nDisp0W;
+  } else {
+    pGui->nDispW = pGui->nDisp0W;
+    pGui->nDispH = pGui->nDisp0H;
+  }
+
+  // Update the clipping region
+  gslc_DrvSetClipRect(pGui,NULL);
+
+  return bChange;
+}
+
+
+// -----------------------------------------------------------------------
+// Framebuffer access Functions
+// -----------------------------------------------------------------------
+
+uint8_t* gslc_DrvGetFrameBuf(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  return (pDriver)? pDriver->pFrameBuf : NULL;
+}
+
+gslc_tsColor gslc_DrvGetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsColor    nCol = GSLC_COL_BLACK;
+  if ((nX < 0) || (nY < 0) || (nX >= pGui->nDispW) || (nY >= pGui->nDispH)) {
+    return nCol;
+  }
+  const uint8_t* pPix = pDriver->pFrameBuf + ((int32_t)nY*pGui->nDispW + nX)*DRV_MEMFB_BYTES_PP;
+  #if (DRV_MEMFB_DEPTH == 16)
+  uint16_t nColRaw = pPix[0] | (pPix[1] << 8);
+  uint8_t  nR = (nColRaw >> 11) & 0x1F;
+  uint8_t  nG = (nColRaw >>  5) & 0x3F;
+  uint8_t  nB = (nColRaw >>  0) & 0x1F;
+  // Replicate the high bits so that full intensity maps to 255
+  nCol.r = (nR << 3) | (nR >> 2);
+  nCol.g = (nG << 2) | (nG >> 4);
+  nCol.b = (nB << 3) | (nB >> 2);
+  #else
+  nCol.r = pPix[0];
+  nCol.g = pPix[1];
+  nCol.b = pPix[2];
+  #endif
+  return nCol;
+}
+
+void gslc_DrvGetFrameStats(gslc_tsGui* pGui,uint32_t* pnFrameCnt,uint32_t* pnPixelLast,uint32_t* pnPixelTotal)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pnFrameCnt)   { *pnFrameCnt   = pDriver->nFrameCnt; }
+  if (pnPixelLast)  { *pnPixelLast  = pDriver->nPixelLast; }
+  if (pnPixelTotal) { *pnPixelTotal = pDriver->nPixelTotal; }
+}
+
+uint32_t gslc_DrvGetCallCnt(gslc_tsGui* pGui,gslc_teDrvCall eCall,bool bTotal)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (eCall >= GSLC_DRVCALL__MAX) {
+    return 0;
+  }
+  return (bTotal)? pDriver->anCallTotal[eCall] : pDriver->anCallLast[eCall];
+}
+
+void gslc_DrvGetFrameTime(gslc_tsGui* pGui,uint32_t* pnUsLast,uint64_t* pnUsTotal)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pnUsLast)  { *pnUsLast  = pDriver->nFrameUsLast; }
+  if (pnUsTotal) { *pnUsTotal = pDriver->nFrameUsTotal; }
+}
+
+bool gslc_DrvDumpFrame(gslc_tsGui* pGui,const char* pFname)
+{
+  if ((pGui == NULL) || (pFname == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDumpFrame(%s) called with NULL ptr\n","");
+    return false;
+  }
+  FILE* pFile = fopen(pFname,"wb");
+  if (pFile == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDumpFrame() can't create file (%s)\n",pFname);
+    return false;
+  }
+
+  // Select the output format by the file extension
+  bool        bOk;
+  size_t      nLen = strlen(pFname);
+  if ((nLen >= 4) && (strcmp(pFname+nLen-4,".png") == 0)) {
+    bOk = gslc_DrvDumpPng(pGui,pFile);
+  } else {
+    bOk = gslc_DrvDumpPpm(pGui,pFile);
+  }
+  if (fclose(pFile) != 0) {
+    bOk = false;
+  }
+  if (!bOk) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDumpFrame() failed writing file (%s)\n",pFname);
+  }
+  return bOk;
+}
+
+#if defined(DRV_TOUCH_SCRIPT)
+void gslc_DrvTouchScriptSet(gslc_tsGui* pGui,const char* pScript)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->pScriptFile) {
+    fclose(pDriver->pScriptFile);
+    pDriver->pScriptFile = NULL;
+  }
+  pDriver->pScriptStr  = pScript;
+  pDriver->nScriptLine = 0;
+  pDriver->nScriptWait = 0;
+  pDriver->bScriptPend = false;
+}
+#endif // DRV_TOUCH_SCRIPT
+
+
+// =======================================================================
+// Private Functions
+// =======================================================================
+
+uint32_t gslc_DrvAdaptColorRaw(gslc_tsGui* pGui,gslc_tsColor nCol)
+{
+  #if (DRV_MEMFB_DEPTH == 16)
+  return ((nCol.r & 0xF8) << 8) | ((nCol.g & 0xFC) << 3) | (nCol.b >> 3);
+  #else
+  // Stored in byte order R,G,B
+  return (uint32_t)nCol.r | ((uint32_t)nCol.g << 8) | ((uint32_t)nCol.b << 16);
+  #endif
+}
+
+void gslc_DrvCallCount(gslc_tsGui* pGui,gslc_teDrvCall eCall)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->anCallCur[eCall]++;
+  if (!pDriver->bFrameDraw) {
+    if (!pDriver->bFrameStart) {
+      gslc_DrvFrameStart(pGui);
+    }
+    pDriver->bFrameDraw = true;
+  }
+}
+
+void gslc_DrvFrameStart(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  // Restart the timing on every poll until drawing begins so that
+  // idle gslc_Update() calls are not included in the frame time
+  if (!pDriver->bFrameDraw) {
+    pDriver->nFrameStartUs = gslc_DrvGetTimeUs();
+    pDriver->bFrameStart = true;
+  }
+}
+
+uint64_t gslc_DrvGetTimeUs(void)
+{
+  struct timespec sTime;
+  clock_gettime(CLOCK_MONOTONIC,&sTime);
+  return (uint64_t)sTime.tv_sec*1000000 + (uint64_t)(sTime.tv_nsec/1000);
+}
+
+void gslc_DrvStatsLog(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint8_t        nCall;
+  fprintf(pDriver->pStatsFile,"%u,%u,%u,%u",(unsigned)pDriver->nFrameCnt,
+    (unsigned)pDriver->nFrameUsLast,(unsigned)pDriver->nPixelLast,
+    (unsigned)(pDriver->nPixelLast*DRV_MEMFB_BYTES_PP));
+  for (nCall=0;nCall<GSLC_DRVCALL__MAX;nCall++) {
+    fprintf(pDriver->pStatsFile,",%u",(unsigned)pDriver->anCallLast[nCall]);
+  }
+  fprintf(pDriver->pStatsFile,"\n");
+}
+
+void gslc_DrvFillSpanRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,int16_t nW,uint32_t nColRaw)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect*    pClip = &pDriver->rClipRect;
+
+  // Clip the span against the clipping region
+  // - The clipping region is always within the display
+  if ((nY < pClip->y) || (nY >= pClip->y+(int16_t)pClip->h)) { return; }
+  int16_t nX1 = nX+nW;
+  if (nX < pClip->x) { nX = pClip->x; }
+  if (nX1 > pClip->x+(int16_t)pClip->w) { nX1 = pClip->x+(int16_t)pClip->w; }
+  if (nX >= nX1) { return; }
+
+  uint8_t*  pDst = gslc_DrvPixelAddr(pGui,nX,nY);
+  uint8_t   nB0 = (uint8_t)(nColRaw & 0xFF);
+  uint8_t   nB1 = (uint8_t)(nColRaw >> 8);
+  #if (DRV_MEMFB_BYTES_PP == 3)
+  uint8_t   nB2 = (uint8_t)(nColRaw >> 16);
+  #endif
+  int16_t   nInd;
+  for (nInd=nX;nInd<nX1;nInd++) {
+    *(pDst++) = nB0;
+    *(pDst++) = nB1;
+    #if (DRV_MEMFB_BYTES_PP == 3)
+    *(pDst++) = nB2;
+    #endif
+  }
+  pDriver->nPixelCur += (uint32_t)(nX1-nX);
+}
+
+uint8_t* gslc_DrvPixelAddr(gslc_tsGui* pGui,int16_t nX,int16_t nY)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  #if (GSLC_BAND_EN)
+  if (pDriver->bBandEn) {
+    return m_anBandBuf +
+      ((int32_t)(nY-pDriver->rBand.y)*pDriver->rBand.w + (nX-pDriver->rBand.x))*DRV_MEMFB_BYTES_PP;
+  }
+  #endif
+  return pDriver->pFrameBuf + ((int32_t)nY*pGui->nDispW + nX)*DRV_MEMFB_BYTES_PP;
+}
+
+void gslc_DrvRowToRgb(gslc_tsGui* pGui,int16_t nY,uint8_t* pDst)
+{
+  int16_t       nX;
+  gslc_tsColor  nCol;
+  for (nX=0;nX<pGui->nDispW;nX++) {
+    nCol = gslc_DrvGetPixel(pGui,nX,nY);
+    *(pDst++) = nCol.r;
+    *(pDst++) = nCol.g;
+    *(pDst++) = nCol.b;
+  }
+}
+
+bool gslc_DrvDumpPpm(gslc_tsGui* pGui,FILE* pFile)
+{
+  int16_t   nY;
+  size_t    nRowLen = (size_t)pGui->nDispW*3;
+  fprintf(pFile,"P6\n%d %d\n255\n",pGui->nDispW,pGui->nDispH);
+  for (nY=0;nY<pGui->nDispH;nY++) {
+    gslc_DrvRowToRgb(pGui,nY,m_anLineBuf);
+    if (fwrite(m_anLineBuf,1,nRowLen,pFile) != nRowLen) {
+      return false;
+    }
+  }
+  return true;
+}
+
+uint32_t gslc_DrvPngCrc(uint32_t nCrc,const uint8_t* pBuf,uint32_t nLen)
+{
+  uint32_t  nInd;
+  uint8_t   nBit;
+  nCrc = ~nCrc;
+  for (nInd=0;nInd<nLen;nInd++) {
+    nCrc ^= pBuf[nInd];
+    for (nBit=0;nBit<8;nBit++) {
+      nCrc = (nCrc >> 1) ^ (0xEDB88320UL & (0UL - (nCrc & 1)));
+    }
+  }
+  return ~nCrc;
+}
+
+bool gslc_DrvPngWrite(FILE* pFile,const uint8_t* pBuf,uint32_t nLen,uint32_t* pnCrc)
+{
+  *pnCrc = gslc_DrvPngCrc(*pnCrc,pBuf,nLen);
+  return (fwrite(pBuf,1,nLen,pFile) == nLen);
+}
+
+void gslc_DrvPngPut32(uint8_t* pBuf,uint32_t nVal)
+{
+  pBuf[0] = (uint8_t)(nVal >> 24);
+  pBuf[1] = (uint8_t)(nVal >> 16);
+  pBuf[2] = (uint8_t)(nVal >> 8);
+  pBuf[3] = (uint8_t)(nVal >> 0);
+}
+
+bool gslc_DrvDumpPng(gslc_tsGui* pGui,FILE* pFile)
+{
+  static const uint8_t anSig[8] = { 0x89,'P','N','G','\r','\n',0x1A,'\n' };
+  uint8_t   anBuf[32];
+  uint32_t  nCrc;
+  bool      bOk = true;
+
+  // The image data is stored as RGB888 rows, each preceded by
+  // a filter type byte (0=none), wrapped in a zlib stream of
+  // uncompressed ("stored") deflate blocks of up to 65535 bytes
+  uint32_t  nRowLen = 1 + (uint32_t)pGui->nDispW*3;
+  uint32_t  nRawLen = nRowLen * pGui->nDispH;
+  uint32_t  nBlkCnt = (nRawLen + 65534) / 65535;
+  uint32_t  nZLen   = 2 + nBlkCnt*5 + nRawLen + 4;
+
+  bOk &= (fwrite(anSig,1,sizeof(anSig),pFile) == sizeof(anSig));
+
+  // IHDR: width, height, bit depth 8, color type 2 (RGB)
+  gslc_DrvPngPut32(&anBuf[0],13);
+  memcpy(&anBuf[4],"IHDR",4);
+  gslc_DrvPngPut32(&anBuf[8],pGui->nDispW);
+  gslc_DrvPngPut32(&anBuf[12],pGui->nDispH);
+  anBuf[16] = 8;
+  anBuf[17] = 2;
+  anBuf[18] = 0;  // Compression: deflate
+  anBuf[19] = 0;  // Filter method
+  anBuf[20] = 0;  // No interlace
+  gslc_DrvPngPut32(&anBuf[21],gslc_DrvPngCrc(0,&anBuf[4],17));
+  bOk &= (fwrite(anBuf,1,25,pFile) == 25);
+
+  // IDAT
+  gslc_DrvPngPut32(&anBuf[0],nZLen);
+  bOk &= (fwrite(anBuf,1,4,pFile) == 4);
+  nCrc = 0;
+  anBuf[0] = 'I'; anBuf[1] = 'D'; anBuf[2] = 'A'; anBuf[3] = 'T';
+  anBuf[4] = 0x78; // zlib header: deflate, 32K window
+  anBuf[5] = 0x01; // No preset dictionary, check bits
+  bOk &= gslc_DrvPngWrite(pFile,anBuf,6,&nCrc);
+
+  uint32_t  nAdlerA = 1;
+  uint32_t  nAdlerB = 0;
+  uint32_t  nRawLeft = nRawLen;
+  uint32_t  nBlkLeft = 0;
+  uint32_t  nRowPos,nChunk,nInd;
+  int16_t   nY;
+  for (nY=0;(nY<pGui->nDispH)&&(bOk);nY++) {
+    m_anLineBuf[0] = 0;
+    gslc_DrvRowToRgb(pGui,nY,&m_anLineBuf[1]);
+    for (nInd=0;nInd<nRowLen;nInd++) {
+      nAdlerA = (nAdlerA + m_anLineBuf[nInd]) % 65521;
+      nAdlerB = (nAdlerB + nAdlerA) % 65521;
+    }
+
+    // Split the row across stored blocks as needed
+    for (nRowPos=0;nRowPos<nRowLen;nRowPos+=nChunk) {
+      if (nBlkLeft == 0) {
+        nBlkLeft = (nRawLeft > 65535)? 65535 : nRawLeft;
+        anBuf[0] = (nBlkLeft == nRawLeft)? 1 : 0; // BFINAL, BTYPE=00
+        anBuf[1] = (uint8_t)(nBlkLeft & 0xFF);
+        anBuf[2] = (uint8_t)(nBlkLeft >> 8);
+        anBuf[3] = (uint8_t)(~nBlkLeft & 0xFF);
+        anBuf[4] = (uint8_t)((~nBlkLeft >> 8) & 0xFF);
+        bOk &= gslc_DrvPngWrite(pFile,anBuf,5,&nCrc);
+      }
+      nChunk = nRowLen - nRowPos;
+      if (nChunk > nBlkLeft) { nChunk = nBlkLeft; }
+      bOk &= gslc_DrvPngWrite(pFile,&m_anLineBuf[nRowPos],nChunk,&nCrc);
+      nBlkLeft -= nChunk;
+      nRawLeft -= nChunk;
+    }
+  }
+  gslc_DrvPngPut32(&anBuf[0],(nAdlerB << 16) | nAdlerA);
+  bOk &= gslc_DrvPngWrite(pFile,anBuf,4,&nCrc);
+  gslc_DrvPngPut32(&anBuf[0],nCrc);
+  bOk &= (fwrite(anBuf,1,4,pFile) == 4);
+
+  // IEND
+  gslc_DrvPngPut32(&anBuf[0],0);
+  memcpy(&anBuf[4],"IEND",4);
+  gslc_DrvPngPut32(&anBuf[8],gslc_DrvPngCrc(0,&anBuf[4],4));
+  bOk &= (fwrite(anBuf,1,12,pFile) == 12);
+
+  return bOk;
+}
+
+#if defined(DRV_TOUCH_SCRIPT)
+bool gslc_DrvTouchScriptLine(gslc_tsDriver* pDriver,char* acLine)
+{
+  char*   pCh;
+  size_t  nLen;
+
+  while (true) {
+    if (pDriver->pScriptFile) {
+      if (fgets(acLine,DRV_TOUCH_SCRIPT_LINE_MAX,pDriver->pScriptFile) == NULL) {
+        return false;
+      }
+    } else if ((pDriver->pScriptStr) && (*pDriver->pScriptStr)) {
+      pCh = strchr(pDriver->pScriptStr,'\n');
+      nLen = (pCh)? (size_t)(pCh - pDriver->pScriptStr) : strlen(pDriver->pScriptStr);
+      if (nLen >= DRV_TOUCH_SCRIPT_LINE_MAX) { nLen = DRV_TOUCH_SCRIPT_LINE_MAX-1; }
+      memcpy(acLine,pDriver->pScriptStr,nLen);
+      acLine[nLen] = '\0';
+      pDriver->pScriptStr = (pCh)? pCh+1 : pDriver->pScriptStr+strlen(pDriver->pScriptStr);
+    } else {
+      return false;
+    }
+    pDriver->nScriptLine++;
+
+    // Strip comments and skip blank lines
+    pCh = strchr(acLine,'#');
+    if (pCh) { *pCh = '\0'; }
+    for (pCh=acLine;(*pCh==' ')||(*pCh=='\t')||(*pCh=='\r')||(*pCh=='\n');pCh++) { }
+    if (*pCh != '\0') {
+      return true;
+    }
+  }
+}
+#endif // DRV_TOUCH_SCRIPT
+
+// =======================================================================
+
+#endif // Compiler guard for requested driver
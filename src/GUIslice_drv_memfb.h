@@ -0,0 +1,1007 @@
+#ifndef _GUISLICE_DRV_MEMFB_H_
+#define _GUISLICE_DRV_MEMFB_H_
+
+// =======================================================================
+// GUIslice library (driver layer for in-memory framebuffer)
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2020 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+/// \file GUIslice_drv_memfb.h
+/// \brief GUIslice library (driver layer for headless in-memory framebuffer)
+
+
+// =======================================================================
+// Driver Layer for in-memory framebuffer
+// - Renders into a RAM buffer without any display hardware, window
+//   system or graphics library. This allows the LINUX examples to be
+//   run headless (eg. on a build server) for benchmarking and testing.
+// - Frames may optionally be written out as PPM or PNG images.
+// - Text is rendered with a built-in 5x7 font. Font files passed
+//   to gslc_FontSet() are not loaded; the font size selects the
+//   text scale instead.
+// - Touch input can be replayed from a script (DRV_TOUCH_SCRIPT)
+// =======================================================================
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include "GUIslice.h"
+
+#include <stdio.h>
+
+
+// =======================================================================
+// API support definitions
+// - These defines indicate whether the driver includes optimized
+//   support for various APIs. If a define is set to 0, then the
+//   GUIslice core emulation will be used instead.
+// - At the very minimum, the point draw routine must be available:
+//   gslc_DrvDrawPoint()
+// =======================================================================
+
+#define DRV_HAS_DRAW_POINT             1 ///< Support gslc_DrvDrawPoint()
+
+#define DRV_HAS_DRAW_POINTS            1 ///< Support gslc_DrvDrawPoints()
+#define DRV_HAS_DRAW_LINE              1 ///< Support gslc_DrvDrawLine()
+#define DRV_HAS_DRAW_RECT_FRAME        1 ///< Support gslc_DrvDrawFrameRect()
+#define DRV_HAS_DRAW_RECT_FILL         1 ///< Support gslc_DrvDrawFillRect()
+#define DRV_HAS_DRAW_RECT_ROUND_FRAME  0 ///< Support gslc_DrvDrawFrameRoundRect()
+#define DRV_HAS_DRAW_RECT_ROUND_FILL   0 ///< Support gslc_DrvDrawFillRoundRect()
+#define DRV_HAS_DRAW_CIRCLE_FRAME      0 ///< Support gslc_DrvDrawFrameCircle()
+#define DRV_HAS_DRAW_CIRCLE_FILL       0 ///< Support gslc_DrvDrawFillCircle()
+#define DRV_HAS_DRAW_TRI_FRAME         0 ///< Support gslc_DrvDrawFrameTriangle()
+#define DRV_HAS_DRAW_TRI_FILL          0 ///< Support gslc_DrvDrawFillTriangle()
+#define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
+#define DRV_HAS_DRAW_BMP_MEM           1 ///< Support gslc_DrvDrawBmp24FromMem()
+#define DRV_HAS_DRAW_ROW               1 ///< Support gslc_DrvDrawRow()
+#define DRV_HAS_BAND                   1 ///< Support gslc_DrvBandStart() / gslc_DrvBandFlush()
+#define DRV_HAS_COPY_RECT              1 ///< Support gslc_DrvCopyRect()
+#define DRV_HAS_FRAME_LOCK             0 ///< Support gslc_DrvFrameLock() / gslc_DrvFrameUnlock()
+#define DRV_HAS_PAGE_SNAP              1 ///< Support gslc_DrvPageSnapSave() / gslc_DrvPageSnapRestore()
+
+#define DRV_OVERRIDE_TXT_ALIGN         0 ///< Driver provides text alignment
+
+// -----------------------------------------------------------------------
+// Additional defines
+// - Provide default if not in config file
+// -----------------------------------------------------------------------
+
+// Framebuffer dimensions (in native orientation)
+#if !defined(DRV_MEMFB_WIDTH)
+  #define DRV_MEMFB_WIDTH       320
+#endif
+#if !defined(DRV_MEMFB_HEIGHT)
+  #define DRV_MEMFB_HEIGHT      240
+#endif
+
+// Framebuffer pixel format
+// - 16: RGB565 (2 bytes per pixel, matches most embedded displays)
+// - 24: RGB888 (3 bytes per pixel)
+#if !defined(DRV_MEMFB_DEPTH)
+  #define DRV_MEMFB_DEPTH       16
+#endif
+#if (DRV_MEMFB_DEPTH == 16)
+  #define DRV_MEMFB_BYTES_PP    2
+#elif (DRV_MEMFB_DEPTH == 24)
+  #define DRV_MEMFB_BYTES_PP    3
+#else
+  #error "CONFIG: DRV_MEMFB_DEPTH must be 16 or 24"
+#endif
+
+// Frame dump on every page flip
+// - Set DRV_MEMFB_DUMP_EN to 1 to write each flipped frame to a file
+// - DRV_MEMFB_DUMP_FNAME is a printf format given the frame number.
+//   The ".png" extension selects PNG output, otherwise PPM is used.
+#if !defined(DRV_MEMFB_DUMP_EN)
+  #define DRV_MEMFB_DUMP_EN     0
+#endif
+#if !defined(DRV_MEMFB_DUMP_FNAME)
+  #define DRV_MEMFB_DUMP_FNAME  "memfb_%05u.ppm"
+#endif
+
+// Scripted touch input
+// - DRV_TOUCH_SCRIPT_EXIT: Terminate the program (with a summary of
+//   the frame statistics) once the end of the script is reached
+// - The environment variable GSLC_TOUCH_SCRIPT overrides the script
+//   path passed in GSLC_DEV_TOUCH
+#if !defined(DRV_TOUCH_SCRIPT_EXIT)
+  #define DRV_TOUCH_SCRIPT_EXIT 1
+#endif
+#define DRV_TOUCH_SCRIPT_LINE_MAX 80  ///< Longest script line
+
+// Per-frame statistics log
+// - If the environment variable GSLC_MEMFB_STATS names a file, one
+//   CSV line is written to it for every frame flipped. Each line
+//   contains the frame time, the pixels and bytes written and the
+//   number of calls made to each driver drawing function.
+
+
+// =======================================================================
+// Types
+// =======================================================================
+
+/// Driver drawing functions counted in the frame statistics
+typedef enum {
+  GSLC_DRVCALL_POINT = 0,       ///< gslc_DrvDrawPoint()
+  GSLC_DRVCALL_POINTS,          ///< gslc_DrvDrawPoints()
+  GSLC_DRVCALL_LINE,            ///< gslc_DrvDrawLine()
+  GSLC_DRVCALL_RECT_FRAME,      ///< gslc_DrvDrawFrameRect()
+  GSLC_DRVCALL_RECT_FILL,       ///< gslc_DrvDrawFillRect()
+  GSLC_DRVCALL_TXT,             ///< gslc_DrvDrawTxt()
+  GSLC_DRVCALL_IMAGE,           ///< gslc_DrvDrawImage()
+  GSLC_DRVCALL_ROW,             ///< gslc_DrvDrawRow()
+  GSLC_DRVCALL_BKGND,           ///< gslc_DrvDrawBkgnd()
+  GSLC_DRVCALL_COPY,            ///< gslc_DrvCopyRect()
+
+  GSLC_DRVCALL__MAX             ///< Number of counted functions
+} gslc_teDrvCall;
+
+
+// =======================================================================
+// Driver-specific members
+// =======================================================================
+typedef struct {
+  uint8_t*            pFrameBuf;        ///< Framebuffer (nDispW x nDispH)
+  gslc_tsColor        nColBkgnd;        ///< Background color (if not image-based)
+
+  gslc_tsRect         rClipRect;        ///< Clipping rectangle
+
+  uint32_t            nFrameCnt;        ///< Number of frames flipped
+  uint32_t            nPixelCur;        ///< Pixels written since the last flip
+  uint32_t            nPixelLast;       ///< Pixels written in the last flipped frame
+  uint32_t            nPixelTotal;      ///< Pixels written in total
+
+  uint32_t            anCallCur[GSLC_DRVCALL__MAX];   ///< Driver calls since the last flip
+  uint32_t            anCallLast[GSLC_DRVCALL__MAX];  ///< Driver calls in the last flipped frame
+  uint32_t            anCallTotal[GSLC_DRVCALL__MAX]; ///< Driver calls in total
+  bool                bFrameStart;      ///< Frame start time has been recorded
+  bool                bFrameDraw;       ///< Drawing has occurred since the last flip
+  uint64_t            nFrameStartUs;    ///< Time of first poll or draw in the frame (us)
+  uint32_t            nFrameUsLast;     ///< Duration of the last flipped frame (us)
+  uint64_t            nFrameUsTotal;    ///< Duration of all flipped frames (us)
+  FILE*               pStatsFile;       ///< Per-frame statistics log (or NULL)
+
+  #if (GSLC_BAND_EN)
+  bool                bBandEn;          ///< Drawing is redirected to the band buffer
+  gslc_tsRect         rBand;            ///< Region covered by the band buffer
+  uint32_t            nBandPixelCur;    ///< Pixels written before the band was started
+  #endif
+
+  #if defined(DRV_TOUCH_SCRIPT)
+  FILE*               pScriptFile;      ///< Touch script file (or NULL)
+  const char*         pScriptStr;       ///< Touch script in memory (or NULL)
+  uint32_t            nScriptLine;      ///< Current line in script (for errors)
+  uint32_t            nScriptWait;      ///< Remaining polls to wait before next command
+  bool                bScriptDown;      ///< Current touch press state
+  bool                bScriptPend;      ///< Pending second half of a tap / key
+  gslc_teInputRawEvent eScriptPend;     ///< Pending event type
+  int16_t             nScriptPendX;     ///< Pending touch X / key value
+  int16_t             nScriptPendY;     ///< Pending touch Y
+  #endif
+
+} gslc_tsDriver;
+
+
+
+// =======================================================================
+// Public APIs to GUIslice core library
+// - These functions define the renderer / driver-dependent
+//   implementations for the core drawing operations within
+//   GUIslice.
+// =======================================================================
+
+
+// -----------------------------------------------------------------------
+// Configuration Functions
+// -----------------------------------------------------------------------
+
+///
+/// Initialize the in-memory framebuffer
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvInit(gslc_tsGui* pGui);
+
+
+///
+/// Free up any members associated with the driver
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvDestruct(gslc_tsGui* pGui);
+
+
+///
+/// Get the display driver name
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return String containing driver name
+///
+const char* gslc_DrvGetNameDisp(gslc_tsGui* pGui);
+
+
+///
+/// Get the touch driver name
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return String containing driver name
+///
+const char* gslc_DrvGetNameTouch(gslc_tsGui* pGui);
+
+///
+/// Get the native display driver instance
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return Void pointer to the display driver instance (gslc_tsDriver)
+///
+void* gslc_DrvGetDriverDisp(gslc_tsGui* pGui);
+
+///
+/// Get the native touch driver instance
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return Void pointer to the touch driver instance (NULL as the
+///         touch script is handled by the display driver)
+///
+void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui);
+
+
+// -----------------------------------------------------------------------
+// Image/surface handling Functions
+// -----------------------------------------------------------------------
+
+///
+/// Load a bitmap (*.bmp) and create a new image resource.
+/// Transparency is enabled by GSLC_BMP_TRANS_EN
+/// through use of color (GSLC_BMP_TRANS_RGB).
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return Image pointer (surface/texture) or NULL if error
+///
+void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef);
+
+
+///
+/// Configure the background to use a bitmap image
+/// - The background is used when redrawing the entire page
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSetBkgndImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef);
+
+
+///
+/// Configure the background to use a solid color
+/// - The background is used when redrawing the entire page
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nCol:        RGB Color to use
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol);
+
+
+///
+/// Set an element's normal-state image
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element to update
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef);
+
+
+///
+/// Set an element's glow-state image
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element to update
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef);
+
+
+///
+/// Release an image surface
+///
+/// \param[in]  pvImg:          Void ptr to image
+///
+/// \return none
+///
+void gslc_DrvImageDestruct(void* pvImg);
+
+
+///
+/// Set the clipping rectangle for future drawing updates
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  pRect:         Rectangular region to constrain edits
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect);
+
+
+// -----------------------------------------------------------------------
+// Font handling Functions
+// -----------------------------------------------------------------------
+
+///
+/// Load a font from a resource and return pointer to it
+/// - All fonts are rendered with the built-in 5x7 font
+/// - For GSLC_FONTREF_PTR, nFontSz is the text scale (as in
+///   the Arduino drivers). For GSLC_FONTREF_FNAME, the font file
+///   is not loaded and nFontSz (points) is mapped to the nearest
+///   text scale.
+///
+/// \param[in]  eFontRefType:   Font reference type
+/// \param[in]  pvFontRef:      Font reference pointer
+/// \param[in]  nFontSz:        Typeface size to use
+///
+/// \return Void ptr to driver-specific font (the font reference)
+///
+const void* gslc_DrvFontAdd(gslc_teFontRefType eFontRefType,const void* pvFontRef,uint16_t nFontSz);
+
+///
+/// Release all fonts defined in the GUI
+///
+/// \param[in]  pGui:          Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvFontsDestruct(gslc_tsGui* pGui);
+
+
+///
+/// Get the extent (width and height) of a text string
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pFont:       Ptr to Font structure
+/// \param[in]  pStr:        String to display
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[out] pnTxtX:      Ptr to offset X of text
+/// \param[out] pnTxtY:      Ptr to offset Y of text
+/// \param[out] pnTxtSzW:    Ptr to width of text
+/// \param[out] pnTxtSzH:    Ptr to height of text
+///
+/// \return true if success, false if failure
+///
+bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,
+        int16_t* pnTxtX,int16_t* pnTxtY,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH);
+
+
+///
+/// Draw a text string at the given coordinate
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nTxtX:       X coordinate of top-left text string
+/// \param[in]  nTxtY:       Y coordinate of top-left text string
+/// \param[in]  pFont:       Ptr to Font
+/// \param[in]  pStr:        String to display
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[in]  colTxt:      Color to draw text
+/// \param[in]  colBg:       unused (text is drawn transparently)
+///
+/// \return true if success, false if failure
+///
+bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt,gslc_tsColor colBg);
+
+
+// -----------------------------------------------------------------------
+// Screen Management Functions
+// -----------------------------------------------------------------------
+
+///
+/// Force a page flip to occur
+/// - Completes the frame statistics and writes the frame
+///   to a file if DRV_MEMFB_DUMP_EN is set
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvPageFlipNow(gslc_tsGui* pGui);
+
+
+// -----------------------------------------------------------------------
+// Band rendering Functions
+// -----------------------------------------------------------------------
+
+///
+/// Start composing a band of the display in the band buffer
+/// - All drawing is redirected to the band buffer until
+///   gslc_DrvBandFlush() is called
+/// - The caller restricts the clipping region to the band
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rBand:       Region of the display covered by the band
+///                          (at most GSLC_BAND_H lines)
+///
+/// \return true if success, false if the band doesn't fit in the buffer
+///
+bool gslc_DrvBandStart(gslc_tsGui* pGui,gslc_tsRect rBand);
+
+///
+/// Copy the completed band into the framebuffer and end the
+/// redirection started by gslc_DrvBandStart()
+/// - The band counts as a single write of its pixels in the
+///   frame statistics
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvBandFlush(gslc_tsGui* pGui);
+
+
+// -----------------------------------------------------------------------
+// Page Snapshot Functions
+// -----------------------------------------------------------------------
+
+///
+/// Get the storage required for a snapshot of a region of the display
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the display
+///
+/// \return Size of the snapshot in bytes (or 0 if not supported)
+///
+uint32_t gslc_DrvPageSnapGetSize(gslc_tsGui* pGui,gslc_tsRect rRect);
+
+///
+/// Save a region of the display into a snapshot (see gslc_PageSetCacheEn)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in,out] ppvSnap:  Ptr to the snapshot storage. If it is NULL
+///                          (or too small for the region), the storage
+///                          is (re)allocated first.
+/// \param[in]  rRect:       Region of the display to save
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvPageSnapSave(gslc_tsGui* pGui,void** ppvSnap,gslc_tsRect rRect);
+
+///
+/// Restore a region of a snapshot of the display saved by gslc_DrvPageSnapSave()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pvSnap:      Snapshot storage
+/// \param[in]  rRect:       Region of the display to restore (within
+///                          the region saved in the snapshot)
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvPageSnapRestore(gslc_tsGui* pGui,void* pvSnap,gslc_tsRect rRect);
+
+///
+/// Release the storage of a snapshot
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pvSnap:      Snapshot storage
+///
+/// \return none
+///
+void gslc_DrvPageSnapFree(gslc_tsGui* pGui,void* pvSnap);
+
+
+// -----------------------------------------------------------------------
+// Graphics Primitives Functions
+// -----------------------------------------------------------------------
+
+///
+/// Draw a point
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of point
+/// \param[in]  nY:          Y coordinate of point
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol);
+
+///
+/// Draw a point
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asPt:        Array of points to draw
+/// \param[in]  nNumPt:      Number of points in array
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol);
+
+///
+/// Draw a framed rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to frame
+/// \param[in]  nCol:        Color RGB value to frame
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
+
+
+///
+/// Draw a filled rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to fill
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
+
+
+///
+/// Copy a rectangular region of the display to another position
+/// - The source and destination regions may overlap
+/// - The caller ensures that both regions are on the display
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rSrc:        Region to copy
+/// \param[in]  nDstX:       Destination X coordinate (top-left)
+/// \param[in]  nDstY:       Destination Y coordinate (top-left)
+///
+/// \return true if success, false if not supported
+///
+bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY);
+
+
+///
+/// Draw a line
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         Line start (X coordinate)
+/// \param[in]  nY0:         Line start (Y coordinate)
+/// \param[in]  nX1:         Line finish (X coordinate)
+/// \param[in]  nY1:         Line finish (Y coordinate)
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
+
+
+///
+/// Copy all of source image to destination screen at specified coordinate
+/// - Supports BMP files (GSLC_IMGREF_SRC_FILE) and the monochrome and
+///   24-bit bitmap arrays (GSLC_IMGREF_SRC_RAM / _PROG)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coord for copy
+/// \param[in]  nDstY:       Destination Y coord for copy
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef);
+
+
+///
+/// Draw a monochrome bitmap from a memory array
+/// - Draw from the bitmap buffer using the foreground color
+///   defined in the header (unset bits are transparent)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coord for copy
+/// \param[in]  nDstY:       Destination Y coord for copy
+/// \param[in]  pBitmap:     Pointer to bitmap buffer
+/// \param[in]  bProgMem:    Bitmap is stored in Flash if true, RAM otherwise
+///
+/// \return none
+///
+void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY, const unsigned char *pBitmap,bool bProgMem);
+
+
+///
+/// Draw a color 24-bit depth bitmap from a memory array
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       X coord for copy
+/// \param[in]  nDstY:       Y coord for copy
+/// \param[in]  pBitmap:     Pointer to bitmap buffer
+/// \param[in]  bProgMem:    Bitmap is stored in Flash if true, RAM otherwise
+///
+/// \return none
+///
+void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem);
+
+
+///
+/// Draw a horizontal run of pixels
+/// - Used by the BMP streaming decoder (gslc_BmpDraw) to push the
+///   visible portion of each scanline
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of the first pixel
+/// \param[in]  nY:          Y coordinate of the row
+/// \param[in]  nLen:        Number of pixels in the run
+/// \param[in]  pasCol:      Array of pixel colors
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawRow(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nLen,const gslc_tsColor* pasCol);
+
+
+///
+/// Copy the background image to destination screen
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return true if success, false if fail
+///
+void gslc_DrvDrawBkgnd(gslc_tsGui* pGui);
+
+
+// -----------------------------------------------------------------------
+// Touch Functions
+// -----------------------------------------------------------------------
+
+///
+/// Perform any touchscreen-specific initialization
+/// - With DRV_TOUCH_SCRIPT, opens the touch script file
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  acDev:       Path to touch script file (may be empty)
+///
+/// \return true if successful
+///
+bool gslc_DrvInitTouch(gslc_tsGui* pGui,const char* acDev);
+
+
+///
+/// Get the next touch event from the touch script
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnX:         Ptr to X coordinate of last touch event
+/// \param[out] pnY:         Ptr to Y coordinate of last touch event
+/// \param[out] pnPress:     Ptr to Pressure level of last touch event (0 for none, 1 for touch)
+/// \param[out] peInputEvent Indication of event type
+/// \param[out] pnInputVal   Additional data for event type
+///
+/// \return true if an event was detected or false otherwise
+///
+bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPress,gslc_teInputRawEvent* peInputEvent,int16_t* pnInputVal);
+
+
+// -----------------------------------------------------------------------
+// Dynamic Screen rotation and Touch axes swap/flip functions
+// -----------------------------------------------------------------------
+
+///
+/// Change rotation
+/// - The framebuffer is stored in the rotated orientation
+///   (ie. with the rotated width and height)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nRotation:   Screen Rotation value (0, 1, 2 or 3)
+///
+/// \return true if successful
+///
+bool gslc_DrvRotate(gslc_tsGui* pGui, uint8_t nRotation);
+
+
+// -----------------------------------------------------------------------
+// Framebuffer access Functions
+// -----------------------------------------------------------------------
+
+///
+/// Get a pointer to the framebuffer
+/// - Pixels are stored row by row (nDispW x nDispH) in
+///   RGB565 (little-endian) or RGB888 format (DRV_MEMFB_DEPTH)
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return Pointer to framebuffer or NULL if not initialized
+///
+uint8_t* gslc_DrvGetFrameBuf(gslc_tsGui* pGui);
+
+///
+/// Read the color of a pixel in the framebuffer
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of pixel
+/// \param[in]  nY:          Y coordinate of pixel
+///
+/// \return Pixel color (black if out of range)
+///
+gslc_tsColor gslc_DrvGetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY);
+
+///
+/// Fetch the frame statistics
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnFrameCnt:  Ptr to number of frames flipped
+/// \param[out] pnPixelLast: Ptr to pixels written in the last flipped frame
+/// \param[out] pnPixelTotal:Ptr to pixels written in total
+///
+/// \return none
+///
+void gslc_DrvGetFrameStats(gslc_tsGui* pGui,uint32_t* pnFrameCnt,uint32_t* pnPixelLast,uint32_t* pnPixelTotal);
+
+///
+/// Fetch the number of calls to a driver drawing function
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  eCall:       Drawing function
+/// \param[in]  bTotal:      Return the total count if true, otherwise
+///                          the count in the last flipped frame
+///
+/// \return Number of calls
+///
+uint32_t gslc_DrvGetCallCnt(gslc_tsGui* pGui,gslc_teDrvCall eCall,bool bTotal);
+
+///
+/// Fetch the duration of flipped frames
+/// - A frame is timed from the last touch poll (ie. the start of the
+///   gslc_Update() call) before drawing begins until the page flip
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnUsLast:    Ptr to duration of the last frame (us)
+/// \param[out] pnUsTotal:   Ptr to duration of all frames (us)
+///
+/// \return none
+///
+void gslc_DrvGetFrameTime(gslc_tsGui* pGui,uint32_t* pnUsLast,uint64_t* pnUsTotal);
+
+///
+/// Write the current framebuffer contents to an image file
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pFname:      Output filename. A ".png" extension
+///                          selects PNG output, otherwise PPM (P6)
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDumpFrame(gslc_tsGui* pGui,const char* pFname);
+
+#if defined(DRV_TOUCH_SCRIPT)
+///
+/// Assign an in-memory touch script
+/// - Replaces any script file opened by gslc_DrvInitTouch()
+/// - The string must remain valid while the script is running
+///
+/// Script format (one command per line, '#' starts a comment):
+/// - "down X Y":  Press at (X,Y)
+/// - "move X Y":  Move to (X,Y) keeping the current press state
+/// - "up X Y":    Release at (X,Y)
+/// - "tap X Y":   Press and release at (X,Y) on consecutive polls
+/// - "key N":     Key down and key up with key value N
+/// - "wait N":    Report no event for the next N polls (each
+///                gslc_Update() call polls until no event is returned)
+/// - "dump FILE": Write the current frame to FILE
+/// - "exit":      Report frame statistics and terminate
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pScript:     Script text
+///
+/// \return none
+///
+void gslc_DrvTouchScriptSet(gslc_tsGui* pGui,const char* pScript);
+#endif // DRV_TOUCH_SCRIPT
+
+
+// =======================================================================
+// Private Functions
+// - These functions are not included in the scope of APIs used by
+//   the core GUIslice library. Instead, these functions are used
+//   to support the operations within this driver layer.
+// =======================================================================
+
+///
+/// Convert a color into the framebuffer pixel format
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nCol:        RGB color
+///
+/// \return Raw pixel value
+///
+uint32_t gslc_DrvAdaptColorRaw(gslc_tsGui* pGui,gslc_tsColor nCol);
+
+///
+/// Determine the text scale for a font
+/// - GSLC_FONTREF_PTR uses the font size as the scale
+/// - GSLC_FONTREF_FNAME maps the point size onto the 8 pixel cell
+///
+/// \param[in]  pFont:       Ptr to Font
+///
+/// \return Text scale (1..8)
+///
+uint8_t gslc_DrvFontScale(gslc_tsFont* pFont);
+
+///
+/// Count a call to a driver drawing function
+/// - Also marks the start of the frame if not already done
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  eCall:       Drawing function
+///
+/// \return none
+///
+void gslc_DrvCallCount(gslc_tsGui* pGui,gslc_teDrvCall eCall);
+
+///
+/// Mark the start of a frame for the frame timing
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvFrameStart(gslc_tsGui* pGui);
+
+///
+/// Get a monotonic timestamp
+///
+/// \return Time in microseconds
+///
+uint64_t gslc_DrvGetTimeUs(void);
+
+///
+/// Write the statistics of the last flipped frame to the stats log
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvStatsLog(gslc_tsGui* pGui);
+
+///
+/// Fill a horizontal span with a raw pixel value
+/// - The span is clipped to the clipping rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of span start
+/// \param[in]  nY:          Y coordinate of span
+/// \param[in]  nW:          Width of span
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_DrvFillSpanRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,int16_t nW,uint32_t nColRaw);
+
+///
+/// Get the address of a pixel in the current drawing target
+/// - This is the band buffer while a band is being composed,
+///   otherwise the framebuffer
+/// - The coordinate must lie within the clipping region
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate
+/// \param[in]  nY:          Y coordinate
+///
+/// \return Pointer to the pixel
+///
+uint8_t* gslc_DrvPixelAddr(gslc_tsGui* pGui,int16_t nX,int16_t nY);
+
+///
+/// Convert a framebuffer row into RGB888
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nY:          Row to convert
+/// \param[out] pDst:        Output buffer (3 bytes per pixel)
+///
+/// \return none
+///
+void gslc_DrvRowToRgb(gslc_tsGui* pGui,int16_t nY,uint8_t* pDst);
+
+///
+/// Write the framebuffer as a binary PPM (P6) image
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pFile:       Output file
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDumpPpm(gslc_tsGui* pGui,FILE* pFile);
+
+///
+/// Update a CRC-32 (as used by PNG chunks) with a buffer
+///
+/// \param[in]  nCrc:        Current CRC value (0 to start)
+/// \param[in]  pBuf:        Pointer to data
+/// \param[in]  nLen:        Number of bytes
+///
+/// \return Updated CRC value
+///
+uint32_t gslc_DrvPngCrc(uint32_t nCrc,const uint8_t* pBuf,uint32_t nLen);
+
+///
+/// Store a 32-bit value in big-endian order
+///
+/// \param[out] pBuf:        Output buffer (4 bytes)
+/// \param[in]  nVal:        Value to store
+///
+/// \return none
+///
+void gslc_DrvPngPut32(uint8_t* pBuf,uint32_t nVal);
+
+///
+/// Write data to a file and update a running CRC
+///
+/// \param[in]  pFile:       Output file
+/// \param[in]  pBuf:        Pointer to data
+/// \param[in]  nLen:        Number of bytes
+/// \param[out] pnCrc:       Ptr to running CRC
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvPngWrite(FILE* pFile,const uint8_t* pBuf,uint32_t nLen,uint32_t* pnCrc);
+
+///
+/// Write the framebuffer as a PNG image
+/// - The image data is stored uncompressed so that no
+///   external compression library is required
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pFile:       Output file
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDumpPng(gslc_tsGui* pGui,FILE* pFile);
+
+#if defined(DRV_TOUCH_SCRIPT)
+///
+/// Fetch the next command line from the touch script
+/// - Blank lines and comments are skipped
+///
+/// \param[in]  pDriver:     Pointer to driver
+/// \param[out] acLine:      Buffer for line (DRV_TOUCH_SCRIPT_LINE_MAX)
+///
+/// \return true if a line was read, false at the end of the script
+///
+bool gslc_DrvTouchScriptLine(gslc_tsDriver* pDriver,char* acLine);
+#endif // DRV_TOUCH_SCRIPT
+
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // _GUISLICE_DRV_MEMFB_H_
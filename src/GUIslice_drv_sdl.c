@@ -43,6 +43,7 @@
 #include "GUIslice_drv_sdl.h"
 
 #include <stdio.h>
+#include <string.h>
 
 // ------------------------------------------------------------------------
 // Load display & touch drivers
@@ -72,6 +73,21 @@
   const char* m_acDrvTouch = "SDL";
 #endif
 
+// Page snapshot (see gslc_DrvPageSnapSave)
+// - The saved region is held at the origin of the surface / texture,
+//   which may be larger than the region if it has been reused
+typedef struct {
+  gslc_tsRect   rSnap;    // Region of the display held in the snapshot
+#if defined(DRV_DISP_SDL1)
+  SDL_Surface*  pSurf;    // Surface holding the region
+#endif
+#if defined(DRV_DISP_SDL2)
+  SDL_Texture*  pTex;     // Target texture holding the region
+  int           nTexW;    // Width of the texture
+  int           nTexH;    // Height of the texture
+#endif
+} gslc_tsDrvSnap;
+
 
 // =======================================================================
 // Public APIs to GUIslice core library
@@ -97,14 +113,32 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
 
     #if defined(DRV_DISP_SDL1)
     pDriver->pSurfScreen = NULL;
+    pDriver->bFrameLock  = false;
+    pDriver->bLocked     = false;
+    pDriver->pPixels     = NULL;
+    pDriver->nPitch      = 0;
+    pDriver->nBpp        = 0;
     pGui->bRedrawPartialEn = true;
     #endif
 
     #if defined(DRV_DISP_SDL2)
     pDriver->pWind       = NULL;
     pDriver->pRender     = NULL;
-    // In SDL2, always need full page redraw since backbuffer
-    // is treated as invalidated after every RenderPresent()
+    pDriver->pTexTarget  = NULL;
+    #if (DRV_SDL_TXT_CACHE_CNT > 0)
+    memset(pDriver->asTxtCache,0,sizeof(pDriver->asTxtCache));
+    #endif
+    #if (DRV_SDL_GLYPH_ATLAS_CNT > 0)
+    memset(pDriver->asGlyphAtlas,0,sizeof(pDriver->asGlyphAtlas));
+    #endif
+    pDriver->nTxtCacheTick  = 0;
+    pDriver->nTxtCacheBytes = 0;
+    pDriver->nTxtCacheHit   = 0;
+    pDriver->nTxtCacheMiss  = 0;
+    // In SDL2, need full page redraw since backbuffer is
+    // treated as invalidated after every RenderPresent()
+    // - This is enabled later if a retained render target
+    //   can be created
     pGui->bRedrawPartialEn = false;
     #endif
   }
@@ -224,8 +258,34 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
   // If we wanted to support scaling of the renderer, we would call
   // SDL_RenderSetLogicalSize() here. For now, don't scale.
 
+  #if (DRV_SDL_RENDER_TARGET)
+  // Draw into a retained texture so that the display content
+  // persists across page flips, enabling partial redraw
+  if (SDL_RenderTargetSupported(pDriver->pRender)) {
+    pDriver->pTexTarget = SDL_CreateTexture(pDriver->pRender,SDL_PIXELFORMAT_ARGB8888,
+            SDL_TEXTUREACCESS_TARGET,pGui->nDispW,pGui->nDispH);
+    if ((pDriver->pTexTarget) && (SDL_SetRenderTarget(pDriver->pRender,pDriver->pTexTarget) == 0)) {
+      SDL_SetRenderDrawColor(pDriver->pRender,0x00,0x00,0x00,0xFF);
+      SDL_RenderClear(pDriver->pRender);
+      pGui->bRedrawPartialEn = true;
+    } else {
+      GSLC_DEBUG_PRINT("WARNING: DrvInit() render target unavailable, using full redraw: %s\n",SDL_GetError());
+      if (pDriver->pTexTarget) {
+        SDL_DestroyTexture(pDriver->pTexTarget);
+        pDriver->pTexTarget = NULL;
+      }
+    }
+  }
+  #endif // DRV_SDL_RENDER_TARGET
+
 #endif
 
+  // Default the clipping rect to the entire display
+  pDriver->rClipRect.x = 0;
+  pDriver->rClipRect.y = 0;
+  pDriver->rClipRect.w = pGui->nDispW;
+  pDriver->rClipRect.h = pGui->nDispH;
+
   // Initialize font engine
   if (TTF_Init() == -1) {
     GSLC_DEBUG_PRINT("ERROR: DrvInit(%s) error in TTF_Init()\n","");
@@ -251,6 +311,12 @@ void gslc_DrvDestruct(gslc_tsGui* pGui)
 {
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  // Cached text textures belong to the renderer
+  gslc_DrvTxtCacheFlush(pGui);
+  if (pDriver->pTexTarget) {
+    SDL_DestroyTexture(pDriver->pTexTarget);
+    pDriver->pTexTarget = NULL;
+  }
   if (pDriver->pRender) {
     SDL_DestroyRenderer(pDriver->pRender);
     pDriver->pRender = NULL;
@@ -505,6 +571,18 @@ void gslc_DrvImageDestruct(void* pvImg)
 bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
 {
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  // Save the clipping rect in the driver struct
+  // - This is used by the core (eg. BMP streaming) to limit drawing
+  if (pRect == NULL) {
+    pDriver->rClipRect.x = 0;
+    pDriver->rClipRect.y = 0;
+    pDriver->rClipRect.w = pGui->nDispW;
+    pDriver->rClipRect.h = pGui->nDispH;
+  } else {
+    pDriver->rClipRect = *pRect;
+  }
+
 #if defined(DRV_DISP_SDL1)
   SDL_Surface*  pScreen = pDriver->pSurfScreen;
   if (pRect == NULL) {
@@ -557,6 +635,10 @@ void gslc_DrvFontsDestruct(gslc_tsGui* pGui)
 {
   uint16_t  nFontInd;
   TTF_Font* pFont = NULL;
+  #if defined(DRV_DISP_SDL2)
+  // Cached text is keyed on the font pointers about to be released
+  gslc_DrvTxtCacheFlush(pGui);
+  #endif
   for (nFontInd=0;nFontInd<pGui->nFontCnt;nFontInd++) {
     if (pGui->asFont[nFontInd].pvFont != NULL) {
       pFont = (TTF_Font*)(pGui->asFont[nFontInd].pvFont);
@@ -604,10 +686,21 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
     return true;
   }
 
-  gslc_tsDriver*  pDriver   = (gslc_tsDriver*)(pGui->pvDriver);
-  SDL_Surface*    pSurfTxt  = NULL;
   TTF_Font*       pDrvFont  = (TTF_Font*)(pFont->pvFont);
   if (!pDrvFont) { return false; }
+
+#if defined(DRV_DISP_SDL2)
+  // Compose the string from the glyph atlas if it only uses the
+  // atlas character set, otherwise draw it via the text cache
+  if (gslc_DrvGlyphAtlasDraw(pGui,nTxtX,nTxtY,pDrvFont,pStr,colTxt)) {
+    return true;
+  }
+  return gslc_DrvTxtCacheDraw(pGui,nTxtX,nTxtY,pDrvFont,pStr,eTxtFlags,colTxt);
+#endif
+
+#if defined(DRV_DISP_SDL1)
+  gslc_tsDriver*  pDriver   = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*    pSurfTxt  = NULL;
   if ((eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8) {
     pSurfTxt = TTF_RenderUTF8_Blended(pDrvFont,pStr,gslc_DrvAdaptColor(colTxt));
   } else {
@@ -618,35 +711,52 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
     return false;
   }
 
-
-#if defined(DRV_DISP_SDL1)
   gslc_DrvPasteSurface(pGui,nTxtX,nTxtY,pSurfTxt,pDriver->pSurfScreen);
-#endif
-#if defined(DRV_DISP_SDL2)
-  SDL_Rect rRect = (SDL_Rect){nTxtX,nTxtY,pSurfTxt->w,pSurfTxt->h};
-  SDL_Renderer* pRender = pDriver->pRender;
-  SDL_Texture* pTex = SDL_CreateTextureFromSurface(pRender,pSurfTxt);
-  if (pTex == NULL) {
-    GSLC_DEBUG2_PRINT("ERROR: DrvDrawTxt() error in SDL_CreateTextureFromSurface(): %s\n",SDL_GetError());
-    return false;
-  }
-  SDL_RenderCopy(pRender,pTex,NULL,&rRect);
 
-  // Destroy texture
-  // TODO: Consider if worth optimizing by retaining texture in case
-  //       we need to redraw it without changing content
-  SDL_DestroyTexture(pTex);
-  pTex = NULL;
+  // Dispose of temporary surface
+  SDL_FreeSurface(pSurfTxt);
+  pSurfTxt = NULL;
+
+  return true;
 #endif
+}
 
-  // Dispose of temporary surface
-  if (pSurfTxt != NULL) {
-    SDL_FreeSurface(pSurfTxt);
-    pSurfTxt = NULL;
+#if defined(DRV_DISP_SDL2)
+void gslc_DrvTxtCacheFlush(gslc_tsGui* pGui)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint16_t        nInd;
+  #if (DRV_SDL_TXT_CACHE_CNT > 0)
+  for (nInd=0;nInd<DRV_SDL_TXT_CACHE_CNT;nInd++) {
+    if (pDriver->asTxtCache[nInd].pTex) {
+      SDL_DestroyTexture(pDriver->asTxtCache[nInd].pTex);
+      pDriver->asTxtCache[nInd].pTex = NULL;
+    }
   }
+  #endif
+  #if (DRV_SDL_GLYPH_ATLAS_CNT > 0)
+  for (nInd=0;nInd<DRV_SDL_GLYPH_ATLAS_CNT;nInd++) {
+    if (pDriver->asGlyphAtlas[nInd].pTex) {
+      SDL_DestroyTexture(pDriver->asGlyphAtlas[nInd].pTex);
+      pDriver->asGlyphAtlas[nInd].pTex = NULL;
+    }
+    // Allow another attempt at any atlas that couldn't be created
+    pDriver->asGlyphAtlas[nInd].bFailed = false;
+  }
+  #endif
+  (void)nInd; // Unused if both caches are disabled
+  pDriver->nTxtCacheBytes = 0;
+}
 
-  return true;
+void gslc_DrvTxtCacheGetStats(gslc_tsGui* pGui,uint32_t* pnHit,uint32_t* pnMiss,uint32_t* pnBytes)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint32_t        nBytes  = pDriver->nTxtCacheBytes;
+  if (pnHit)   { *pnHit   = pDriver->nTxtCacheHit; }
+  if (pnMiss)  { *pnMiss  = pDriver->nTxtCacheMiss; }
+  if (pnBytes) { *pnBytes = nBytes; }
 }
+#endif // DRV_DISP_SDL2
 
 
 // -----------------------------------------------------------------------
@@ -658,11 +768,23 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
 #if defined(DRV_DISP_SDL1)
   SDL_Surface*   pScreen = pDriver->pSurfScreen;
+  gslc_DrvScreenRelease(pGui);
   SDL_Flip(pScreen);
 #endif
 #if defined(DRV_DISP_SDL2)
   SDL_Renderer* pRender = pDriver->pRender;
-  if (pRender) {
+  if ((pRender) && (pDriver->pTexTarget)) {
+    // Copy the retained render target to the window and present it
+    // - The render target keeps its content, so only the regions
+    //   that were redrawn have changed since the last flip
+    SDL_SetRenderTarget(pRender,NULL);
+    SDL_RenderCopy(pRender,pDriver->pTexTarget,NULL,NULL);
+    SDL_RenderPresent(pRender);
+    // Resume drawing into the render target
+    // - Switching targets resets the clipping region
+    SDL_SetRenderTarget(pRender,pDriver->pTexTarget);
+    gslc_DrvSetClipRect(pGui,&(pDriver->rClipRect));
+  } else if (pRender) {
     // Flip the offscreen buffer so we can display our drawing output
     SDL_RenderPresent(pRender);
     // Clear the drawing before any new drawing occurs
@@ -672,6 +794,188 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
 #endif
 }
 
+#if defined(DRV_DISP_SDL1)
+void gslc_DrvFrameLock(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  // The surface itself is only locked once a pixel primitive
+  // needs it, so frames drawn entirely with blits and fills
+  // never take the lock
+  pDriver->bFrameLock = true;
+}
+
+void gslc_DrvFrameUnlock(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->bFrameLock = false;
+  gslc_DrvScreenRelease(pGui);
+}
+#endif // DRV_DISP_SDL1
+
+
+// -----------------------------------------------------------------------
+// Page Snapshot Functions
+// -----------------------------------------------------------------------
+
+uint32_t gslc_DrvPageSnapGetSize(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+#if defined(DRV_DISP_SDL1)
+  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+  if (pScreen == NULL) {
+    return 0;
+  }
+  return (uint32_t)sizeof(gslc_tsDrvSnap) + (uint32_t)rRect.w*rRect.h*pScreen->format->BytesPerPixel;
+#endif
+#if defined(DRV_DISP_SDL2)
+  // Snapshots are copied from the retained render target
+  if (pDriver->pTexTarget == NULL) {
+    return 0;
+  }
+  return (uint32_t)sizeof(gslc_tsDrvSnap) + (uint32_t)rRect.w*rRect.h*4;
+#endif
+}
+
+bool gslc_DrvPageSnapSave(gslc_tsGui* pGui,void** ppvSnap,gslc_tsRect rRect)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsDrvSnap* pSnap   = (gslc_tsDrvSnap*)(*ppvSnap);
+  gslc_tsRect     rDisp   = { 0, 0, pGui->nDispW, pGui->nDispH };
+  SDL_Rect        rSRect;
+  if ((rRect.w == 0) || (rRect.h == 0) || (!gslc_ClipRect(&rDisp,&rRect))) {
+    return false;
+  }
+  rSRect = gslc_DrvAdaptRect(rRect);
+  if (pSnap == NULL) {
+    pSnap = (gslc_tsDrvSnap*)calloc(1,sizeof(gslc_tsDrvSnap));
+    if (pSnap == NULL) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvPageSnapSave() can't allocate snapshot\n","");
+      return false;
+    }
+    *ppvSnap = (void*)pSnap;
+  }
+#if defined(DRV_DISP_SDL1)
+  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+  if (pScreen == NULL) {
+    return false;
+  }
+  if ((pSnap->pSurf) && ((pSnap->pSurf->w < rSRect.w) || (pSnap->pSurf->h < rSRect.h))) {
+    SDL_FreeSurface(pSnap->pSurf);
+    pSnap->pSurf = NULL;
+  }
+  if (pSnap->pSurf == NULL) {
+    // Allocate a surface in the screen format so the
+    // blits don't need any conversion
+    pSnap->pSurf = SDL_CreateRGBSurface(SDL_SWSURFACE,rSRect.w,rSRect.h,
+      pScreen->format->BitsPerPixel,pScreen->format->Rmask,
+      pScreen->format->Gmask,pScreen->format->Bmask,pScreen->format->Amask);
+    if (pSnap->pSurf == NULL) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvPageSnapSave() can't create surface: %s\n",SDL_GetError());
+      return false;
+    }
+  }
+  // Blit the region, regardless of the clipping region
+  SDL_Rect rClip = pScreen->clip_rect;
+  SDL_Rect rDst  = { 0, 0, rSRect.w, rSRect.h };
+  gslc_DrvScreenRelease(pGui);
+  SDL_SetClipRect(pScreen,NULL);
+  SDL_BlitSurface(pScreen,&rSRect,pSnap->pSurf,&rDst);
+  SDL_SetClipRect(pScreen,&rClip);
+#endif
+#if defined(DRV_DISP_SDL2)
+  SDL_Renderer*  pRender = pDriver->pRender;
+  if ((pRender == NULL) || (pDriver->pTexTarget == NULL)) {
+    return false;
+  }
+  if ((pSnap->pTex) && ((pSnap->nTexW < rSRect.w) || (pSnap->nTexH < rSRect.h))) {
+    SDL_DestroyTexture(pSnap->pTex);
+    pSnap->pTex = NULL;
+  }
+  if (pSnap->pTex == NULL) {
+    pSnap->pTex = SDL_CreateTexture(pRender,SDL_PIXELFORMAT_ARGB8888,SDL_TEXTUREACCESS_TARGET,
+      rSRect.w,rSRect.h);
+    if (pSnap->pTex == NULL) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvPageSnapSave() can't create texture: %s\n",SDL_GetError());
+      return false;
+    }
+    pSnap->nTexW = rSRect.w;
+    pSnap->nTexH = rSRect.h;
+  }
+  // Copy the region of the retained render target into the snapshot
+  // texture
+  // - Switching targets resets the clipping region
+  SDL_Rect rDst = { 0, 0, rSRect.w, rSRect.h };
+  SDL_SetRenderTarget(pRender,pSnap->pTex);
+  SDL_RenderCopy(pRender,pDriver->pTexTarget,&rSRect,&rDst);
+  SDL_SetRenderTarget(pRender,pDriver->pTexTarget);
+  gslc_DrvSetClipRect(pGui,&(pDriver->rClipRect));
+#endif
+  pSnap->rSnap = rRect;
+  return true;
+}
+
+bool gslc_DrvPageSnapRestore(gslc_tsGui* pGui,void* pvSnap,gslc_tsRect rRect)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsDrvSnap* pSnap   = (gslc_tsDrvSnap*)pvSnap;
+  SDL_Rect        rSRect;
+  SDL_Rect        rSrc;
+  if ((rRect.w == 0) || (rRect.h == 0)) {
+    return true;
+  }
+  // Only the part of the region held in the snapshot is restored
+  if (!gslc_ClipRect(&(pSnap->rSnap),&rRect)) {
+    return true;
+  }
+  rSRect = gslc_DrvAdaptRect(rRect);
+  rSrc   = rSRect;
+  rSrc.x = rRect.x - pSnap->rSnap.x;
+  rSrc.y = rRect.y - pSnap->rSnap.y;
+#if defined(DRV_DISP_SDL1)
+  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+  if ((pScreen == NULL) || (pSnap->pSurf == NULL)) {
+    return false;
+  }
+  SDL_Rect rClip = pScreen->clip_rect;
+  SDL_Rect rDst  = rSRect;
+  gslc_DrvScreenRelease(pGui);
+  SDL_SetClipRect(pScreen,NULL);
+  SDL_BlitSurface(pSnap->pSurf,&rSrc,pScreen,&rDst);
+  SDL_SetClipRect(pScreen,&rClip);
+  return true;
+#endif
+#if defined(DRV_DISP_SDL2)
+  SDL_Renderer*  pRender = pDriver->pRender;
+  if ((pRender == NULL) || (pDriver->pTexTarget == NULL) || (pSnap->pTex == NULL)) {
+    return false;
+  }
+  SDL_RenderSetClipRect(pRender,NULL);
+  SDL_RenderCopy(pRender,pSnap->pTex,&rSrc,&rSRect);
+  gslc_DrvSetClipRect(pGui,&(pDriver->rClipRect));
+  return true;
+#endif
+}
+
+void gslc_DrvPageSnapFree(gslc_tsGui* pGui,void* pvSnap)
+{
+  gslc_tsDrvSnap* pSnap = (gslc_tsDrvSnap*)pvSnap;
+  (void)pGui; // Unused
+  if (pSnap == NULL) {
+    return;
+  }
+#if defined(DRV_DISP_SDL1)
+  if (pSnap->pSurf) {
+    SDL_FreeSurface(pSnap->pSurf);
+  }
+#endif
+#if defined(DRV_DISP_SDL2)
+  if (pSnap->pTex) {
+    SDL_DestroyTexture(pSnap->pTex);
+  }
+#endif
+  free(pSnap);
+}
+
 
 // -----------------------------------------------------------------------
 // Graphics Primitives Functions
@@ -734,6 +1038,7 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   SDL_Surface*  pScreen = pDriver->pSurfScreen;
 
   // Call SDL optimized routine
+  gslc_DrvScreenRelease(pGui);
   SDL_FillRect(pScreen,&rSRect,
     SDL_MapRGB(pScreen->format,nCol.r,nCol.g,nCol.b));
 #endif
@@ -749,11 +1054,59 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   return true;
 }
 
-bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY)
 {
 #if defined(DRV_DISP_SDL1)
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (!gslc_DrvScreenLock(pGui)) {
+    return false;
+  }
+  uint8_t   nBpp    = pDriver->nBpp;
+  uint32_t  nRowLen = (uint32_t)rSrc.w*nBpp;
+  uint8_t*  pPixels = pDriver->pPixels;
+  int16_t   nRow;
+  // Copy the rows in an order that doesn't overwrite
+  // source rows before they have been read
+  for (nRow=0;nRow<(int16_t)rSrc.h;nRow++) {
+    int16_t nRowCur = (nDstY > rSrc.y)? (int16_t)rSrc.h-1-nRow : nRow;
+    memmove(pPixels + (nDstY+nRowCur)*pDriver->nPitch + nDstX*nBpp,
+      pPixels + (rSrc.y+nRowCur)*pDriver->nPitch + rSrc.x*nBpp,nRowLen);
+  }
+  gslc_DrvScreenUnlock(pGui);
+  return true;
+#endif
+#if defined(DRV_DISP_SDL2)
+  (void)pGui; // Unused
+  (void)rSrc; // Unused
+  (void)nDstX; // Unused
+  (void)nDstY; // Unused
   return false;
 #endif
+}
+
+bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+#if defined(DRV_DISP_SDL1)
+  if ((rRect.w == 0) || (rRect.h == 0)) { return true; }
+  if (!gslc_DrvScreenLock(pGui)) {
+    return false;
+  }
+  uint32_t  nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
+  int16_t   nY;
+  int16_t   nY1 = rRect.y+rRect.h-1;
+  gslc_DrvFillSpanRaw(pGui,rRect.x,rRect.y,rRect.w,nColRaw);
+  if (rRect.h > 1) {
+    gslc_DrvFillSpanRaw(pGui,rRect.x,nY1,rRect.w,nColRaw);
+  }
+  for (nY=rRect.y+1;nY<nY1;nY++) {
+    gslc_DrvDrawSetPixelRaw(pGui,rRect.x,nY,nColRaw);
+    if (rRect.w > 1) {
+      gslc_DrvDrawSetPixelRaw(pGui,rRect.x+rRect.w-1,nY,nColRaw);
+    }
+  }
+  gslc_DrvScreenUnlock(pGui);
+  return true;
+#endif
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   SDL_Renderer* pRender  = pDriver->pRender;
@@ -771,8 +1124,36 @@ bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
 {
 #if defined(DRV_DISP_SDL1)
-  // ERROR
-  return false;
+  if (!gslc_DrvScreenLock(pGui)) {
+    return false;
+  }
+  uint32_t  nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
+  int16_t   nTmp;
+
+  // Horizontal lines are filled as a single span
+  if (nY0 == nY1) {
+    if (nX1 < nX0) { nTmp = nX0; nX0 = nX1; nX1 = nTmp; }
+    gslc_DrvFillSpanRaw(pGui,nX0,nY0,nX1-nX0+1,nColRaw);
+    gslc_DrvScreenUnlock(pGui);
+    return true;
+  }
+
+  // Bresenham's algorithm
+  int16_t nDX = (nX1 > nX0)? (nX1-nX0) : (nX0-nX1);
+  int16_t nDY = (nY1 > nY0)? (nY0-nY1) : (nY1-nY0);
+  int16_t nSX = (nX0 < nX1)? 1 : -1;
+  int16_t nSY = (nY0 < nY1)? 1 : -1;
+  int32_t nErr = nDX + nDY;
+  int32_t nErr2;
+  while (true) {
+    gslc_DrvDrawSetPixelRaw(pGui,nX0,nY0,nColRaw);
+    if ((nX0 == nX1) && (nY0 == nY1)) { break; }
+    nErr2 = 2*nErr;
+    if (nErr2 >= nDY) { nErr += nDY; nX0 += nSX; }
+    if (nErr2 <= nDX) { nErr += nDX; nY0 += nSY; }
+  }
+  gslc_DrvScreenUnlock(pGui);
+  return true;
 #endif
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
@@ -1230,6 +1611,9 @@ uint32_t gslc_DrvAdaptColorRaw(gslc_tsGui* pGui,gslc_tsColor nCol)
 // SDL1 requires direct pixel access as there is no "draw point / pixel"
 // function. SDL2 has native access for point/pixel drawing so there is
 // no need to access the pixel map directly.
+// - Within a frame (gslc_DrvFrameLock) the lock is held across the
+//   pixel primitives and only released before SDL blits / fills,
+//   since SDL1.2 doesn't permit blitting to a locked surface.
 
 bool gslc_DrvScreenLock(gslc_tsGui* pGui)
 {
@@ -1239,6 +1623,9 @@ bool gslc_DrvScreenLock(gslc_tsGui* pGui)
     return false;
   }
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->bLocked) {
+    return true;
+  }
   // Typecast
   SDL_Surface*   pScreen = pDriver->pSurfScreen;
 
@@ -1249,6 +1636,12 @@ bool gslc_DrvScreenLock(gslc_tsGui* pGui)
     }
   }
 
+  // Cache the pixel access details while locked
+  pDriver->pPixels = (uint8_t*)pScreen->pixels;
+  pDriver->nPitch  = pScreen->pitch;
+  pDriver->nBpp    = pScreen->format->BytesPerPixel;
+  pDriver->bLocked = true;
+
   return true;
 }
 
@@ -1259,12 +1652,27 @@ void gslc_DrvScreenUnlock(gslc_tsGui* pGui)
     return;
   }
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->bFrameLock) {
+    // Keep the lock until the end of the frame
+    return;
+  }
+  gslc_DrvScreenRelease(pGui);
+}
+
+void gslc_DrvScreenRelease(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (!pDriver->bLocked) {
+    return;
+  }
   // Typecast
   SDL_Surface*   pScreen = pDriver->pSurfScreen;
 
   if (SDL_MUSTLOCK(pScreen)) {
     SDL_UnlockSurface(pScreen);
   }
+  pDriver->pPixels = NULL;
+  pDriver->bLocked = false;
 }
 
 
@@ -1329,11 +1737,11 @@ void gslc_DrvDrawSetPixelRaw(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint32_t n
   }
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   SDL_Surface*   pScreen = pDriver->pSurfScreen;
-  if (pScreen == NULL) {
-    GSLC_DEBUG2_PRINT("ERROR: DrvDrawSetPixelRaw(%s) screen surface NULL\n","");
+  if ((pScreen == NULL) || (pDriver->pPixels == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawSetPixelRaw(%s) screen surface not locked\n","");
     return;
   }
-  uint8_t nBpp = pScreen->format->BytesPerPixel;
+  uint8_t nBpp = pDriver->nBpp;
 
   // Handle any clipping
   if ( (nX < pScreen->clip_rect.x) || (nX >= pScreen->clip_rect.x+pScreen->clip_rect.w) ||
@@ -1342,7 +1750,7 @@ void gslc_DrvDrawSetPixelRaw(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint32_t n
   }
 
   // Here pPixel is the address to the pixel we want to set
-  uint8_t *pPixel = (uint8_t *)pScreen->pixels + nY * pScreen->pitch + nX * nBpp;
+  uint8_t *pPixel = pDriver->pPixels + nY * pDriver->nPitch + nX * nBpp;
 
   switch(nBpp) {
     case 1:
@@ -1372,6 +1780,63 @@ void gslc_DrvDrawSetPixelRaw(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint32_t n
 
 }
 
+void gslc_DrvFillSpanRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,int16_t nW,uint32_t nPixelVal)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+  if ((pScreen == NULL) || (pDriver->pPixels == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvFillSpanRaw(%s) screen surface not locked\n","");
+    return;
+  }
+
+  // Clip the span against the clipping region
+  SDL_Rect* pClip = &pScreen->clip_rect;
+  if ((nY < pClip->y) || (nY >= pClip->y+pClip->h)) { return; }
+  int16_t nX1 = nX+nW;
+  if (nX < pClip->x) { nX = pClip->x; }
+  if (nX1 > pClip->x+pClip->w) { nX1 = pClip->x+pClip->w; }
+  if (nX >= nX1) { return; }
+
+  uint8_t   nBpp   = pDriver->nBpp;
+  uint8_t*  pPixel = pDriver->pPixels + nY * pDriver->nPitch + nX * nBpp;
+  int16_t   nInd;
+
+  switch(nBpp) {
+    case 1:
+      memset(pPixel,(uint8_t)nPixelVal,(size_t)(nX1-nX));
+      break;
+
+    case 2:
+      for (nInd=nX;nInd<nX1;nInd++) {
+        *(uint16_t *)pPixel = nPixelVal;
+        pPixel += 2;
+      }
+      break;
+
+    case 3:
+      for (nInd=nX;nInd<nX1;nInd++) {
+        if (SDL_BYTEORDER == SDL_BIG_ENDIAN) {
+          pPixel[0] = (nPixelVal >> 16) & 0xff;
+          pPixel[1] = (nPixelVal >> 8) & 0xff;
+          pPixel[2] = nPixelVal & 0xff;
+        } else {
+          pPixel[0] = nPixelVal & 0xff;
+          pPixel[1] = (nPixelVal >> 8) & 0xff;
+          pPixel[2] = (nPixelVal >> 16) & 0xff;
+        }
+        pPixel += 3;
+      }
+      break;
+
+    case 4:
+      for (nInd=nX;nInd<nX1;nInd++) {
+        *(uint32_t *)pPixel = nPixelVal;
+        pPixel += 4;
+      }
+      break;
+  }
+}
+
 void gslc_DrvPasteSurface(gslc_tsGui* pGui,int16_t nX, int16_t nY, void* pvSrc, void* pvDest)
 {
   if ((pGui == NULL) || (pvSrc == NULL) || (pvDest == NULL)) {
@@ -1383,11 +1848,380 @@ void gslc_DrvPasteSurface(gslc_tsGui* pGui,int16_t nX, int16_t nY, void* pvSrc,
   SDL_Rect offset;
   offset.x = nX;
   offset.y = nY;
+  // Blits require the destination surface to be unlocked
+  gslc_DrvScreenRelease(pGui);
   SDL_BlitSurface(pSrc,NULL,pDest,&offset);
 }
 
 #endif
 
+#if defined(DRV_DISP_SDL2)
+bool gslc_DrvTxtCacheDraw(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,TTF_Font* pDrvFont,
+        const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt)
+{
+  gslc_tsDriver*  pDriver   = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Renderer*   pRender   = pDriver->pRender;
+  gslc_teTxtFlags eTxtEnc   = (gslc_teTxtFlags)(eTxtFlags & GSLC_TXT_ENC);
+  SDL_Surface*    pSurfTxt  = NULL;
+  SDL_Texture*    pTex      = NULL;
+  SDL_Rect        rRect;
+
+#if (DRV_SDL_TXT_CACHE_CNT > 0)
+  gslc_tsDrvTxtCache* pEntry = NULL;
+  gslc_tsDrvTxtCache* pLru;
+  uint16_t  nInd;
+  uint16_t  nLen;
+  uint32_t  nHash = 2166136261UL; // FNV-1a
+
+  for (nLen=0;pStr[nLen] != '\0';nLen++) {
+    nHash = (nHash ^ (uint8_t)pStr[nLen]) * 16777619UL;
+  }
+  // Strings that don't fit in an entry are rendered uncached
+  bool bCacheable = (nLen < DRV_SDL_TXT_CACHE_STR_LEN);
+
+  if (bCacheable) {
+    for (nInd=0;nInd<DRV_SDL_TXT_CACHE_CNT;nInd++) {
+      pEntry = &(pDriver->asTxtCache[nInd]);
+      if ((pEntry->pTex == NULL) || (pEntry->nHash != nHash)) { continue; }
+      if ((pEntry->pFont != pDrvFont) || (pEntry->eTxtEnc != eTxtEnc)) { continue; }
+      if (!gslc_ColorEqual(pEntry->colTxt,colTxt)) { continue; }
+      if (strcmp(pEntry->acStr,pStr) != 0) { continue; }
+      // Cache hit: reuse the texture
+      pEntry->nLastUse = ++pDriver->nTxtCacheTick;
+      pDriver->nTxtCacheHit++;
+      rRect = (SDL_Rect){nTxtX,nTxtY,pEntry->nW,pEntry->nH};
+      SDL_RenderCopy(pRender,pEntry->pTex,NULL,&rRect);
+      return true;
+    }
+  }
+#endif // DRV_SDL_TXT_CACHE_CNT
+
+  pDriver->nTxtCacheMiss++;
+
+  if (eTxtEnc == GSLC_TXT_ENC_UTF8) {
+    pSurfTxt = TTF_RenderUTF8_Blended(pDrvFont,pStr,gslc_DrvAdaptColor(colTxt));
+  } else {
+    pSurfTxt = TTF_RenderText_Blended(pDrvFont,pStr,gslc_DrvAdaptColor(colTxt));
+  }
+  if (pSurfTxt == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawTxt() failed in TTF_RenderText_Solid() (%s)\n",pStr);
+    return false;
+  }
+  rRect = (SDL_Rect){nTxtX,nTxtY,pSurfTxt->w,pSurfTxt->h};
+  pTex = SDL_CreateTextureFromSurface(pRender,pSurfTxt);
+  SDL_FreeSurface(pSurfTxt);
+  pSurfTxt = NULL;
+  if (pTex == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawTxt() error in SDL_CreateTextureFromSurface(): %s\n",SDL_GetError());
+    return false;
+  }
+  SDL_RenderCopy(pRender,pTex,NULL,&rRect);
+
+#if (DRV_SDL_TXT_CACHE_CNT > 0)
+  uint32_t nBytes = (uint32_t)rRect.w * (uint32_t)rRect.h * 4;
+  if (bCacheable && (gslc_DrvTxtCacheEvict(pGui,nBytes))) {
+    // Use a free entry, otherwise replace the least-recently-used one
+    pEntry = NULL;
+    pLru = NULL;
+    for (nInd=0;nInd<DRV_SDL_TXT_CACHE_CNT;nInd++) {
+      if (pDriver->asTxtCache[nInd].pTex == NULL) {
+        pEntry = &(pDriver->asTxtCache[nInd]);
+      } else if ((pLru == NULL) || (pDriver->asTxtCache[nInd].nLastUse < pLru->nLastUse)) {
+        pLru = &(pDriver->asTxtCache[nInd]);
+      }
+    }
+    if ((pEntry == NULL) && (pLru != NULL)) {
+      SDL_DestroyTexture(pLru->pTex);
+      pLru->pTex = NULL;
+      pDriver->nTxtCacheBytes -= pLru->nBytes;
+      pEntry = pLru;
+    }
+  } else {
+    pEntry = NULL;
+  }
+  if (pEntry) {
+    pEntry->pTex      = pTex;
+    pEntry->pFont     = pDrvFont;
+    pEntry->eTxtEnc   = eTxtEnc;
+    pEntry->colTxt    = colTxt;
+    pEntry->nHash     = nHash;
+    pEntry->nLastUse  = ++pDriver->nTxtCacheTick;
+    pEntry->nBytes    = nBytes;
+    pEntry->nW        = (uint16_t)rRect.w;
+    pEntry->nH        = (uint16_t)rRect.h;
+    strcpy(pEntry->acStr,pStr);
+    pDriver->nTxtCacheBytes += nBytes;
+    return true;
+  }
+#endif // DRV_SDL_TXT_CACHE_CNT
+
+  SDL_DestroyTexture(pTex);
+  pTex = NULL;
+  return true;
+}
+
+bool gslc_DrvTxtCacheEvict(gslc_tsGui* pGui,uint32_t nBytes)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+#if (DRV_SDL_TXT_CACHE_CNT > 0)
+  gslc_tsDrvTxtCache* pLru;
+  uint16_t  nInd;
+#endif
+
+  while (pDriver->nTxtCacheBytes + nBytes > DRV_SDL_TXT_CACHE_BYTES) {
+#if (DRV_SDL_TXT_CACHE_CNT > 0)
+    pLru = NULL;
+    for (nInd=0;nInd<DRV_SDL_TXT_CACHE_CNT;nInd++) {
+      if (pDriver->asTxtCache[nInd].pTex == NULL) {
+        continue;
+      }
+      if ((pLru == NULL) || (pDriver->asTxtCache[nInd].nLastUse < pLru->nLastUse)) {
+        pLru = &(pDriver->asTxtCache[nInd]);
+      }
+    }
+    if (pLru == NULL) {
+      // The remainder of the budget is held by the glyph atlases
+      return false;
+    }
+    SDL_DestroyTexture(pLru->pTex);
+    pLru->pTex = NULL;
+    pDriver->nTxtCacheBytes -= pLru->nBytes;
+#else
+    return false;
+#endif // DRV_SDL_TXT_CACHE_CNT
+  }
+  return true;
+}
+
+uint32_t gslc_DrvGlyphAtlasGetSize(TTF_Font* pDrvFont)
+{
+  char            acGlyph[2] = {'\0','\0'};
+  int             nGlyphW,nGlyphH;
+  uint32_t        nAtlasW = 0;
+  uint16_t        nInd;
+
+  // Each glyph occupies its advance width (see gslc_DrvGlyphAtlasCreate)
+  for (nInd=0;nInd<DRV_SDL_GLYPH_ATLAS_LEN;nInd++) {
+    acGlyph[0] = DRV_SDL_GLYPH_ATLAS_CHARS[nInd];
+    nGlyphW = 0;
+    TTF_SizeText(pDrvFont,acGlyph,&nGlyphW,&nGlyphH);
+    nAtlasW += (uint32_t)nGlyphW;
+  }
+  return nAtlasW * (uint32_t)TTF_FontHeight(pDrvFont) * 4;
+}
+
+bool gslc_DrvGlyphAtlasCreate(gslc_tsGui* pGui,gslc_tsDrvGlyphAtlas* pAtlas,TTF_Font* pDrvFont)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*    apSurfGlyph[DRV_SDL_GLYPH_ATLAS_LEN];
+  SDL_Surface*    pSurfAtlas;
+  SDL_Color       colWhite = gslc_DrvAdaptColor(GSLC_COL_WHITE);
+  SDL_Rect        rDst;
+  char            acGlyph[2] = {'\0','\0'};
+  int             nGlyphW,nGlyphH;
+  uint16_t        nAtlasW = 0;
+  uint16_t        nAtlasH = (uint16_t)TTF_FontHeight(pDrvFont);
+  uint32_t        nBytes;
+  int             nMinX,nMaxX,nMinY,nMaxY,nAdvance;
+  uint16_t        nInd;
+
+  // Place each glyph at its advance width so that composed strings
+  // match TTF_SizeText(). Glyphs that extend beyond their advance
+  // width can't be composed this way and are marked as such.
+  for (nInd=0;nInd<DRV_SDL_GLYPH_ATLAS_LEN;nInd++) {
+    acGlyph[0] = DRV_SDL_GLYPH_ATLAS_CHARS[nInd];
+    nGlyphW = 0;
+    TTF_SizeText(pDrvFont,acGlyph,&nGlyphW,&nGlyphH);
+    pAtlas->anGlyphX[nInd] = nAtlasW;
+    pAtlas->anGlyphW[nInd] = (uint16_t)nGlyphW;
+    pAtlas->abGlyphFit[nInd] = true;
+    if (TTF_GlyphMetrics(pDrvFont,(Uint16)acGlyph[0],&nMinX,&nMaxX,&nMinY,&nMaxY,&nAdvance) == 0) {
+      pAtlas->abGlyphFit[nInd] = (nMinX >= 0) && (nMaxX <= nGlyphW);
+    }
+    nAtlasW += (uint16_t)nGlyphW;
+  }
+
+  // The atlas shares the text cache byte budget
+  nBytes = (uint32_t)nAtlasW * (uint32_t)nAtlasH * 4;
+  if (!gslc_DrvTxtCacheEvict(pGui,nBytes)) {
+    return false;
+  }
+
+  // Render each glyph in white so that the atlas can be tinted
+  // to any text color at draw time
+  for (nInd=0;nInd<DRV_SDL_GLYPH_ATLAS_LEN;nInd++) {
+    acGlyph[0] = DRV_SDL_GLYPH_ATLAS_CHARS[nInd];
+    // Blank glyphs (eg. space) may fail to render but still advance
+    apSurfGlyph[nInd] = TTF_RenderText_Blended(pDrvFont,acGlyph,colWhite);
+  }
+
+  pSurfAtlas = SDL_CreateRGBSurface(0,nAtlasW,nAtlasH,32,
+          0x00FF0000,0x0000FF00,0x000000FF,0xFF000000);
+  if (pSurfAtlas) {
+    SDL_FillRect(pSurfAtlas,NULL,0);
+  }
+  for (nInd=0;nInd<DRV_SDL_GLYPH_ATLAS_LEN;nInd++) {
+    if (apSurfGlyph[nInd] == NULL) { continue; }
+    if (pSurfAtlas) {
+      // Copy the glyph coverage as-is rather than blending it
+      SDL_SetSurfaceBlendMode(apSurfGlyph[nInd],SDL_BLENDMODE_NONE);
+      rDst = (SDL_Rect){pAtlas->anGlyphX[nInd],0,pAtlas->anGlyphW[nInd],nAtlasH};
+      SDL_BlitSurface(apSurfGlyph[nInd],NULL,pSurfAtlas,&rDst);
+    }
+    SDL_FreeSurface(apSurfGlyph[nInd]);
+  }
+  if (pSurfAtlas == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvGlyphAtlasCreate() error in SDL_CreateRGBSurface(): %s\n",SDL_GetError());
+    return false;
+  }
+
+  pAtlas->pTex = SDL_CreateTextureFromSurface(pDriver->pRender,pSurfAtlas);
+  SDL_FreeSurface(pSurfAtlas);
+  if (pAtlas->pTex == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvGlyphAtlasCreate() error in SDL_CreateTextureFromSurface(): %s\n",SDL_GetError());
+    return false;
+  }
+  SDL_SetTextureBlendMode(pAtlas->pTex,SDL_BLENDMODE_BLEND);
+  pAtlas->pFont   = pDrvFont;
+  pAtlas->nH      = nAtlasH;
+  pAtlas->nBytes  = nBytes;
+  pDriver->nTxtCacheBytes += nBytes;
+  return true;
+}
+
+bool gslc_DrvGlyphAtlasDraw(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,TTF_Font* pDrvFont,
+        const char* pStr,gslc_tsColor colTxt)
+{
+#if (DRV_SDL_GLYPH_ATLAS_CNT > 0)
+  gslc_tsDriver*        pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsDrvGlyphAtlas* pAtlas  = NULL;
+  gslc_tsDrvGlyphAtlas* pFree   = NULL;
+  gslc_tsDrvGlyphAtlas* pFail   = NULL;
+  gslc_tsDrvGlyphAtlas* pLru    = NULL;
+  gslc_tsDrvGlyphAtlas* pEntry;
+  const char*           pChar;
+  const char*           pGlyph;
+  SDL_Rect              rSrc,rDst;
+  uint32_t              nBytes;
+  uint32_t              nBytesOther;
+  uint16_t              nInd;
+
+  if (pStr[0] == '\0') {
+    // Nothing to draw
+    return true;
+  }
+
+  // Only strings made up entirely of the atlas character set qualify
+  for (pChar=pStr;*pChar != '\0';pChar++) {
+    if (strchr(DRV_SDL_GLYPH_ATLAS_CHARS,*pChar) == NULL) {
+      return false;
+    }
+  }
+
+  // Locate the atlas for this font
+  for (nInd=0;nInd<DRV_SDL_GLYPH_ATLAS_CNT;nInd++) {
+    pEntry = &(pDriver->asGlyphAtlas[nInd]);
+    if ((pEntry->pTex == NULL) && (!pEntry->bFailed)) {
+      pFree = pEntry;
+    } else if (pEntry->pFont == pDrvFont) {
+      pAtlas = pEntry;
+      break;
+    } else if (pEntry->bFailed) {
+      if ((pFail == NULL) || (pEntry->nLastUse < pFail->nLastUse)) {
+        pFail = pEntry;
+      }
+    } else if ((pLru == NULL) || (pEntry->nLastUse < pLru->nLastUse)) {
+      pLru = pEntry;
+    }
+  }
+
+  if ((pAtlas) && (pAtlas->bFailed)) {
+    // The atlas couldn't be created for this font
+    pAtlas->nLastUse = ++pDriver->nTxtCacheTick;
+    return false;
+  } else if (pAtlas) {
+    pDriver->nTxtCacheHit++;
+  } else {
+    // Create the atlas in a free entry, otherwise in place of the
+    // least-recently-used failed entry or atlas
+    pDriver->nTxtCacheMiss++;
+    pAtlas = (pFree) ? pFree : (pFail) ? pFail : pLru;
+
+    // Before evicting anything, check that the atlas fits within the
+    // byte budget. The text cache can be evicted to make room, but the
+    // other atlases are retained.
+    nBytes = gslc_DrvGlyphAtlasGetSize(pDrvFont);
+    nBytesOther = 0;
+    for (nInd=0;nInd<DRV_SDL_GLYPH_ATLAS_CNT;nInd++) {
+      pEntry = &(pDriver->asGlyphAtlas[nInd]);
+      if ((pEntry != pAtlas) && (pEntry->pTex)) {
+        nBytesOther += pEntry->nBytes;
+      }
+    }
+    if (nBytes + nBytesOther > DRV_SDL_TXT_CACHE_BYTES) {
+      // Only record the failure if doing so doesn't displace an atlas
+      if (pAtlas->pTex == NULL) {
+        pAtlas->pFont    = pDrvFont;
+        pAtlas->bFailed  = true;
+        pAtlas->nLastUse = ++pDriver->nTxtCacheTick;
+      }
+      return false;
+    }
+
+    if (pAtlas->pTex) {
+      SDL_DestroyTexture(pAtlas->pTex);
+      pAtlas->pTex = NULL;
+      pDriver->nTxtCacheBytes -= pAtlas->nBytes;
+    }
+    pAtlas->bFailed = false;
+    if (!gslc_DrvGlyphAtlasCreate(pGui,pAtlas,pDrvFont)) {
+      pAtlas->pFont    = pDrvFont;
+      pAtlas->bFailed  = true;
+      pAtlas->nLastUse = ++pDriver->nTxtCacheTick;
+      return false;
+    }
+  }
+  pAtlas->nLastUse = ++pDriver->nTxtCacheTick;
+
+  // The atlas doesn't support kerning or glyphs that extend beyond
+  // their advance width, so leave such strings to the text cache
+  bool bKern = (TTF_GetFontKerning(pDrvFont) != 0);
+  for (pChar=pStr;*pChar != '\0';pChar++) {
+    pGlyph = strchr(DRV_SDL_GLYPH_ATLAS_CHARS,*pChar);
+    if (!pAtlas->abGlyphFit[pGlyph - DRV_SDL_GLYPH_ATLAS_CHARS]) {
+      return false;
+    }
+    if ((bKern) && (pChar != pStr) &&
+        (TTF_GetFontKerningSizeGlyphs(pDrvFont,(Uint16)pChar[-1],(Uint16)pChar[0]) != 0)) {
+      return false;
+    }
+  }
+
+  SDL_SetTextureColorMod(pAtlas->pTex,colTxt.r,colTxt.g,colTxt.b);
+  rDst = (SDL_Rect){nTxtX,nTxtY,0,pAtlas->nH};
+  for (pChar=pStr;*pChar != '\0';pChar++) {
+    pGlyph = strchr(DRV_SDL_GLYPH_ATLAS_CHARS,*pChar);
+    nInd = (uint16_t)(pGlyph - DRV_SDL_GLYPH_ATLAS_CHARS);
+    rDst.w = pAtlas->anGlyphW[nInd];
+    if (rDst.w > 0) {
+      rSrc = (SDL_Rect){pAtlas->anGlyphX[nInd],0,rDst.w,pAtlas->nH};
+      SDL_RenderCopy(pDriver->pRender,pAtlas->pTex,&rSrc,&rDst);
+    }
+    rDst.x += rDst.w;
+  }
+  return true;
+#else
+  (void)pGui;      // Unused
+  (void)nTxtX;     // Unused
+  (void)nTxtY;     // Unused
+  (void)pDrvFont;  // Unused
+  (void)pStr;      // Unused
+  (void)colTxt;    // Unused
+  return false;
+#endif // DRV_SDL_GLYPH_ATLAS_CNT
+}
+#endif // DRV_DISP_SDL2
+
 
 
 // ------------------------------------------------------------------------
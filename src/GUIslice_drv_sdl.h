@@ -62,6 +62,61 @@ extern "C" {
   #include "tslib.h"
 #endif
 
+// Additional defines
+// - Provide default if not in config file
+
+#if defined(DRV_DISP_SDL2)
+  // Text texture cache
+  // - Retains the textures produced by gslc_DrvDrawTxt() so that
+  //   unchanged strings are not re-rasterized and re-uploaded on
+  //   every redraw. Entries are keyed on font, string, color and
+  //   encoding and are evicted in least-recently-used order.
+  // - DRV_SDL_TXT_CACHE_CNT:     Max number of cached strings (0 to disable)
+  // - DRV_SDL_TXT_CACHE_BYTES:   Max texture bytes held by the cache
+  //                              (including the glyph atlases)
+  // - DRV_SDL_TXT_CACHE_STR_LEN: Longest string (including terminator)
+  //                              that will be cached
+  #if !defined(DRV_SDL_TXT_CACHE_CNT)
+    #define DRV_SDL_TXT_CACHE_CNT       32
+  #endif
+  #if !defined(DRV_SDL_TXT_CACHE_BYTES)
+    #define DRV_SDL_TXT_CACHE_BYTES     (1024L*1024L)
+  #endif
+  #if !defined(DRV_SDL_TXT_CACHE_STR_LEN)
+    #define DRV_SDL_TXT_CACHE_STR_LEN   48
+  #endif
+
+  // Glyph atlas
+  // - Strings made up only of DRV_SDL_GLYPH_ATLAS_CHARS (eg. frequently
+  //   changing numeric readouts) are composed from a per-font atlas
+  //   texture instead of occupying a text cache entry per value.
+  // - Strings that would be affected by kerning, or that contain a
+  //   glyph extending beyond its advance width, are drawn via the
+  //   text cache instead.
+  // - DRV_SDL_GLYPH_ATLAS_CNT:   Max number of fonts with an atlas (0 to disable)
+  // - DRV_SDL_GLYPH_ATLAS_CHARS: Character set rendered into each atlas
+  #if !defined(DRV_SDL_GLYPH_ATLAS_CNT)
+    #define DRV_SDL_GLYPH_ATLAS_CNT     4
+  #endif
+  #if !defined(DRV_SDL_GLYPH_ATLAS_CHARS)
+    #define DRV_SDL_GLYPH_ATLAS_CHARS   "0123456789.,:-+%/ "
+  #endif
+  /// Number of glyphs in each atlas
+  #define DRV_SDL_GLYPH_ATLAS_LEN       (sizeof(DRV_SDL_GLYPH_ATLAS_CHARS)-1)
+
+  // Retained render target
+  // - All drawing is performed into a texture that persists between
+  //   frames and is copied to the window on each page flip. As the
+  //   back buffer is no longer discarded by SDL_RenderPresent(),
+  //   partial (clipped) redraw can be used as in SDL1.
+  // - If the renderer doesn't support render targets, the driver
+  //   falls back to a full page redraw on every update.
+  // - DRV_SDL_RENDER_TARGET: Enable retained render target (1 to enable)
+  #if !defined(DRV_SDL_RENDER_TARGET)
+    #define DRV_SDL_RENDER_TARGET       1
+  #endif
+#endif // DRV_DISP_SDL2
+
 // =======================================================================
 // API support definitions
 // - These defines indicate whether the driver includes optimized
@@ -75,8 +130,8 @@ extern "C" {
 
 #if defined(DRV_DISP_SDL1)
   #define DRV_HAS_DRAW_POINTS            1 ///< Support gslc_DrvDrawPoints()
-  #define DRV_HAS_DRAW_LINE              0 ///< Support gslc_DrvDrawLine()
-  #define DRV_HAS_DRAW_RECT_FRAME        0 ///< Support gslc_DrvDrawFrameRect()
+  #define DRV_HAS_DRAW_LINE              1 ///< Support gslc_DrvDrawLine()
+  #define DRV_HAS_DRAW_RECT_FRAME        1 ///< Support gslc_DrvDrawFrameRect()
   #define DRV_HAS_DRAW_RECT_FILL         1 ///< Support gslc_DrvDrawFillRect()
   #define DRV_HAS_DRAW_RECT_ROUND_FRAME  0 ///< Support gslc_DrvDrawFrameRoundRect()
   #define DRV_HAS_DRAW_RECT_ROUND_FILL   0 ///< Support gslc_DrvDrawFillRoundRect()
@@ -86,6 +141,11 @@ extern "C" {
   #define DRV_HAS_DRAW_TRI_FILL          0 ///< Support gslc_DrvDrawFillTriangle()
   #define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
   #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
+  #define DRV_HAS_DRAW_ROW               0 ///< Support gslc_DrvDrawRow()
+  #define DRV_HAS_BAND                   0 ///< Support gslc_DrvBandStart() / gslc_DrvBandFlush()
+  #define DRV_HAS_COPY_RECT              1 ///< Support gslc_DrvCopyRect()
+  #define DRV_HAS_FRAME_LOCK             1 ///< Support gslc_DrvFrameLock() / gslc_DrvFrameUnlock()
+  #define DRV_HAS_PAGE_SNAP              1 ///< Support gslc_DrvPageSnapSave() / gslc_DrvPageSnapRestore()
 #endif
 
 #if defined(DRV_DISP_SDL2)
@@ -101,6 +161,11 @@ extern "C" {
   #define DRV_HAS_DRAW_TRI_FILL          0 ///< Support gslc_DrvDrawFillTriangle()
   #define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
   #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
+  #define DRV_HAS_DRAW_ROW               0 ///< Support gslc_DrvDrawRow()
+  #define DRV_HAS_BAND                   0 ///< Support gslc_DrvBandStart() / gslc_DrvBandFlush()
+  #define DRV_HAS_COPY_RECT              0 ///< Support gslc_DrvCopyRect()
+  #define DRV_HAS_FRAME_LOCK             0 ///< Support gslc_DrvFrameLock() / gslc_DrvFrameUnlock()
+  #define DRV_HAS_PAGE_SNAP              1 ///< Support gslc_DrvPageSnapSave() / gslc_DrvPageSnapRestore()
 #endif
 
 #define DRV_OVERRIDE_TXT_ALIGN      0 ///< Driver provides text alignment
@@ -108,15 +173,66 @@ extern "C" {
 // =======================================================================
 // Driver-specific members
 // =======================================================================
+
+#if defined(DRV_DISP_SDL2)
+/// Text texture cache entry
+typedef struct {
+  SDL_Texture*        pTex;             ///< Rendered text texture (NULL if entry unused)
+  TTF_Font*           pFont;            ///< Font used to render the string
+  gslc_teTxtFlags     eTxtEnc;          ///< Text encoding (GSLC_TXT_ENC_*)
+  gslc_tsColor        colTxt;           ///< Text color
+  uint32_t            nHash;            ///< Hash of the string for quick rejection
+  uint32_t            nLastUse;         ///< Cache tick at last use (for LRU eviction)
+  uint32_t            nBytes;           ///< Texture size in bytes
+  uint16_t            nW;               ///< Texture width
+  uint16_t            nH;               ///< Texture height
+  char                acStr[DRV_SDL_TXT_CACHE_STR_LEN]; ///< Cached string
+} gslc_tsDrvTxtCache;
+
+/// Glyph atlas for composing strings from a fixed character set
+/// - Glyphs are rendered in white and tinted at draw time
+///   with SDL_SetTextureColorMod() so one atlas serves all colors
+/// - An entry with bFailed set records a font whose atlas couldn't
+///   be created, so that its strings go straight to the text cache
+typedef struct {
+  SDL_Texture*        pTex;             ///< Atlas texture (NULL if entry unused or failed)
+  TTF_Font*           pFont;            ///< Font used to render the glyphs
+  bool                bFailed;          ///< Atlas couldn't be created for the font
+  uint32_t            nLastUse;         ///< Cache tick at last use (for LRU eviction)
+  uint32_t            nBytes;           ///< Texture size in bytes
+  uint16_t            nH;               ///< Glyph height
+  uint16_t            anGlyphX[DRV_SDL_GLYPH_ATLAS_LEN]; ///< X offset of each glyph in atlas
+  uint16_t            anGlyphW[DRV_SDL_GLYPH_ATLAS_LEN]; ///< Advance width of each glyph
+  bool                abGlyphFit[DRV_SDL_GLYPH_ATLAS_LEN]; ///< Glyph lies within its advance width
+} gslc_tsDrvGlyphAtlas;
+#endif // DRV_DISP_SDL2
+
 typedef struct {
 
   #if defined(DRV_DISP_SDL1)
   SDL_Surface*        pSurfScreen;      ///< Surface ptr for screen
+  bool                bFrameLock;       ///< Keep the screen locked until the end of the frame
+  bool                bLocked;          ///< Screen surface is currently locked
+  uint8_t*            pPixels;          ///< Screen pixels (cached while locked)
+  uint16_t            nPitch;           ///< Screen row length in bytes (cached while locked)
+  uint8_t             nBpp;             ///< Screen bytes per pixel (cached while locked)
   #endif
 
   #if defined(DRV_DISP_SDL2)
   SDL_Window*         pWind;            ///< SDL2 Window
   SDL_Renderer*       pRender;          ///< SDL2 Rendering engine
+  SDL_Texture*        pTexTarget;       ///< Retained render target (NULL if not used)
+
+  #if (DRV_SDL_TXT_CACHE_CNT > 0)
+  gslc_tsDrvTxtCache  asTxtCache[DRV_SDL_TXT_CACHE_CNT]; ///< Text texture cache
+  #endif
+  #if (DRV_SDL_GLYPH_ATLAS_CNT > 0)
+  gslc_tsDrvGlyphAtlas asGlyphAtlas[DRV_SDL_GLYPH_ATLAS_CNT]; ///< Glyph atlases
+  #endif
+  uint32_t            nTxtCacheTick;    ///< Monotonic tick used for LRU ordering
+  uint32_t            nTxtCacheBytes;   ///< Texture bytes held by text cache and glyph atlases
+  uint32_t            nTxtCacheHit;     ///< Number of text draws served from cache
+  uint32_t            nTxtCacheMiss;    ///< Number of text draws that required rendering
   #endif
 
   #if defined(DRV_TOUCH_TSLIB)
@@ -362,6 +478,30 @@ bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gsl
 ///
 bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt,gslc_tsColor colBg);
 
+#if defined(DRV_DISP_SDL2)
+///
+/// Release all textures held by the text cache and glyph atlases
+/// - This is called automatically before fonts are released
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvTxtCacheFlush(gslc_tsGui* pGui);
+
+///
+/// Fetch the text cache statistics
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnHit:       Ptr to number of text draws served from cache
+/// \param[out] pnMiss:      Ptr to number of text draws that required rendering
+/// \param[out] pnBytes:     Ptr to texture bytes currently held
+///
+/// \return none
+///
+void gslc_DrvTxtCacheGetStats(gslc_tsGui* pGui,uint32_t* pnHit,uint32_t* pnMiss,uint32_t* pnBytes);
+#endif // DRV_DISP_SDL2
+
 
 // -----------------------------------------------------------------------
 // Screen Management Functions
@@ -377,6 +517,80 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
 ///
 void gslc_DrvPageFlipNow(gslc_tsGui* pGui);
 
+#if defined(DRV_DISP_SDL1)
+///
+/// Start a frame of drawing during which the screen surface
+/// is kept locked between pixel primitives
+/// - The lock is taken by the first pixel primitive and is
+///   only released for SDL blits / fills, or at the end of the frame
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvFrameLock(gslc_tsGui* pGui);
+
+///
+/// End a frame of drawing started by gslc_DrvFrameLock()
+/// and release any lock held on the screen surface
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvFrameUnlock(gslc_tsGui* pGui);
+#endif // DRV_DISP_SDL1
+
+
+// -----------------------------------------------------------------------
+// Page Snapshot Functions
+// -----------------------------------------------------------------------
+
+///
+/// Get the storage required for a snapshot of a region of the display
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the display
+///
+/// \return Size of the snapshot in bytes (or 0 if not supported)
+///
+uint32_t gslc_DrvPageSnapGetSize(gslc_tsGui* pGui,gslc_tsRect rRect);
+
+///
+/// Save a region of the display into a snapshot (see gslc_PageSetCacheEn)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in,out] ppvSnap:  Ptr to the snapshot storage. If it is NULL
+///                          (or too small for the region), the storage
+///                          is (re)allocated first.
+/// \param[in]  rRect:       Region of the display to save
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvPageSnapSave(gslc_tsGui* pGui,void** ppvSnap,gslc_tsRect rRect);
+
+///
+/// Restore a region of a snapshot of the display saved by gslc_DrvPageSnapSave()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pvSnap:      Snapshot storage
+/// \param[in]  rRect:       Region of the display to restore (within
+///                          the region saved in the snapshot)
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvPageSnapRestore(gslc_tsGui* pGui,void* pvSnap,gslc_tsRect rRect);
+
+///
+/// Release the storage of a snapshot
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pvSnap:      Snapshot storage
+///
+/// \return none
+///
+void gslc_DrvPageSnapFree(gslc_tsGui* pGui,void* pvSnap);
+
 
 // -----------------------------------------------------------------------
 // Graphics Primitives Functions
@@ -430,6 +644,21 @@ bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 
 
+///
+/// Copy a rectangular region of the display to another position
+/// - The source and destination regions may overlap
+/// - The caller ensures that both regions are on the display
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rSrc:        Region to copy
+/// \param[in]  nDstX:       Destination X coordinate (top-left)
+/// \param[in]  nDstY:       Destination Y coordinate (top-left)
+///
+/// \return true if success, false if not supported
+///
+bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY);
+
+
 ///
 /// Draw a line
 ///
@@ -596,6 +825,8 @@ bool gslc_DrvScreenLock(gslc_tsGui* pGui);
 /// Unlock the SDL surface after pixel manipulation is
 /// complete. This function is called after all pixel updates
 /// are done.
+/// - Within a frame started by gslc_DrvFrameLock() the
+///   surface remains locked
 ///
 /// POST:
 /// - Primary screen surface is unlocked
@@ -607,6 +838,21 @@ bool gslc_DrvScreenLock(gslc_tsGui* pGui);
 void gslc_DrvScreenUnlock(gslc_tsGui* pGui);
 
 
+///
+/// Release any lock held on the SDL surface, including
+/// one kept for the current frame. This function is called
+/// before any SDL blit or fill into the screen surface.
+///
+/// POST:
+/// - Primary screen surface is unlocked
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvScreenRelease(gslc_tsGui* pGui);
+
+
 ///
 /// Convert an RGB color triplet into the surface pixel value.
 /// This is called to produce the native pixel value required by
@@ -650,6 +896,24 @@ uint32_t gslc_DrvDrawGetPixelRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY);
 ///
 void gslc_DrvDrawSetPixelRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint32_t nPixelCol);
 
+
+///
+/// Fill a horizontal span on the active screen with a color
+/// - The span is clipped to the screen clipping region
+///
+/// PRE:
+/// - Screen surface must be locked
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of the start of the span
+/// \param[in]  nY:          Y coordinate of the span
+/// \param[in]  nW:          Width of the span
+/// \param[in]  nPixelCol:   Raw color pixel value to assign
+///
+/// \return none
+///
+void gslc_DrvFillSpanRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,int16_t nW,uint32_t nPixelCol);
+
 ///
 /// Copy one image region to another.
 /// - This is typically used to copy an image to the main screen surface
@@ -666,6 +930,76 @@ void gslc_DrvPasteSurface(gslc_tsGui* pGui,int16_t nX, int16_t nY, void* pvSrc,
 
 #endif // DRV_DISP_SDL1
 
+#if defined(DRV_DISP_SDL2)
+///
+/// Draw a string from the text texture cache, rendering and
+/// adding it to the cache on a miss
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nTxtX:       X coordinate of top-left text string
+/// \param[in]  nTxtY:       Y coordinate of top-left text string
+/// \param[in]  pDrvFont:    Ptr to SDL font
+/// \param[in]  pStr:        String to display
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[in]  colTxt:      Color to draw text
+///
+/// \return true if success, false if failure
+///
+bool gslc_DrvTxtCacheDraw(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,TTF_Font* pDrvFont,
+        const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt);
+
+///
+/// Evict least-recently-used strings from the text cache until
+/// the requested number of bytes fit within DRV_SDL_TXT_CACHE_BYTES
+/// - The byte budget is shared with the glyph atlases
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nBytes:      Number of texture bytes to be added
+///
+/// \return true if the bytes fit, false if the budget can't be met
+///
+bool gslc_DrvTxtCacheEvict(gslc_tsGui* pGui,uint32_t nBytes);
+
+///
+/// Get the texture size of the glyph atlas for a font
+///
+/// \param[in]  pDrvFont:    Ptr to SDL font
+///
+/// \return Size of the atlas texture in bytes
+///
+uint32_t gslc_DrvGlyphAtlasGetSize(TTF_Font* pDrvFont);
+
+///
+/// Render the atlas character set for a font into a single texture
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pAtlas:      Ptr to atlas entry to populate
+/// \param[in]  pDrvFont:    Ptr to SDL font
+///
+/// \return true if success, false if failure
+///
+bool gslc_DrvGlyphAtlasCreate(gslc_tsGui* pGui,gslc_tsDrvGlyphAtlas* pAtlas,TTF_Font* pDrvFont);
+
+///
+/// Draw a string by composing glyphs from the font's atlas,
+/// creating the atlas if needed
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nTxtX:       X coordinate of top-left text string
+/// \param[in]  nTxtY:       Y coordinate of top-left text string
+/// \param[in]  pDrvFont:    Ptr to SDL font
+/// \param[in]  pStr:        String to display
+/// \param[in]  colTxt:      Color to draw text
+///
+/// \return true if drawn, false if the string is not covered by
+///         the atlas character set or the atlas could not be created
+///         (in which case the font is marked so that the creation
+///         isn't attempted again until gslc_DrvTxtCacheFlush())
+///
+bool gslc_DrvGlyphAtlasDraw(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,TTF_Font* pDrvFont,
+        const char* pStr,gslc_tsColor colTxt);
+#endif // DRV_DISP_SDL2
+
 
 
 // -----------------------------------------------------------------------
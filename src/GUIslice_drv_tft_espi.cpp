@@ -109,6 +109,39 @@ TFT_eSPI m_disp = TFT_eSPI();
   TFT_eFEX fex = TFT_eFEX(&m_disp);
 #endif
 
+// ------------------------------------------------------------------------
+#if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+// Band renderer
+// - The band is composed in a sprite whose viewport datum maps display
+//   coordinates onto the band, so the drawing code is unchanged
+TFT_eSprite m_drvBand = TFT_eSprite(&m_disp);
+gslc_tsRect m_rDrvBand = {0,0,0,0};  // Region of the display covered by the band
+bool        m_bDrvBandDirect = false; // Band contains content drawn directly
+
+// Current drawing target: the band while a band is being
+// composed (see gslc_DrvBandStart), otherwise the display
+TFT_eSPI* m_pDrvGfx = &m_disp;
+#define DRV_GFX (*m_pDrvGfx)
+#else
+#define DRV_GFX m_disp
+#endif // GSLC_BAND_EN && DRV_HAS_BAND
+
+// ------------------------------------------------------------------------
+// Page snapshot (see gslc_DrvPageSnapSave)
+// - The pixels of the saved region (in the format returned by
+//   readRect) follow the header
+// - On ESP32 boards with PSRAM, the storage is allocated from PSRAM
+typedef struct {
+  gslc_tsRect rSnap;    // Region of the display held in the snapshot
+  uint32_t    nSize;    // Storage allocated for the pixels (in bytes)
+} gslc_tsDrvSnap;
+
+#if defined(ESP32) && defined(BOARD_HAS_PSRAM)
+  #define DRV_SNAP_MALLOC(nSize) ps_malloc(nSize)
+#else
+  #define DRV_SNAP_MALLOC(nSize) malloc(nSize)
+#endif
+
 // ------------------------------------------------------------------------
 #if defined(DRV_TOUCH_ADA_STMPE610)
   #if (ADATOUCH_I2C_HW) // Use I2C
@@ -207,6 +240,15 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
     // the rotation parameters and clipping region
     gslc_DrvRotate(pGui,GSLC_ROTATE);
 
+    #if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+    // Allocate the band sprite for the widest orientation
+    // - If this fails, the redraw falls back to drawing directly
+    m_drvBand.setColorDepth(16);
+    if (m_drvBand.createSprite(GSLC_MAX(pGui->nDisp0W,pGui->nDisp0H),GSLC_BAND_H) == NULL) {
+      GSLC_DEBUG_PRINT("WARNING: DrvInit() band sprite alloc failed\n",0);
+    }
+    #endif
+
     // Initialize SD card usage
     #if (GSLC_SD_EN)
       #if (!defined(ADAGFX_PIN_SDCS))
@@ -328,9 +370,8 @@ void gslc_DrvImageDestruct(void* pvImg)
 
 bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
 {
-  // NOTE: The clipping rect is currently saved in the
-  // driver struct, but the drawing code does not currently
-  // use it.
+  // NOTE: The clipping rect is saved in the driver struct
+  // and is used by the drawing code when GSLC_CLIP_EN is set.
   gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   if (pRect == NULL) {
     // Default to entire display
@@ -413,29 +454,29 @@ bool gslc_DrvDrawTxtAlign(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,i
   uint16_t nTxtScale = pFont->nSize;
 
   #ifdef SMOOTH_FONT
-    m_disp.setTextColor(nColRaw,nColBgRaw);
+    DRV_GFX.setTextColor(nColRaw,nColBgRaw);
   #else
-    m_disp.setTextColor(nColRaw);
+    DRV_GFX.setTextColor(nColRaw);
   #endif
 
   // TFT_eSPI font API differs from Adafruit-GFX's setFont() API
   if (pFont->pvFont == NULL) {
-    m_disp.setTextFont(1);
+    DRV_GFX.setTextFont(1);
   } else {
     #ifdef SMOOTH_FONT
       if (pFont->eFontRefType  == GSLC_FONTREF_FNAME){
         if (pFont->pvFont != pDriver->pvFontLast) {
-          m_disp.loadFont((const char*)pFont->pvFont);
+          DRV_GFX.loadFont((const char*)pFont->pvFont);
           pDriver->pvFontLast = pFont->pvFont;
         }
       } else {
-        m_disp.setFreeFont((const GFXfont *)pFont->pvFont);
+        DRV_GFX.setFreeFont((const GFXfont *)pFont->pvFont);
       }
     #else
-      m_disp.setFreeFont((const GFXfont *)pFont->pvFont);
+      DRV_GFX.setFreeFont((const GFXfont *)pFont->pvFont);
     #endif
   }
-  m_disp.setTextSize(nTxtScale);
+  DRV_GFX.setTextSize(nTxtScale);
 
   // Default to mid-mid datum
   int8_t  nDatum = MC_DATUM;
@@ -455,9 +496,9 @@ bool gslc_DrvDrawTxtAlign(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,i
     case GSLC_ALIGN_BOT_RIGHT:  nDatum = BR_DATUM; nTxtX = nX1; nTxtY = nY1; break;
     default:                    nDatum = MC_DATUM; break;
   }
-  m_disp.setTextDatum(nDatum);
+  DRV_GFX.setTextDatum(nDatum);
 
-  m_disp.drawString(pStr,nTxtX,nTxtY);
+  DRV_GFX.drawString(pStr,nTxtX,nTxtY);
 
   // For now, always return true
   return true;
@@ -485,35 +526,35 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
   #ifdef SMOOTH_FONT
       if (pFont->eFontRefType  == GSLC_FONTREF_FNAME){
         if (pFont->pvFont != pDriver->pvFontLast) {
-          m_disp.loadFont((const char*)pFont->pvFont);
+          DRV_GFX.loadFont((const char*)pFont->pvFont);
           pDriver->pvFontLast = pFont->pvFont;
         }
-        m_disp.setTextColor(nColRaw,nColBgRaw);
+        DRV_GFX.setTextColor(nColRaw,nColBgRaw);
       } else {
-        m_disp.setTextColor(nColRaw);
+        DRV_GFX.setTextColor(nColRaw);
       }
   #else
-  m_disp.setTextColor(nColRaw);
+  DRV_GFX.setTextColor(nColRaw);
   #endif
   // m_disp.setCursor(nTxtX,nTxtY);
-  m_disp.setTextSize(nTxtScale);
+  DRV_GFX.setTextSize(nTxtScale);
 
   // Default to top-left datum
-  m_disp.setTextDatum(TL_DATUM);
+  DRV_GFX.setTextDatum(TL_DATUM);
 
   if ((eTxtFlags & GSLC_TXT_MEM) == GSLC_TXT_MEM_RAM) {
     // String in SRAM; can access buffer directly
     // m_disp.println(pStr);
-    m_disp.drawString(pStr,nTxtX,nTxtY);
+    DRV_GFX.drawString(pStr,nTxtX,nTxtY);
   } else if ((eTxtFlags & GSLC_TXT_MEM) == GSLC_TXT_MEM_PROG) {
     // String in PROGMEM (flash); must access via pgm_* calls
     char    ch;
     int     nXOffset = 0;
     while ((ch = pgm_read_byte(pStr++))) {
       // m_disp.print(ch);
-      nXOffset += m_disp.drawChar(ch,nTxtX+nXOffset,nTxtY);
+      nXOffset += DRV_GFX.drawChar(ch,nTxtX+nXOffset,nTxtY);
     }
-    m_disp.println();
+    DRV_GFX.println();
   }
 
   return true;
@@ -542,18 +583,146 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
 }
 
 
+// -----------------------------------------------------------------------
+// Band rendering Functions
+// -----------------------------------------------------------------------
+
+bool gslc_DrvBandStart(gslc_tsGui* pGui,gslc_tsRect rBand)
+{
+  #if (GSLC_BAND_EN) && (DRV_HAS_BAND) && (TFT_ESPI_FEATURES & 0x0001) // Bit 0 = Viewport capability
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if ((!m_drvBand.created()) || ((int16_t)rBand.w > m_drvBand.width()) || ((int16_t)rBand.h > m_drvBand.height())) {
+    return false;
+  }
+  m_rDrvBand = rBand;
+  m_bDrvBandDirect = false;
+  // Offset the datum so that drawing at display coordinates lands
+  // in the band, and restrict the viewport to the band's extent
+  m_drvBand.setViewport(-rBand.x,-rBand.y,rBand.x+rBand.w,rBand.y+rBand.h,true);
+  m_pDrvGfx = &m_drvBand;
+  // Any smooth font must be loaded again into the band sprite
+  pDriver->pvFontLast = NULL;
+  return true;
+  #else
+  (void)pGui; // Unused
+  (void)rBand; // Unused
+  return false;
+  #endif
+}
+
+bool gslc_DrvBandFlush(gslc_tsGui* pGui)
+{
+  #if (GSLC_BAND_EN) && (DRV_HAS_BAND) && (TFT_ESPI_FEATURES & 0x0001) // Bit 0 = Viewport capability
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (m_pDrvGfx != &m_drvBand) {
+    return false;
+  }
+  m_pDrvGfx = &m_disp;
+  pDriver->pvFontLast = NULL;
+  m_drvBand.resetViewport();
+  if (m_bDrvBandDirect) {
+    // The band is incomplete, so leave the region to be drawn directly
+    return false;
+  }
+  // Push the band with a single address window transfer
+  m_drvBand.pushSprite(m_rDrvBand.x,m_rDrvBand.y,0,0,m_rDrvBand.w,m_rDrvBand.h);
+  return true;
+  #else
+  (void)pGui; // Unused
+  return false;
+  #endif
+}
+
+
+// -----------------------------------------------------------------------
+// Page Snapshot Functions
+// -----------------------------------------------------------------------
+
+uint32_t gslc_DrvPageSnapGetSize(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  (void)pGui; // Unused
+  return (uint32_t)sizeof(gslc_tsDrvSnap) + (uint32_t)rRect.w*rRect.h*sizeof(uint16_t);
+}
+
+bool gslc_DrvPageSnapSave(gslc_tsGui* pGui,void** ppvSnap,gslc_tsRect rRect)
+{
+  gslc_tsDrvSnap* pSnap = (gslc_tsDrvSnap*)(*ppvSnap);
+  gslc_tsRect     rDisp = { 0, 0, pGui->nDispW, pGui->nDispH };
+  uint32_t        nSize;
+  #if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+  // The display can't be read while a band is being composed
+  if (m_pDrvGfx != &m_disp) {
+    return false;
+  }
+  #endif // GSLC_BAND_EN && DRV_HAS_BAND
+  if ((rRect.w == 0) || (rRect.h == 0) || (!gslc_ClipRect(&rDisp,&rRect))) {
+    return false;
+  }
+  nSize = (uint32_t)rRect.w*rRect.h*sizeof(uint16_t);
+  if ((pSnap == NULL) || (pSnap->nSize < nSize)) {
+    free(pSnap);
+    *ppvSnap = NULL;
+    pSnap = (gslc_tsDrvSnap*)DRV_SNAP_MALLOC(sizeof(gslc_tsDrvSnap)+nSize);
+    if (pSnap == NULL) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvPageSnapSave() can't allocate %u bytes\n",(unsigned)nSize);
+      return false;
+    }
+    pSnap->nSize = nSize;
+    *ppvSnap = (void*)pSnap;
+  }
+  pSnap->rSnap = rRect;
+  // Read back the region from the display
+  m_disp.readRect(rRect.x,rRect.y,rRect.w,rRect.h,(uint16_t*)(pSnap+1));
+  return true;
+}
+
+bool gslc_DrvPageSnapRestore(gslc_tsGui* pGui,void* pvSnap,gslc_tsRect rRect)
+{
+  gslc_tsDrvSnap* pSnap = (gslc_tsDrvSnap*)pvSnap;
+  uint16_t*       pPixels;
+  int16_t         nRow;
+  (void)pGui; // Unused
+  #if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+  if (m_pDrvGfx != &m_disp) {
+    return false;
+  }
+  #endif // GSLC_BAND_EN && DRV_HAS_BAND
+  // Only the part of the region held in the snapshot is restored
+  if ((rRect.w == 0) || (rRect.h == 0) || (!gslc_ClipRect(&(pSnap->rSnap),&rRect))) {
+    return true;
+  }
+  pPixels = (uint16_t*)(pSnap+1) + (uint32_t)(rRect.y-pSnap->rSnap.y)*pSnap->rSnap.w
+    + (rRect.x-pSnap->rSnap.x);
+  if (rRect.w == pSnap->rSnap.w) {
+    // Full rows are contiguous, so push them in a single transfer
+    m_disp.pushRect(rRect.x,rRect.y,rRect.w,rRect.h,pPixels);
+  } else {
+    for (nRow=0;nRow<(int16_t)rRect.h;nRow++) {
+      m_disp.pushRect(rRect.x,rRect.y+nRow,rRect.w,1,pPixels+(uint32_t)nRow*pSnap->rSnap.w);
+    }
+  }
+  return true;
+}
+
+void gslc_DrvPageSnapFree(gslc_tsGui* pGui,void* pvSnap)
+{
+  (void)pGui; // Unused
+  free(pvSnap);
+}
+
+
 // -----------------------------------------------------------------------
 // Graphics Primitives Functions
 // -----------------------------------------------------------------------
 
 inline void gslc_DrvDrawPoint_base(int16_t nX, int16_t nY, uint16_t nColRaw)
 {
-  m_disp.drawPixel(nX,nY,nColRaw);
+  DRV_GFX.drawPixel(nX,nY,nColRaw);
 }
 
 inline void gslc_DrvDrawLine_base(int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,uint16_t nColRaw)
 {
-  m_disp.drawLine(nX0,nY0,nX1,nY1,nColRaw);
+  DRV_GFX.drawLine(nX0,nY0,nX1,nY1,nColRaw);
 }
 
 
@@ -585,17 +754,20 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 #endif
 
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.fillRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
+  DRV_GFX.fillRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
   return true;
 }
 
 bool gslc_DrvDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColor nCol)
 {
 #if (DRV_HAS_DRAW_RECT_ROUND_FILL)
-  // TODO: Support GSLC_CLIP_EN
-  // - Would need to determine how to clip the rounded corners
+#if (GSLC_CLIP_EN)
+  // Perform clipping
+  // - Partially visible rounded rects are drawn with clipped primitives
+  if (gslc_ClipDrawFillRoundRect(pGui,rRect,nRadius,nCol)) { return true; }
+#endif
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.fillRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
+  DRV_GFX.fillRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
 #endif
   return true;
 }
@@ -634,7 +806,7 @@ bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   nY1 = rRect.y + rRect.h - 1;
   if (gslc_ClipLine(&pDriver->rClipRect, &nX0, &nY0, &nX1, &nY1)) { gslc_DrvDrawLine_base(nX0, nY0, nX1, nY1, nColRaw); }
 #else
-  m_disp.drawRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
+  DRV_GFX.drawRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
 #endif
   return true;
 }
@@ -644,9 +816,12 @@ bool gslc_DrvDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadi
 #if (DRV_HAS_DRAW_RECT_ROUND_FRAME)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
 
-  // TODO: Support GSLC_CLIP_EN
-  // - Would need to determine how to clip the rounded corners
-  m_disp.drawRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
+#if (GSLC_CLIP_EN)
+  // Perform clipping
+  // - Partially visible rounded rects are drawn with clipped primitives
+  if (gslc_ClipDrawFrameRoundRect(pGui,rRect,nRadius,nCol)) { return true; }
+#endif
+  DRV_GFX.drawRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
 #endif
   return true;
 }
@@ -665,28 +840,36 @@ bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16
   return true;
 }
 
-bool gslc_DrvDrawFrameCircle(gslc_tsGui*,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
+bool gslc_DrvDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
 {
 #if (GSLC_CLIP_EN)
-  // TODO
+  // Perform clipping
+  // - Partially visible circles are drawn with clipped primitives
+  if (gslc_ClipDrawFrameCircle(pGui,nMidX,nMidY,nRadius,nCol)) { return true; }
+#else
+  (void)pGui; // Unused
 #endif
 
 #if (DRV_HAS_DRAW_CIRCLE_FRAME)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.drawCircle(nMidX,nMidY,nRadius,nColRaw);
+  DRV_GFX.drawCircle(nMidX,nMidY,nRadius,nColRaw);
 #endif
   return true;
 }
 
-bool gslc_DrvDrawFillCircle(gslc_tsGui*,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
+bool gslc_DrvDrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
 {
 #if (GSLC_CLIP_EN)
-  // TODO
+  // Perform clipping
+  // - Partially visible circles are drawn with clipped primitives
+  if (gslc_ClipDrawFillCircle(pGui,nMidX,nMidY,nRadius,nCol)) { return true; }
+#else
+  (void)pGui; // Unused
 #endif
 
 #if (DRV_HAS_DRAW_CIRCLE_FILL)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.fillCircle(nMidX,nMidY,nRadius,nColRaw);
+  DRV_GFX.fillCircle(nMidX,nMidY,nRadius,nColRaw);
 #endif
   return true;
 }
@@ -698,11 +881,13 @@ bool gslc_DrvDrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 #if (DRV_HAS_DRAW_TRI_FRAME)
 
 #if (GSLC_CLIP_EN)
-  // TODO
+  // Perform clipping
+  // - Partially visible triangles are drawn with clipped primitives
+  if (gslc_ClipDrawFrameTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol)) { return true; }
 #endif
 
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.drawTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
+  DRV_GFX.drawTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
 #endif
   return true;
 }
@@ -713,11 +898,13 @@ bool gslc_DrvDrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 #if (DRV_HAS_DRAW_TRI_FILL)
 
 #if (GSLC_CLIP_EN)
-  // TODO
+  // Perform clipping
+  // - Partially visible triangles are drawn with clipped primitives
+  if (gslc_ClipDrawFillTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol)) { return true; }
 #endif
 
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
-  m_disp.fillTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
+  DRV_GFX.fillTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
 #endif
   return true;
 }
@@ -782,14 +969,86 @@ void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,
 }
 // ----- REFERENCE CODE end
 
+#if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+// Draw the portion of an image (in raw colors) that lies within the band
+// - TFT_eSprite doesn't provide a transparent pushImage(), so the
+//   visible pixels are plotted individually
+void gslc_DrvBandDrawImg(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,int16_t nW,int16_t nH,
+  const uint16_t* pImage,bool bProgMem,bool bTrans)
+{
+  gslc_tsRect rVis = { nDstX, nDstY, (uint16_t)nW, (uint16_t)nH };
+  gslc_tsRect rBand = m_rDrvBand;
+  uint16_t    nTransRaw = gslc_DrvAdaptColorToRaw(pGui->sTransCol);
+  uint16_t    nColRaw;
+  int32_t     nInd;
+  if ((nW <= 0) || (nH <= 0) || (!gslc_ClipRect(&rBand,&rVis))) {
+    return;
+  }
+  for (int16_t nY=rVis.y; nY<rVis.y+(int16_t)rVis.h; nY++) {
+    for (int16_t nX=rVis.x; nX<rVis.x+(int16_t)rVis.w; nX++) {
+      nInd = (int32_t)(nY-nDstY)*nW + (nX-nDstX);
+      nColRaw = (bProgMem) ? pgm_read_word(&pImage[nInd]) : pImage[nInd];
+      if ((bTrans) && (nColRaw == nTransRaw)) {
+        continue;
+      }
+      m_drvBand.drawPixel(nX,nY,nColRaw);
+    }
+  }
+}
+#endif // GSLC_BAND_EN && DRV_HAS_BAND
+
 void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem)
 {
   const uint16_t* pImage = (const uint16_t*)pBitmap;
   int16_t h = *(pImage++);
   int16_t w = *(pImage++);
 
+  #if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+  if (m_pDrvGfx == &m_drvBand) {
+    gslc_DrvBandDrawImg(pGui,nDstX,nDstY,w,h,pImage,bProgMem,GSLC_BMP_TRANS_EN);
+    return;
+  }
+  #endif
+
   // Swap the colour byte order when rendering
   m_disp.setSwapBytes(true); 
+
+  #if (GSLC_CLIP_EN)
+  // Determine the visible region of the image
+  gslc_tsRect rVis;
+  if (!gslc_ClipImgRect(pGui,nDstX,nDstY,w,h,&rVis)) {
+    return;
+  }
+  #if !(TFT_ESPI_FEATURES & 0x0001) // Bit 0 = Viewport capability
+  // Without a viewport, TFT_eSPI only clips to the display bounds.
+  // Partially visible images are therefore pushed one row at a time,
+  // restricted to the visible columns.
+  if ((rVis.w != (uint16_t)w) || (rVis.h != (uint16_t)h)) {
+    const uint16_t* pRow;
+    #if (GSLC_BMP_TRANS_EN)
+      uint16_t nTransRaw = gslc_DrvAdaptColorToRaw(pGui->sTransCol);
+    #endif
+    for (int16_t nRow=rVis.y; nRow<rVis.y+rVis.h; nRow++) {
+      pRow = pImage + (int32_t)nRow*w + rVis.x;
+      #if (GSLC_BMP_TRANS_EN)
+        if (bProgMem) {
+          m_disp.pushImage(nDstX+rVis.x, nDstY+nRow, rVis.w, 1, pRow, nTransRaw);
+        } else {
+          m_disp.pushImage(nDstX+rVis.x, nDstY+nRow, rVis.w, 1, (uint16_t*) pRow, nTransRaw);
+        }
+      #else
+        if (bProgMem) {
+          m_disp.pushImage(nDstX+rVis.x, nDstY+nRow, rVis.w, 1, pRow);
+        } else {
+          m_disp.pushImage(nDstX+rVis.x, nDstY+nRow, rVis.w, 1, (uint16_t*) pRow);
+        }
+      #endif // GSLC_BMP_TRANS_EN
+    }
+    return;
+  }
+  #endif
+  #endif // GSLC_CLIP_EN
+
   #if (GSLC_BMP_TRANS_EN)
     uint16_t nTransRaw = gslc_DrvAdaptColorToRaw(pGui->sTransCol);
     if (bProgMem) {
@@ -806,160 +1065,76 @@ void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,cons
   #endif // GSLC_BMP_TRANS_EN
 }
 
+// Push a run of pixels into a single display row
+// - The run is converted to raw colors and pushed with a single address window transfer
+bool gslc_DrvDrawRow(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nLen,const gslc_tsColor* pasCol)
+{
+  (void)pGui; // Unused
+  uint16_t anRowBuf[GSLC_BMP_ROW_BUF_LEN];
+  uint16_t nChunk,nInd;
+  // Swap the colour byte order when rendering
+  m_disp.setSwapBytes(true);
+  while (nLen > 0) {
+    nChunk = (nLen > GSLC_BMP_ROW_BUF_LEN) ? GSLC_BMP_ROW_BUF_LEN : nLen;
+    for (nInd=0;nInd<nChunk;nInd++) {
+      anRowBuf[nInd] = gslc_DrvAdaptColorToRaw(pasCol[nInd]);
+    }
+    #if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+    if (m_pDrvGfx == &m_drvBand) {
+      gslc_DrvBandDrawImg(pGui,nX,nY,nChunk,1,anRowBuf,false,false);
+    } else {
+      m_disp.pushImage(nX,nY,nChunk,1,anRowBuf);
+    }
+    #else
+    m_disp.pushImage(nX,nY,nChunk,1,anRowBuf);
+    #endif
+    nX     += nChunk;
+    pasCol += nChunk;
+    nLen   -= nChunk;
+  }
+  return true;
+}
+
 #if (GSLC_SD_EN)
-// ----- REFERENCE CODE begin
-// The following code was based upon the following reference code but modified to
-// adapt for use in GUIslice.
-//
-//   URL:              https://github.com/adafruit/Adafruit_ILI9341/blob/master/examples/spitftbitmap/spitftbitmap.ino
-//   Original author:  Adafruit
-//   Function:         bmpDraw()
-
-// These read 16- and 32-bit types from the SD card file.
-// BMP data is stored little-endian, Arduino is little-endian too.
-// May need to reverse subscript order if porting elsewhere.
-uint16_t gslc_DrvRead16SD(fs::File &f) {
-  uint16_t result;
-  ((uint8_t *)&result)[0] = f.read(); // LSB
-  ((uint8_t *)&result)[1] = f.read(); // MSB
-  return result;
+// BMP stream read callback for a file on SD card
+uint16_t gslc_DrvReadSD(void* pvStream,uint8_t* pBuf,uint16_t nLen)
+{
+  File* pFile = (File*)pvStream;
+  return (uint16_t)pFile->read(pBuf,nLen);
 }
 
-uint32_t gslc_DrvRead32SD(fs::File &f) {
-  uint32_t result;
-  ((uint8_t *)&result)[0] = f.read(); // LSB
-  ((uint8_t *)&result)[1] = f.read();
-  ((uint8_t *)&result)[2] = f.read();
-  ((uint8_t *)&result)[3] = f.read(); // MSB
-  return result;
+// BMP stream seek callback for a file on SD card
+// - The seek is skipped if the file is already positioned
+//   (avoids a lot of cluster math in the SD library)
+bool gslc_DrvSeekSD(void* pvStream,uint32_t nPos)
+{
+  File* pFile = (File*)pvStream;
+  if (pFile->position() == nPos) {
+    return true;
+  }
+  return pFile->seek(nPos);
 }
 
 void gslc_DrvDrawBmp24FromSD(gslc_tsGui* pGui,const char *filename, uint16_t x, uint16_t y)
 {
-  File     bmpFile;
-  int      bmpWidth, bmpHeight;   // W+H in pixels
-  uint8_t  bmpDepth;              // Bit depth (currently must be 24)
-  uint32_t bmpImageoffset;        // Start of image data in file
-  uint32_t rowSize;               // Not always = bmpWidth; may have padding
-  uint8_t  sdbuffer[3*GSLC_SD_BUFFPIXEL]; // pixel buffer (R+G+B per pixel)
-  uint8_t  buffidx = sizeof(sdbuffer); // Current position in sdbuffer
-  boolean  goodBmp = false;       // Set to true on valid header parse
-  boolean  flip    = true;        // BMP is stored bottom-to-top
-  int      w, h, row, col;
-  uint8_t  r, g, b;
-  uint32_t pos = 0, startTime = millis();
-  (void)startTime; // Unused
-
-  if((x >= pGui->nDispW) || (y >= pGui->nDispH)) return;
-
-  //Serial.println();
-  //Serial.print("Loading image '");
-  //Serial.print(filename);
-  //Serial.println('\'');
+  File bmpFile;
 
   // Open requested file on SD card
   if ((bmpFile = SD.open(filename)) == 0) {
     GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() file not found [%s]",filename);
     return;
   }
-  // Parse BMP header
-  if(gslc_DrvRead16SD(bmpFile) == 0x4D42) { // BMP signature
-    uint32_t nFileSize = gslc_DrvRead32SD(bmpFile);
-    (void)nFileSize; // Unused
-    //Serial.print("File size: "); Serial.println(nFileSize);
-    (void)gslc_DrvRead32SD(bmpFile); // Read & ignore creator bytes
-    bmpImageoffset = gslc_DrvRead32SD(bmpFile); // Start of image data
-    //Serial.print("Image Offset: "); Serial.println(bmpImageoffset, DEC);
-    // Read DIB header
-    uint32_t nHdrSize = gslc_DrvRead32SD(bmpFile);
-    (void)nHdrSize; // Unused
-    //Serial.print("Header size: "); Serial.println(nHdrSize);
-    bmpWidth  = gslc_DrvRead32SD(bmpFile);
-    bmpHeight = gslc_DrvRead32SD(bmpFile);
-    if(gslc_DrvRead16SD(bmpFile) == 1) { // # planes -- must be '1'
-      bmpDepth = gslc_DrvRead16SD(bmpFile); // bits per pixel
-      //Serial.print("Bit Depth: "); Serial.println(bmpDepth);
-      if((bmpDepth == 24) && (gslc_DrvRead32SD(bmpFile) == 0)) { // 0 = uncompressed
-        goodBmp = true; // Supported BMP format -- proceed!
-        //Serial.print("Image size: ");
-        //Serial.print(bmpWidth);
-        //Serial.print('x');
-        //Serial.println(bmpHeight);
-
-        // BMP rows are padded (if needed) to 4-byte boundary
-        rowSize = (bmpWidth * 3 + 3) & ~3;
-
-        // If bmpHeight is negative, image is in top-down order.
-        // This is not canon but has been observed in the wild.
-        if(bmpHeight < 0) {
-          bmpHeight = -bmpHeight;
-          flip      = false;
-        }
 
-        // Crop area to be loaded
-        w = bmpWidth;
-        h = bmpHeight;
-        if((x+w-1) >= pGui->nDispW) w = pGui->nDispW  - x;
-        if((y+h-1) >= pGui->nDispH) h = pGui->nDispH - y;
-
-        // Set TFT address window to clipped image bounds
-        //xxx tft.setAddrWindow(x, y, x+w-1, y+h-1);
-
-        for (row=0; row<h; row++) { // For each scanline...
-
-          // Seek to start of scan line.  It might seem labor-
-          // intensive to be doing this on every line, but this
-          // method covers a lot of gritty details like cropping
-          // and scanline padding.  Also, the seek only takes
-          // place if the file position actually needs to change
-          // (avoids a lot of cluster math in SD library).
-          if(flip) // Bitmap is stored bottom-to-top order (normal BMP)
-            pos = bmpImageoffset + (bmpHeight - 1 - row) * rowSize;
-          else     // Bitmap is stored top-to-bottom
-            pos = bmpImageoffset + row * rowSize;
-          if(bmpFile.position() != pos) { // Need seek?
-            bmpFile.seek(pos);
-            buffidx = sizeof(sdbuffer); // Force buffer reload
-          }
-
-          for (col=0; col<w; col++) { // For each pixel...
-            // Time to read more pixel data?
-            if (buffidx >= sizeof(sdbuffer)) { // Indeed
-              bmpFile.read(sdbuffer, sizeof(sdbuffer));
-              buffidx = 0; // Set index to beginning
-            }
-
-            // Convert pixel from BMP to TFT format, push to display
-            b = sdbuffer[buffidx++];
-            g = sdbuffer[buffidx++];
-            r = sdbuffer[buffidx++];
-            //xxx tft.pushColor(tft.Color565(r,g,b));
-            gslc_tsColor nCol = (gslc_tsColor){r,g,b};
-            bool bDrawBit = true;
-            if (GSLC_BMP_TRANS_EN) {
-              gslc_tsColor nColTrans = pGui->sTransCol;
-              if ((nCol.r == nColTrans.r) && (nCol.g == nColTrans.g) && (nCol.b == nColTrans.b)) {
-                bDrawBit = false;
-              }
-            }
-            if (bDrawBit) {
-              gslc_DrvDrawPoint(pGui,x+col,y+row,nCol);
-            }
-
-          } // end pixel
-        } // end scanline
-        //Serial.print("Loaded in ");
-        //Serial.print(millis() - startTime);
-        //Serial.println(" ms");
-      } // end goodBmp
-    }
-  }
-  bmpFile.close();
-  if(!goodBmp) {
+  // Stream the visible portion of the image to the display
+  gslc_tsBmpReader sReader;
+  sReader.pvStream  = (void*)&bmpFile;
+  sReader.pfuncRead = &gslc_DrvReadSD;
+  sReader.pfuncSeek = &gslc_DrvSeekSD;
+  if (!gslc_BmpDraw(pGui,&sReader,(int16_t)x,(int16_t)y)) {
     GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() BMP format unknown [%s]",filename);
   }
+  bmpFile.close();
 }
-// ----- REFERENCE CODE end
 #endif // GSLC_SD_EN
 
 
@@ -1052,6 +1227,15 @@ bool gslc_DrvDrawBmpFromFile(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_t
 {
   const char* pStrFname = sImgRef.pFname;
 
+  #if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+  if (m_pDrvGfx == &m_drvBand) {
+    // TFT_eFEX can only draw to the display, so the band is
+    // discarded and the region is drawn directly instead
+    m_bDrvBandDirect = true;
+    return true;
+  }
+  #endif
+
   // Load BMP image from file system
   // NOTE: No return value is provided upon decoder failure,
   //       so we always proceed as if it is OK.
@@ -1063,6 +1247,15 @@ bool gslc_DrvDrawJpegFromFile(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_
 {
   const char* pStrFname = sImgRef.pFname;
 
+  #if (GSLC_BAND_EN) && (DRV_HAS_BAND)
+  if (m_pDrvGfx == &m_drvBand) {
+    // TFT_eFEX can only draw to the display, so the band is
+    // discarded and the region is drawn directly instead
+    m_bDrvBandDirect = true;
+    return true;
+  }
+  #endif
+
   // Load JPEG image from file system
 #if defined(ESP32)
   // use optimized ESP32 native decoder
@@ -1099,8 +1292,12 @@ void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
       //       that API doesn't support clipping. Since
       //       we may be redrawing the page with a clipping
       //       region enabled, it is important that we don't
-      //       redraw the entire screen.
+      //       redraw the entire screen. Only the current
+      //       clipping region is filled.
       gslc_tsRect rRect = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+      if (!gslc_ClipRect(&pDriver->rClipRect, &rRect)) {
+        return;
+      }
       gslc_DrvDrawFillRect(pGui, rRect, pDriver->nColBkgnd);
     } else {
       // An image should be loaded
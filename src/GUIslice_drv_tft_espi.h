@@ -134,6 +134,11 @@ extern "C" {
 #define DRV_HAS_DRAW_TRI_FILL          1 ///< Support gslc_DrvDrawFillTriangle()
 #define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
 #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
+#define DRV_HAS_DRAW_ROW               1 ///< Support gslc_DrvDrawRow()
+#define DRV_HAS_BAND                   1 ///< Support gslc_DrvBandStart() / gslc_DrvBandFlush()
+#define DRV_HAS_COPY_RECT              0 ///< Support gslc_DrvCopyRect()
+#define DRV_HAS_FRAME_LOCK             0 ///< Support gslc_DrvFrameLock() / gslc_DrvFrameUnlock()
+#define DRV_HAS_PAGE_SNAP              1 ///< Support gslc_DrvPageSnapSave() / gslc_DrvPageSnapRestore()
 
 #define DRV_OVERRIDE_TXT_ALIGN         1 ///< Driver provides text alignment
 
@@ -432,6 +437,92 @@ bool gslc_DrvDrawTxtAlign(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,i
 void gslc_DrvPageFlipNow(gslc_tsGui* pGui);
 
 
+// -----------------------------------------------------------------------
+// Band rendering Functions
+// -----------------------------------------------------------------------
+
+///
+/// Start composing a band of the display in the band sprite
+/// - All drawing is redirected to the band sprite until
+///   gslc_DrvBandFlush() is called
+/// - Requires the viewport capability of TFT_eSPI (v2.3.2+)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rBand:       Region of the display covered by the band
+///                          (at most GSLC_BAND_H lines)
+///
+/// \return true if success, false if the band sprite is unavailable
+///
+bool gslc_DrvBandStart(gslc_tsGui* pGui,gslc_tsRect rBand);
+
+///
+/// Push the completed band to the display in a single transfer
+/// and end the redirection started by gslc_DrvBandStart()
+/// - Images loaded from SPIFFS are drawn by TFT_eFEX, which can only
+///   target the display. A band containing such an image is discarded
+///   so that the caller draws the region directly instead.
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return true if success, false if no band was started or the
+///         band was discarded
+///
+bool gslc_DrvBandFlush(gslc_tsGui* pGui);
+
+
+// -----------------------------------------------------------------------
+// Page Snapshot Functions
+// -----------------------------------------------------------------------
+
+///
+/// Get the storage required for a snapshot of a region of the display
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the display
+///
+/// \return Size of the snapshot in bytes (or 0 if not supported)
+///
+uint32_t gslc_DrvPageSnapGetSize(gslc_tsGui* pGui,gslc_tsRect rRect);
+
+///
+/// Save a region of the display into a snapshot (see gslc_PageSetCacheEn)
+/// - The region is read back from the display with readRect(), so the
+///   display must support reads (eg. TFT_MISO must be connected)
+/// - On ESP32 boards with PSRAM, the storage is allocated from PSRAM
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in,out] ppvSnap:  Ptr to the snapshot storage. If it is NULL
+///                          (or too small for the region), the storage
+///                          is (re)allocated first.
+/// \param[in]  rRect:       Region of the display to save
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvPageSnapSave(gslc_tsGui* pGui,void** ppvSnap,gslc_tsRect rRect);
+
+///
+/// Restore a region of a snapshot of the display saved by gslc_DrvPageSnapSave()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pvSnap:      Snapshot storage
+/// \param[in]  rRect:       Region of the display to restore (within
+///                          the region saved in the snapshot)
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvPageSnapRestore(gslc_tsGui* pGui,void* pvSnap,gslc_tsRect rRect);
+
+///
+/// Release the storage of a snapshot
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pvSnap:      Snapshot storage
+///
+/// \return none
+///
+void gslc_DrvPageSnapFree(gslc_tsGui* pGui,void* pvSnap);
+
+
 // -----------------------------------------------------------------------
 // Graphics Primitives Functions
 // -----------------------------------------------------------------------
@@ -637,6 +728,42 @@ void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY, cons
 ///
 void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem);
 
+///
+/// Draw a horizontal run of pixels
+/// - Used by the BMP streaming decoder (gslc_BmpDraw) to push the
+///   visible portion of each scanline
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of the first pixel
+/// \param[in]  nY:          Y coordinate of the row
+/// \param[in]  nLen:        Number of pixels in the run
+/// \param[in]  pasCol:      Array of pixel colors
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawRow(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nLen,const gslc_tsColor* pasCol);
+
+///
+/// BMP stream read callback for a file on SD card
+///
+/// \param[in]  pvStream:    Void pointer to File
+/// \param[out] pBuf:        Buffer to read into
+/// \param[in]  nLen:        Number of bytes to read
+///
+/// \return Number of bytes read
+///
+uint16_t gslc_DrvReadSD(void* pvStream,uint8_t* pBuf,uint16_t nLen);
+
+///
+/// BMP stream seek callback for a file on SD card
+///
+/// \param[in]  pvStream:    Void pointer to File
+/// \param[in]  nPos:        Absolute position in file
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSeekSD(void* pvStream,uint32_t nPos);
+
 #if (GSLC_SPIFFS_EN)
 ///
 /// This routine uses TFT_eFEX library to draw a BMP file stored in SPIFFS file system
@@ -259,9 +259,8 @@ void gslc_DrvImageDestruct(void* pvImg)
 
 bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
 {
-  // NOTE: The clipping rect is currently saved in the
-  // driver struct, but the drawing code does not currently
-  // use it.
+  // NOTE: The clipping rect is saved in the driver struct
+  // and is used by the drawing code when GSLC_CLIP_EN is set.
   gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   if (pRect == NULL) {
     // Default to entire display
@@ -342,12 +341,51 @@ bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gsl
 
 }
 
+#if (GSLC_CLIP_EN)
+// Draw the visible pixels of a character in the current font and color
+// - UTFT fonts are monospaced bitmaps: a 4-byte header (width, height,
+//   first character, character count) followed by the rows of each
+//   character, with each row packed into width/8 bytes (MSB first)
+void gslc_DrvDrawCharClip(gslc_tsGui* pGui,char ch,int16_t nX,int16_t nY)
+{
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint8_t*        pFont = m_disp.getFont();
+  uint8_t         nFontW = pgm_read_byte(&pFont[0]);
+  uint8_t         nFontH = pgm_read_byte(&pFont[1]);
+  uint8_t         nFirst = pgm_read_byte(&pFont[2]);
+  uint8_t         nNum   = pgm_read_byte(&pFont[3]);
+  uint16_t        nRowBytes = nFontW/8;
+  int16_t         nRow,nCol;
+  uint8_t         nBits = 0;
+
+  if (((uint8_t)ch < nFirst) || ((uint8_t)ch >= nFirst+nNum)) {
+    return;
+  }
+  const uint8_t* pGlyph = pFont + 4 + (uint32_t)((uint8_t)ch-nFirst)*nRowBytes*nFontH;
+  for (nRow=0;nRow<nFontH;nRow++) {
+    for (nCol=0;nCol<nFontW;nCol++) {
+      if ((nCol % 8) == 0) {
+        nBits = pgm_read_byte(&pGlyph[nRow*nRowBytes + nCol/8]);
+      }
+      if ((nBits & (0x80 >> (nCol % 8))) && (gslc_ClipPt(&pDriver->rClipRect,nX+nCol,nY+nRow))) {
+        m_disp.drawPixel(nX+nCol,nY+nRow);
+      }
+    }
+  }
+}
+#endif // GSLC_CLIP_EN
+
 bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt, gslc_tsColor colBg=GSLC_COL_BLACK)
 {
   //uint16_t  nTxtScale = pFont->nSize;
   uint16_t  nColRaw = gslc_DrvAdaptColorToRaw(colTxt);
   char      ch;
   int16_t   nTxtXStart;
+#if (GSLC_CLIP_EN)
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect     rGlyph;
+  gslc_teClipRes  eClip;
+#endif
 
   // Initialize the font and positioning
   m_disp.setFont((uint8_t*)pFont->pvFont);
@@ -385,9 +423,24 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
     }
 
     // Render the character
+#if (GSLC_CLIP_EN)
+    // Clip the text one glyph at a time
+    // - Glyphs outside the clipping region are skipped and only the
+    //   visible pixels of partially visible glyphs are drawn
+    rGlyph = (gslc_tsRect) { nTxtX, nTxtY, (uint16_t)m_disp.getFontXsize(), (uint16_t)m_disp.getFontYsize() };
+    eClip = gslc_ClipRectTest(&pDriver->rClipRect,rGlyph);
+    if (eClip == GSLC_CLIP_IN) {
+      // Call UTFT for rendering
+      // Note that UTFT:printChar() is public but not documented
+      m_disp.printChar(ch,nTxtX,nTxtY);
+    } else if (eClip == GSLC_CLIP_PART) {
+      gslc_DrvDrawCharClip(pGui,ch,nTxtX,nTxtY);
+    }
+#else
     // Call UTFT for rendering
     // Note that UTFT:printChar() is public but not documented
     m_disp.printChar(ch,nTxtX,nTxtY);
+#endif // GSLC_CLIP_EN
     // Advance the current position
     nTxtX += m_disp.getFontXsize();
 
@@ -479,8 +532,11 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 
 bool gslc_DrvDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColor nCol)
 {
-  // TODO: Support GSLC_CLIP_EN
-  // - Would need to determine how to clip the rounded corners
+#if (GSLC_CLIP_EN)
+  // Perform clipping
+  // - Partially visible rounded rects are drawn with clipped primitives
+  if (gslc_ClipDrawFillRoundRect(pGui,rRect,nRadius,nCol)) { return true; }
+#endif
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   m_disp.setColor(nColRaw);
   // TODO: Handle radius?
@@ -534,8 +590,11 @@ bool gslc_DrvDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadi
 #if (DRV_HAS_DRAW_RECT_ROUND_FRAME)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
 
-  // TODO: Support GSLC_CLIP_EN
-  // - Would need to determine how to clip the rounded corners
+#if (GSLC_CLIP_EN)
+  // Perform clipping
+  // - Partially visible rounded rects are drawn with clipped primitives
+  if (gslc_ClipDrawFrameRoundRect(pGui,rRect,nRadius,nCol)) { return true; }
+#endif
   m_disp.setColor(nColRaw);
   // TODO: Handle radius?
   m_disp.drawRoundRect(rRect.x,rRect.y,rRect.x+rRect.w-1,rRect.y+rRect.h-1);
@@ -557,10 +616,14 @@ bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16
   return true;
 }
 
-bool gslc_DrvDrawFrameCircle(gslc_tsGui*,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
+bool gslc_DrvDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
 {
 #if (GSLC_CLIP_EN)
-  // TODO
+  // Perform clipping
+  // - Partially visible circles are drawn with clipped primitives
+  if (gslc_ClipDrawFrameCircle(pGui,nMidX,nMidY,nRadius,nCol)) { return true; }
+#else
+  (void)pGui; // Unused
 #endif
 
 #if (DRV_HAS_DRAW_CIRCLE_FRAME)
@@ -571,10 +634,14 @@ bool gslc_DrvDrawFrameCircle(gslc_tsGui*,int16_t nMidX,int16_t nMidY,uint16_t nR
   return true;
 }
 
-bool gslc_DrvDrawFillCircle(gslc_tsGui*,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
+bool gslc_DrvDrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
 {
 #if (GSLC_CLIP_EN)
-  // TODO
+  // Perform clipping
+  // - Partially visible circles are drawn with clipped primitives
+  if (gslc_ClipDrawFillCircle(pGui,nMidX,nMidY,nRadius,nCol)) { return true; }
+#else
+  (void)pGui; // Unused
 #endif
 
 #if (DRV_HAS_DRAW_CIRCLE_FILL)
@@ -645,9 +712,16 @@ void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,
 }
 // ----- REFERENCE CODE end
 
+// Push a run of raw pixels into a single display row
+// - UTFT's drawBitmap() reads the pixels from flash on AVR
+//   and from memory on other targets
+inline void gslc_DrvDrawBmpRun_base(int16_t nX, int16_t nY, const uint16_t* pnRun, uint16_t nLen)
+{
+  m_disp.drawBitmap(nX,nY,nLen,1,(bitmapdatatype)pnRun);
+}
+
 void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem)
 {
-  // AdaFruit GFX doesn't have a routine for this so we output pixel by pixel
   const uint16_t* pImage = (const uint16_t*)pBitmap;
   int16_t h, w;
   if (bProgMem) {
@@ -660,174 +734,146 @@ void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,cons
   #if defined(DBG_DRIVER)
   GSLC_DEBUG_PRINT("DBG: DrvDrawBmp24FromMem() w=%d h=%d\n", w, h);
   #endif
+  // Determine the visible region of the image
+  gslc_tsRect rVis = { 0, 0, (uint16_t)w, (uint16_t)h };
+  #if (GSLC_CLIP_EN)
+  if (!gslc_ClipImgRect(pGui,nDstX,nDstY,w,h,&rVis)) {
+    return;
+  }
+  #endif
+
+  // Determine if the image can be streamed in runs
+  // - On AVR, UTFT can only stream images from flash
+  #if defined(__AVR__)
+  bool bRunEn = bProgMem;
+  #else
+  bool bRunEn = true;
+  #endif
+
+  // If transparency is enabled, convert the transparent color once
+  bool     bTransEn = (GSLC_BMP_TRANS_EN) ? true : false;
+  uint16_t nTransRaw = gslc_DrvAdaptColorToRaw(pGui->sTransCol);
+
+  // Push the entire image in a single transfer if possible
+  if ((bRunEn) && (!bTransEn) && (rVis.w == (uint16_t)w) && (rVis.h == (uint16_t)h)) {
+    m_disp.drawBitmap(nDstX,nDstY,w,h,(bitmapdatatype)pImage);
+    return;
+  }
+
   int row, col;
-  for (row=0; row<h; row++) { // For each scanline...
-    for (col=0; col<w; col++) { // For each pixel...
+  uint16_t nColRaw;
+  const uint16_t* pRow;
+  const uint16_t* pRun;
+  uint16_t nRunLen;
+  for (row=rVis.y; row<rVis.y+rVis.h; row++) { // For each scanline...
+    pRow = pImage + (int32_t)row*w + rVis.x;
+    pRun = pRow;
+    nRunLen = 0;
+    for (col=rVis.x; col<rVis.x+rVis.w; col++) { // For each pixel...
       if (bProgMem) {
         //To read from Flash Memory, pgm_read_XXX is required.
         //Since image is stored as uint16_t, pgm_read_word is used as it uses 16bit address
-        gslc_DrvDrawPoint_base(nDstX+col, nDstY+row, pgm_read_word(pImage++));
+        nColRaw = pgm_read_word(pRow++);
       } else {
-        gslc_DrvDrawPoint_base(nDstX+col, nDstY+row, *(pImage++));
+        nColRaw = *(pRow++);
+      }
+
+      // Skip the pixel if it is masked by transparency
+      if ((bTransEn) && (nColRaw == nTransRaw)) {
+        // End the current run
+        if (nRunLen > 0) {
+          gslc_DrvDrawBmpRun_base(nDstX+col-nRunLen, nDstY+row, pRun, nRunLen);
+        }
+        pRun = pRow;
+        nRunLen = 0;
+        continue;
+      }
+
+      if (bRunEn) {
+        // Extend the current run
+        // - UTFT reads the run directly from the image so no
+        //   intermediate line buffer is required
+        nRunLen++;
+      } else {
+        gslc_DrvDrawPoint_base(nDstX+col, nDstY+row, nColRaw);
       }
     } // end pixel
+
+    // Flush the remainder of the row
+    if (nRunLen > 0) {
+      gslc_DrvDrawBmpRun_base(nDstX+col-nRunLen, nDstY+row, pRun, nRunLen);
+    }
+  }
+}
+
+// Push a run of pixels into a single display row
+// - The run is converted to raw colors and pushed with a single address window transfer where
+//   the library supports it
+bool gslc_DrvDrawRow(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nLen,const gslc_tsColor* pasCol)
+{
+  (void)pGui; // Unused
+  uint16_t anRowBuf[GSLC_BMP_ROW_BUF_LEN];
+  uint16_t nChunk,nInd;
+  while (nLen > 0) {
+    nChunk = (nLen > GSLC_BMP_ROW_BUF_LEN) ? GSLC_BMP_ROW_BUF_LEN : nLen;
+    for (nInd=0;nInd<nChunk;nInd++) {
+      anRowBuf[nInd] = gslc_DrvAdaptColorToRaw(pasCol[nInd]);
+    }
+    #if defined(__AVR__)
+    // UTFT can only stream bitmaps from flash on AVR
+    for (nInd=0;nInd<nChunk;nInd++) {
+      gslc_DrvDrawPoint_base(nX+nInd,nY,anRowBuf[nInd]);
+    }
+    #else
+    gslc_DrvDrawBmpRun_base(nX,nY,anRowBuf,nChunk);
+    #endif
+    nX     += nChunk;
+    pasCol += nChunk;
+    nLen   -= nChunk;
   }
+  return true;
 }
 
 #if (GSLC_SD_EN)
-// ----- REFERENCE CODE begin
-// The following code was based upon the following reference code but modified to
-// adapt for use in GUIslice.
-//
-//   URL:              https://github.com/adafruit/Adafruit_ILI9341/blob/master/examples/spitftbitmap/spitftbitmap.ino
-//   Original author:  Adafruit
-//   Function:         bmpDraw()
-
-// These read 16- and 32-bit types from the SD card file.
-// BMP data is stored little-endian, Arduino is little-endian too.
-// May need to reverse subscript order if porting elsewhere.
-uint16_t gslc_DrvRead16SD(File &f) {
-  uint16_t result;
-  ((uint8_t *)&result)[0] = f.read(); // LSB
-  ((uint8_t *)&result)[1] = f.read(); // MSB
-  return result;
+// BMP stream read callback for a file on SD card
+uint16_t gslc_DrvReadSD(void* pvStream,uint8_t* pBuf,uint16_t nLen)
+{
+  File* pFile = (File*)pvStream;
+  return (uint16_t)pFile->read(pBuf,nLen);
 }
 
-uint32_t gslc_DrvRead32SD(File &f) {
-  uint32_t result;
-  ((uint8_t *)&result)[0] = f.read(); // LSB
-  ((uint8_t *)&result)[1] = f.read();
-  ((uint8_t *)&result)[2] = f.read();
-  ((uint8_t *)&result)[3] = f.read(); // MSB
-  return result;
+// BMP stream seek callback for a file on SD card
+// - The seek is skipped if the file is already positioned
+//   (avoids a lot of cluster math in the SD library)
+bool gslc_DrvSeekSD(void* pvStream,uint32_t nPos)
+{
+  File* pFile = (File*)pvStream;
+  if (pFile->position() == nPos) {
+    return true;
+  }
+  return pFile->seek(nPos);
 }
 
 void gslc_DrvDrawBmp24FromSD(gslc_tsGui* pGui,const char *filename, uint16_t x, uint16_t y)
 {
-  File     bmpFile;
-  int      bmpWidth, bmpHeight;   // W+H in pixels
-  uint8_t  bmpDepth;              // Bit depth (currently must be 24)
-  uint32_t bmpImageoffset;        // Start of image data in file
-  uint32_t rowSize;               // Not always = bmpWidth; may have padding
-  uint8_t  sdbuffer[3*GSLC_SD_BUFFPIXEL]; // pixel buffer (R+G+B per pixel)
-  uint8_t  buffidx = sizeof(sdbuffer); // Current position in sdbuffer
-  boolean  goodBmp = false;       // Set to true on valid header parse
-  boolean  flip    = true;        // BMP is stored bottom-to-top
-  int      w, h, row, col;
-  uint8_t  r, g, b;
-  uint32_t pos = 0, startTime = millis();
-  (void)startTime; // Unused
-
-  if((x >= pGui->nDispW) || (y >= pGui->nDispH)) return;
-
-  //Serial.println();
-  //Serial.print("Loading image '");
-  //Serial.print(filename);
-  //Serial.println('\'');
+  File bmpFile;
 
   // Open requested file on SD card
   if ((bmpFile = SD.open(filename)) == 0) {
     GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() file not found [%s]",filename);
     return;
   }
-  // Parse BMP header
-  if(gslc_DrvRead16SD(bmpFile) == 0x4D42) { // BMP signature
-    uint32_t nFileSize = gslc_DrvRead32SD(bmpFile);
-    (void)nFileSize; // Unused
-    //Serial.print("File size: "); Serial.println(nFileSize);
-    (void)gslc_DrvRead32SD(bmpFile); // Read & ignore creator bytes
-    bmpImageoffset = gslc_DrvRead32SD(bmpFile); // Start of image data
-    //Serial.print("Image Offset: "); Serial.println(bmpImageoffset, DEC);
-    // Read DIB header
-    uint32_t nHdrSize = gslc_DrvRead32SD(bmpFile);
-    (void)nHdrSize; // Unused
-    //Serial.print("Header size: "); Serial.println(nHdrSize);
-    bmpWidth  = gslc_DrvRead32SD(bmpFile);
-    bmpHeight = gslc_DrvRead32SD(bmpFile);
-    if(gslc_DrvRead16SD(bmpFile) == 1) { // # planes -- must be '1'
-      bmpDepth = gslc_DrvRead16SD(bmpFile); // bits per pixel
-      //Serial.print("Bit Depth: "); Serial.println(bmpDepth);
-      if((bmpDepth == 24) && (gslc_DrvRead32SD(bmpFile) == 0)) { // 0 = uncompressed
-        goodBmp = true; // Supported BMP format -- proceed!
-        //Serial.print("Image size: ");
-        //Serial.print(bmpWidth);
-        //Serial.print('x');
-        //Serial.println(bmpHeight);
-
-        // BMP rows are padded (if needed) to 4-byte boundary
-        rowSize = (bmpWidth * 3 + 3) & ~3;
-
-        // If bmpHeight is negative, image is in top-down order.
-        // This is not canon but has been observed in the wild.
-        if(bmpHeight < 0) {
-          bmpHeight = -bmpHeight;
-          flip      = false;
-        }
 
-        // Crop area to be loaded
-        w = bmpWidth;
-        h = bmpHeight;
-        if((x+w-1) >= pGui->nDispW) w = pGui->nDispW  - x;
-        if((y+h-1) >= pGui->nDispH) h = pGui->nDispH - y;
-
-        // Set TFT address window to clipped image bounds
-        //xxx tft.setAddrWindow(x, y, x+w-1, y+h-1);
-
-        for (row=0; row<h; row++) { // For each scanline...
-
-          // Seek to start of scan line.  It might seem labor-
-          // intensive to be doing this on every line, but this
-          // method covers a lot of gritty details like cropping
-          // and scanline padding.  Also, the seek only takes
-          // place if the file position actually needs to change
-          // (avoids a lot of cluster math in SD library).
-          if(flip) // Bitmap is stored bottom-to-top order (normal BMP)
-            pos = bmpImageoffset + (bmpHeight - 1 - row) * rowSize;
-          else     // Bitmap is stored top-to-bottom
-            pos = bmpImageoffset + row * rowSize;
-          if(bmpFile.position() != pos) { // Need seek?
-            bmpFile.seek(pos);
-            buffidx = sizeof(sdbuffer); // Force buffer reload
-          }
-
-          for (col=0; col<w; col++) { // For each pixel...
-            // Time to read more pixel data?
-            if (buffidx >= sizeof(sdbuffer)) { // Indeed
-              bmpFile.read(sdbuffer, sizeof(sdbuffer));
-              buffidx = 0; // Set index to beginning
-            }
-
-            // Convert pixel from BMP to TFT format, push to display
-            b = sdbuffer[buffidx++];
-            g = sdbuffer[buffidx++];
-            r = sdbuffer[buffidx++];
-            //xxx tft.pushColor(tft.Color565(r,g,b));
-            gslc_tsColor nCol = (gslc_tsColor){r,g,b};
-            bool bDrawBit = true;
-            if (GSLC_BMP_TRANS_EN) {
-              gslc_tsColor nColTrans = pGui->sTransCol;
-              if ((nCol.r == nColTrans.r) && (nCol.g == nColTrans.g) && (nCol.b == nColTrans.b)) {
-                bDrawBit = false;
-              }
-            }
-            if (bDrawBit) {
-              gslc_DrvDrawPoint(pGui,x+col,y+row,nCol);
-            }
-
-          } // end pixel
-        } // end scanline
-        //Serial.print("Loaded in ");
-        //Serial.print(millis() - startTime);
-        //Serial.println(" ms");
-      } // end goodBmp
-    }
-  }
-  bmpFile.close();
-  if(!goodBmp) {
+  // Stream the visible portion of the image to the display
+  gslc_tsBmpReader sReader;
+  sReader.pvStream  = (void*)&bmpFile;
+  sReader.pfuncRead = &gslc_DrvReadSD;
+  sReader.pfuncSeek = &gslc_DrvSeekSD;
+  if (!gslc_BmpDraw(pGui,&sReader,(int16_t)x,(int16_t)y)) {
     GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() BMP format unknown [%s]",filename);
   }
+  bmpFile.close();
 }
-// ----- REFERENCE CODE end
 #endif // GSLC_SD_EN
 
 
@@ -920,8 +966,12 @@ void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
       //       that API doesn't support clipping. Since
       //       we may be redrawing the page with a clipping
       //       region enabled, it is important that we don't
-      //       redraw the entire screen.
+      //       redraw the entire screen. Only the current
+      //       clipping region is filled.
       gslc_tsRect rRect = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+      if (!gslc_ClipRect(&pDriver->rClipRect, &rRect)) {
+        return;
+      }
       gslc_DrvDrawFillRect(pGui, rRect, pDriver->nColBkgnd);
     } else {
       // An image should be loaded
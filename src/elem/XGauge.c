@@ -113,6 +113,7 @@ gslc_tsElemRef* gslc_ElemXGaugeCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t n
   pXData->nIndicLen       = 10;     // Dummy default to be overridden
   pXData->nIndicTip       = 3;      // Dummy default to be overridden
   pXData->bIndicFill      = false;
+  pXData->sIndic.bValid   = false;
   sElem.pXData            = (void*)(pXData);
   sElem.pfuncXDraw        = &gslc_ElemXGaugeDraw;
   sElem.pfuncXTouch       = NULL;           // No need to track touches
@@ -468,16 +469,19 @@ bool gslc_ElemXGaugeDrawProgressBar(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gs
 }
 
 #if (GSLC_FEATURE_XGAUGE_RADIAL)
-void gslc_ElemXGaugeDrawRadialHelp(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nArrowLen,uint16_t nArrowSz,int16_t n64Ang,bool bFill,gslc_tsColor colFrame)
+void gslc_ElemXGaugeDrawRadialHelp(gslc_tsGui* pGui,gslc_tsPolarIndic* pIndic,int16_t nX,int16_t nY,uint16_t nArrowLen,uint16_t nArrowSz,int16_t n64Ang,bool bFill,gslc_tsColor colFrame)
 {
-  int16_t   nTipX,nTipY;
-  int16_t   nBaseX1,nBaseY1,nBaseX2,nBaseY2;
-  int16_t   nTipBaseX,nTipBaseY;
-
-  gslc_PolarToXY(nArrowLen,n64Ang,&nTipX,&nTipY);
-  gslc_PolarToXY(nArrowLen-nArrowSz,n64Ang,&nTipBaseX,&nTipBaseY);
-  gslc_PolarToXY(nArrowSz,n64Ang-90*64,&nBaseX1,&nBaseY1);
-  gslc_PolarToXY(nArrowSz,n64Ang+90*64,&nBaseX2,&nBaseY2);
+  // Fetch the indicator vertices (reused if unchanged since the last draw)
+  gslc_PolarIndicCalc(pIndic,nArrowLen,nArrowSz,n64Ang);
+
+  int16_t   nTipX     = pIndic->sTip.x;
+  int16_t   nTipY     = pIndic->sTip.y;
+  int16_t   nBaseX1   = pIndic->sBase1.x;
+  int16_t   nBaseY1   = pIndic->sBase1.y;
+  int16_t   nBaseX2   = pIndic->sBase2.x;
+  int16_t   nBaseY2   = pIndic->sBase2.y;
+  int16_t   nTipBaseX = pIndic->sTipBase.x;
+  int16_t   nTipBaseY = pIndic->sTipBase.y;
 
   if (!bFill) {
     // Framed
@@ -559,7 +563,7 @@ bool gslc_ElemXGaugeDrawRadial(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_te
 
   // Clear old
   if (bValLastValid) {
-    gslc_ElemXGaugeDrawRadialHelp(pGui,nElemMidX,nElemMidY,nArrowLen,nArrowSize,n64AngLast,bFill,pElem->colElemFill);
+    gslc_ElemXGaugeDrawRadialHelp(pGui,&(pGauge->sIndic),nElemMidX,nElemMidY,nArrowLen,nArrowSize,n64AngLast,bFill,pElem->colElemFill);
   }
 
   // Draw frame
@@ -572,7 +576,7 @@ bool gslc_ElemXGaugeDrawRadial(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_te
   }
 
   // Draw pointer
-  gslc_ElemXGaugeDrawRadialHelp(pGui,nElemMidX,nElemMidY,nArrowLen,nArrowSize,n64Ang,bFill,pGauge->colGauge);
+  gslc_ElemXGaugeDrawRadialHelp(pGui,&(pGauge->sIndic),nElemMidX,nElemMidY,nArrowLen,nArrowSize,n64Ang,bFill,pGauge->colGauge);
 
   return true;
 }
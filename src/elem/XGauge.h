@@ -91,6 +91,7 @@ typedef struct {
   uint16_t            nIndicLen;      ///< Indicator length
   uint16_t            nIndicTip;      ///< Size of tip at end of indicator
   bool                bIndicFill;     ///< Fill the indicator if true
+  gslc_tsPolarIndic   sIndic;         ///< Vertices of the last indicator drawn
 
 } gslc_tsXGauge;
 
@@ -306,6 +307,7 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
   sGauge##nElemId.nIndicLen = 10;                                 \
   sGauge##nElemId.nIndicTip = 3;                                  \
   sGauge##nElemId.bIndicFill = false;                             \
+  sGauge##nElemId.sIndic.bValid = false;                          \
   static const gslc_tsElem sElem##nElemId PROGMEM = {             \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
@@ -357,6 +359,7 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
   sGauge##nElemId.nIndicLen = 10;                                 \
   sGauge##nElemId.nIndicTip = 3;                                  \
   sGauge##nElemId.bIndicFill = false;                             \
+  sGauge##nElemId.sIndic.bValid = false;                          \
   static const gslc_tsElem sElem##nElemId = {                     \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
@@ -120,6 +120,7 @@ gslc_tsElemRef* gslc_ElemXGlowballCreate(gslc_tsGui* pGui, int16_t nElemId, int1
   pXData->nMidY = nMidY;
   pXData->colBg = GSLC_COL_BLACK;
   pXData->nValLast = 0;
+  gslc_PolarCacheReset(&(pXData->sPolarCache));
 
 
   sElem.pXData            = (void*)(pXData);
@@ -155,17 +156,20 @@ void drawXGlowballArc(gslc_tsGui* pGui, gslc_tsXGlowball* pGlowball, int16_t nMi
   nSegStart = nAngStart * pGlowball->nQuality / 360;
   nSegEnd = nAngEnd * pGlowball->nQuality / 360;
 
+  // Ensure any cached vertices correspond to this quality
+  gslc_PolarCacheSetStep(&(pGlowball->sPolarCache), nStep64);
+
   for (int16_t nSegInd = nSegStart; nSegInd < nSegEnd; nSegInd++) {
     nAng64 = nSegInd * nStep64;
     nAng64 = nAng64 % (360 * 64);
 
-    gslc_PolarToXY(nRad1, nAng64, &nX, &nY);
+    gslc_PolarCacheToXY(&(pGlowball->sPolarCache), nRad1, nAng64, &nX, &nY);
     anPts[0] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad2, nAng64, &nX, &nY);
+    gslc_PolarCacheToXY(&(pGlowball->sPolarCache), nRad2, nAng64, &nX, &nY);
     anPts[1] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad2, nAng64 + nStep64, &nX, &nY);
+    gslc_PolarCacheToXY(&(pGlowball->sPolarCache), nRad2, nAng64 + nStep64, &nX, &nY);
     anPts[2] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad1, nAng64 + nStep64, &nX, &nY);
+    gslc_PolarCacheToXY(&(pGlowball->sPolarCache), nRad1, nAng64 + nStep64, &nX, &nY);
     anPts[3] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
 
     gslc_DrawFillQuad(pGui, anPts, cArc);
@@ -261,6 +265,9 @@ void gslc_ElemXGlowballSetQuality(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, ui
   // Update the rendering quality setting
   pGlowball->nQuality = nQuality;
 
+  // Segment vertices need to be recalculated
+  gslc_PolarCacheReset(&(pGlowball->sPolarCache));
+
   // Mark for redraw
   // - Force full redraw
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
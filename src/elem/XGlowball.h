@@ -75,6 +75,7 @@ typedef struct {
   // State
   int16_t               nVal;           ///< Current value
   int16_t               nValLast;       ///< Previous value
+  gslc_tsPolarCache     sPolarCache;    ///< Cached segment vertices
   // Callbacks
 } gslc_tsXGlowball;
 
@@ -98,6 +98,12 @@ gslc_tsElemRef* gslc_ElemXGraphCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t n
   pXData->colGraph        = colGraph;
   pXData->eStyle          = GSLCX_GRAPH_STYLE_DOT;
 
+  uint8_t nSeries;
+  for (nSeries=0;nSeries<XGRAPH_SERIES_MAX-1;nSeries++) {
+    pXData->apSeriesBuf[nSeries] = NULL;
+    pXData->acolSeries[nSeries]  = colGraph;
+  }
+
   // Define the visible region of the window
   // - The range in value can be overridden by the user
   pXData->nWndHeight = rElem.h - (2*pXData->nMargin);
@@ -109,6 +115,9 @@ gslc_tsElemRef* gslc_ElemXGraphCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t n
   pXData->nPlotValMin   = 0;
   pXData->nPlotValMax   = pXData->nWndHeight;
   pXData->nPlotIndMax   = pXData->nWndWidth;
+  pXData->nPlotDecim    = 1;
+  pXData->nColPos       = 0;
+  pXData->nRedrawScroll = XGRAPH_REDRAW_ALL;
 
 
   // Clear the buffer
@@ -191,6 +200,64 @@ void gslc_ElemXGraphSetRange(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,
 
 }
 
+void gslc_ElemXGraphSetRangeX(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint16_t nPlotIndMax)
+{
+  gslc_tsXGraph*    pBox;
+  gslc_tsElem*      pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  pBox = (gslc_tsXGraph*)(pElem->pXData);
+
+  // Determine the number of data points per pixel column
+  // - Round up so that all of the requested points fit
+  uint16_t nWndWidth = (pBox->nWndWidth > 0)? pBox->nWndWidth : 1;
+  uint16_t nPlotDecim = (nPlotIndMax + nWndWidth - 1) / nWndWidth;
+  if (nPlotDecim < 1) { nPlotDecim = 1; }
+
+  // The pixel columns start at the latest data point
+  pBox->nPlotDecim  = nPlotDecim;
+  pBox->nPlotIndMax = pBox->nWndWidth * nPlotDecim;
+  pBox->nColPos     = (pBox->nBufCnt + nPlotDecim - 1) % nPlotDecim;
+
+  // Update the scrollbar range
+  if (pBox->nPlotIndMax >= pBox->nBufMax) {
+    pBox->bScrollEn   = false;
+    pBox->nScrollPos  = 0;
+  } else {
+    pBox->bScrollEn   = true;
+    pBox->nScrollPos  = pBox->nBufMax - pBox->nPlotIndMax;
+  }
+
+  // Set the redraw flag
+  // - As we are changing the scale, force a full redraw
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+}
+
+bool gslc_ElemXGraphSetSeries(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t nSeries,
+        int16_t* pBuf,gslc_tsColor colSeries)
+{
+  if (pElemRef == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXGraphSetSeries";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  gslc_tsXGraph*    pBox;
+  gslc_tsElem*      pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  pBox = (gslc_tsXGraph*)(pElem->pXData);
+
+  if ((nSeries < 1) || (nSeries >= XGRAPH_SERIES_MAX)) {
+    GSLC_DEBUG2_PRINT("ERROR: ElemXGraphSetSeries() series [%u] out of range\n",nSeries);
+    return false;
+  }
+
+  pBox->apSeriesBuf[nSeries-1] = pBuf;
+  pBox->acolSeries[nSeries-1]  = colSeries;
+  if (pBuf != NULL) {
+    memset(pBuf,0,pBox->nBufMax*sizeof(int16_t));
+  }
+
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+  return true;
+}
+
 
 void gslc_ElemXGraphScrollSet(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t nScrollPos,uint8_t nScrollMax)
 {
@@ -213,6 +280,8 @@ void gslc_ElemXGraphScrollSet(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t
   // - Only need incremental redraw
   // - Only redraw if changed actual scroll row
   if (pBox->nScrollPos != nScrollPosOld) {
+    // Ensure all columns get redrawn
+    pBox->nRedrawScroll = XGRAPH_REDRAW_ALL;
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
   }
 }
@@ -222,18 +291,42 @@ void gslc_ElemXGraphScrollSet(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t
 // - Advance the write ptr, wrap if needed
 // - If encroach upon buffer read ptr, then drop the oldest line from the buffer
 void gslc_ElemXGraphAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nVal)
+{
+  gslc_ElemXGraphAddMulti(pGui,pElemRef,&nVal,1);
+}
+
+void gslc_ElemXGraphAddMulti(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,const int16_t* anVal,uint8_t nNumVal)
 {
   gslc_tsXGraph*  pBox = NULL;
   gslc_tsElem*    pElem = gslc_GetElemFromRef(pGui,pElemRef);
   pBox = (gslc_tsXGraph*)(pElem->pXData);
 
   // Add the data value
-  pBox->pBuf[pBox->nBufCnt] = nVal;
+  pBox->pBuf[pBox->nBufCnt] = (nNumVal > 0)? anVal[0] : 0;
+  uint8_t nSeries;
+  for (nSeries=1;nSeries<XGRAPH_SERIES_MAX;nSeries++) {
+    if (pBox->apSeriesBuf[nSeries-1] != NULL) {
+      pBox->apSeriesBuf[nSeries-1][pBox->nBufCnt] = (nSeries < nNumVal)? anVal[nSeries] : 0;
+    }
+  }
 
   // Advance the pointer
   // - Wrap the pointers around end of buffer
   pBox->nBufCnt = (pBox->nBufCnt+1) % pBox->nBufMax;
 
+  // Advance the position within the current pixel column
+  // - If the last visible data point starts a new column then the
+  //   plot scrolls by one column on the next redraw. Otherwise only
+  //   the latest column changes.
+  uint16_t nScrollBack = 0;
+  if (pBox->bScrollEn) {
+    nScrollBack = pBox->nBufMax - pBox->nPlotIndMax - pBox->nScrollPos;
+  }
+  pBox->nColPos = (pBox->nColPos+1) % pBox->nPlotDecim;
+  if ((pBox->nColPos == (nScrollBack % pBox->nPlotDecim)) && (pBox->nRedrawScroll != XGRAPH_REDRAW_ALL)) {
+    pBox->nRedrawScroll++;
+  }
+
   // Set the redraw flag
   // - Only need incremental redraw
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
@@ -250,13 +343,22 @@ void gslc_ElemXGraphReset(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef) {
   pBox->nPlotIndStart   = 0;
 
   // Default scale is
-  // - Each data point (buffer row) gets 1 pixel in X direction
   // - Data value is directly mapped to height in Y direction
+  // - The number of data points per pixel column in X direction
+  //   is retained from gslc_ElemXGraphSetRangeX()
   pBox->nPlotValMin   = 0;
   pBox->nPlotValMax   = pBox->nWndHeight;
-  pBox->nPlotIndMax   = pBox->nWndWidth;
+  pBox->nPlotIndMax   = pBox->nWndWidth * pBox->nPlotDecim;
+  pBox->nColPos       = pBox->nPlotDecim - 1;
+  pBox->nRedrawScroll = XGRAPH_REDRAW_ALL;
 
   memset(pBox->pBuf,0,pBox->nBufMax*sizeof(int16_t));
+  uint8_t nSeries;
+  for (nSeries=0;nSeries<XGRAPH_SERIES_MAX-1;nSeries++) {
+    if (pBox->apSeriesBuf[nSeries] != NULL) {
+      memset(pBox->apSeriesBuf[nSeries],0,pBox->nBufMax*sizeof(int16_t));
+    }
+  }
 
   // Set the redraw flag
   // - As we are clearing the buffer, force a full redraw
@@ -265,6 +367,91 @@ void gslc_ElemXGraphReset(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef) {
 }
 
 
+// Map a data value to its Y coordinate in the plot
+uint16_t gslc_ElemXGraphGetPixY(gslc_tsXGraph* pBox,gslc_tsElem* pElem,int16_t nDataVal)
+{
+  uint16_t nPixYBase,nPixYOffset;
+
+  // Clip the value to the plot range
+  if      (nDataVal > pBox->nPlotValMax) { nDataVal = pBox->nPlotValMax; }
+  else if (nDataVal < pBox->nPlotValMin) { nDataVal = pBox->nPlotValMin; }
+
+  // TODO: Scale data value
+
+  nPixYBase   = pElem->rElem.y - pBox->nMargin + pElem->rElem.h-1;
+
+  // Calculate Y value
+  nPixYOffset = (nDataVal >= 0)? nDataVal : 0;
+  // Clip plot Y value
+  if (nPixYOffset > pBox->nWndHeight) { nPixYOffset = pBox->nWndHeight; }
+
+  // Calculate final Y coordinate
+  return nPixYBase - nPixYOffset;
+}
+
+// Draw a single pixel column of the plot
+// - The column covers the data points from nBackStart to nBackEnd,
+//   counted backwards from the last visible data point at nBufIndEnd
+// - If bPrevEn, the line style connects to the data point just
+//   before the column (which belongs to the column to the left)
+// - Everything drawn stays within the column, so that a column
+//   can be redrawn without affecting its neighbors
+void gslc_ElemXGraphDrawCol(gslc_tsGui* pGui,gslc_tsElem* pElem,uint16_t nCol,
+  uint16_t nBufIndEnd,uint16_t nBackStart,uint16_t nBackEnd,bool bPrevEn)
+{
+  gslc_tsXGraph*  pBox = (gslc_tsXGraph*)(pElem->pXData);
+  uint16_t        nPixX = pElem->rElem.x + pBox->nMargin + nCol;
+  uint16_t        nPixYBase = pElem->rElem.y - pBox->nMargin + pElem->rElem.h-1;
+  uint8_t         nSeries;
+
+  for (nSeries=0;nSeries<XGRAPH_SERIES_MAX;nSeries++) {
+    int16_t*      pBuf = (nSeries == 0)? pBox->pBuf : pBox->apSeriesBuf[nSeries-1];
+    gslc_tsColor  colGraph = (nSeries == 0)? pBox->colGraph : pBox->acolSeries[nSeries-1];
+    if (pBuf == NULL) {
+      continue;
+    }
+
+    // Find the extent of the data points in the column
+    // - Note that a smaller Y coordinate is a larger value
+    // NOTE: At the start of buffer fill when we have
+    // only written a few values, we will continue to read
+    // values out of the buffer so we are dependent upon
+    // the reset to initialize the buffer to zero.
+    uint16_t  nPixYTop = 0xFFFF;
+    uint16_t  nPixYBot = 0;
+    uint16_t  nBack;
+    for (nBack=nBackStart;nBack<=nBackEnd;nBack++) {
+      uint16_t nBufInd = (uint16_t)(((uint32_t)nBufIndEnd + pBox->nBufMax - (nBack % pBox->nBufMax)) % pBox->nBufMax);
+      uint16_t nPixY = gslc_ElemXGraphGetPixY(pBox,pElem,pBuf[nBufInd]);
+      if (nPixY < nPixYTop) { nPixYTop = nPixY; }
+      if (nPixY > nPixYBot) { nPixYBot = nPixY; }
+    }
+
+    // TODO: Consider supporting various color mapping modes
+    //colGraph = gslc_ColorBlend2(GSLC_COL_BLACK,GSLC_COL_WHITE,500,nDataVal*500/200);
+
+    // Render the datapoints
+    if (pBox->eStyle == GSLCX_GRAPH_STYLE_LINE) {
+      // Extend the span towards the previous data point so
+      // that the columns join up, stopping just short of
+      // the point itself as it is drawn in its own column
+      if (bPrevEn) {
+        uint16_t nBufInd = (uint16_t)(((uint32_t)nBufIndEnd + pBox->nBufMax - ((nBackEnd+1) % pBox->nBufMax)) % pBox->nBufMax);
+        uint16_t nPixYPrev = gslc_ElemXGraphGetPixY(pBox,pElem,pBuf[nBufInd]);
+        if      (nPixYPrev < nPixYTop) { nPixYTop = nPixYPrev+1; }
+        else if (nPixYPrev > nPixYBot) { nPixYBot = nPixYPrev-1; }
+      }
+    }
+    if (pBox->eStyle == GSLCX_GRAPH_STYLE_FILL) {
+      gslc_DrawLine(pGui,nPixX,nPixYBase,nPixX,nPixYTop,colGraph);
+    } else if (nPixYTop == nPixYBot) {
+      gslc_DrawSetPixel(pGui,nPixX,nPixYTop,colGraph);
+    } else {
+      gslc_DrawLine(pGui,nPixX,nPixYTop,nPixX,nPixYBot,colGraph);
+    }
+  } // nSeries
+}
+
 bool gslc_ElemXGraphDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
 {
   if ((pvGui == NULL) || (pvElemRef == NULL)) {
@@ -295,22 +482,10 @@ bool gslc_ElemXGraphDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
     }
   }
 
-  // Clear the background (inset from frame)
-  // TODO: Support incremental redraw in which case we don't
-  //       erase the inner region. Instead we would just erase
-  //       old values and redraw new ones
-  gslc_tsRect rInner = gslc_ExpandRect(pElem->rElem,-1,-1);
-  gslc_DrawFillRect(pGui,rInner,(bGlow)?pElem->colElemFillGlow:pElem->colElemFill);
-
-  int16_t           nDataVal;
-  uint16_t          nCurX = 0;
-  uint16_t          nPixX,nPixY,nPixYBase,nPixYOffset;
-  gslc_tsColor      colGraph;
-
+  gslc_tsRect       rInner = gslc_ExpandRect(pElem->rElem,-1,-1);
+  gslc_tsColor      colFill = (bGlow)?pElem->colElemFillGlow:pElem->colElemFill;
   uint16_t          nScrollMax;
-
-  // Initialize color state
-  colGraph  = pBox->colGraph;
+  uint16_t          nScrollBack = 0;
 
   // Calculate the current window position based on
   // the current buffer write pointer and scroll
@@ -320,67 +495,80 @@ bool gslc_ElemXGraphDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
   pBox->nPlotIndStart -= pBox->nPlotIndMax;
   // Only correct for scrollbar position if enabled
   if (pBox->bScrollEn) {
-    pBox->nPlotIndStart -= (nScrollMax - pBox->nScrollPos);
+    nScrollBack = nScrollMax - pBox->nScrollPos;
+    pBox->nPlotIndStart -= nScrollBack;
   }
   pBox->nPlotIndStart = pBox->nBufMax ? (pBox->nPlotIndStart % pBox->nBufMax) : 0;
-  
-  uint16_t nPlotInd = 0;
-  uint16_t nIndMax = 0;
-  nIndMax = (pBox->nBufMax < pBox->nPlotIndMax)? pBox->nBufMax : pBox->nPlotIndMax;
-  for (nPlotInd=0;nPlotInd<nIndMax;nPlotInd++) {
-
-    // Calculate row offset after accounting for buffer wrap
-    // and current window starting offset
-    uint16_t nBufInd = pBox->nPlotIndStart + nPlotInd;
-    nBufInd = nBufInd % pBox->nBufMax;
-
-    // NOTE: At the start of buffer fill when we have
-    // only written a few values, we will continue to read
-    // values out of the buffer so we are dependent upon
-    // the reset to initialize the buffer to zero.
-
-    nDataVal = pBox->pBuf[nBufInd];
 
-    // Clip the value to the plot range
-    if      (nDataVal > pBox->nPlotValMax) { nDataVal = pBox->nPlotValMax; }
-    else if (nDataVal < pBox->nPlotValMin) { nDataVal = pBox->nPlotValMin; }
+  // Locate the last visible data point and its position
+  // within the rightmost pixel column
+  uint16_t nBufIndEnd = pBox->nBufMax ? (uint16_t)(((uint32_t)pBox->nBufCnt + 2*pBox->nBufMax - 1 - nScrollBack) % pBox->nBufMax) : 0;
+  uint16_t nColPosEnd = (pBox->nColPos + pBox->nPlotDecim - (nScrollBack % pBox->nPlotDecim)) % pBox->nPlotDecim;
+
+  uint16_t nIndMax = (pBox->nBufMax < pBox->nPlotIndMax)? pBox->nBufMax : pBox->nPlotIndMax;
+  uint16_t nColMax = nIndMax / pBox->nPlotDecim;
+  uint16_t nCol = 0;
+
+  // Determine which columns need to be redrawn
+  // - If the plot has only scrolled since the last redraw, shift the
+  //   existing columns on the display and only draw the new ones
+  // - The column that was previously the latest is also redrawn
+  //   as it may have gained data points since
+  // - Fall back to redrawing all columns if the driver can't copy
+  bool bRedrawAll = (eRedraw == GSLC_REDRAW_FULL) || (pBox->nRedrawScroll == XGRAPH_REDRAW_ALL) ||
+    (pBox->nBufMax < pBox->nPlotIndMax) || (pBox->nRedrawScroll >= (int16_t)nColMax);
+  uint16_t nColStart = 0;
+  if (!bRedrawAll) {
+    if (pBox->nRedrawScroll > 0) {
+      gslc_tsRect rPlot = { (int16_t)(pElem->rElem.x + pBox->nMargin), rInner.y, nColMax, rInner.h };
+      bRedrawAll = true;
+      if ((gslc_ClipRect(&rInner,&rPlot)) && ((int16_t)rPlot.w > pBox->nRedrawScroll)) {
+        gslc_tsRect rSrc = { (int16_t)(rPlot.x + pBox->nRedrawScroll), rPlot.y, (uint16_t)(rPlot.w - pBox->nRedrawScroll), rPlot.h };
+        bRedrawAll = !gslc_DrawCopyRect(pGui,rSrc,rPlot.x,rPlot.y);
+      }
+    }
+    nColStart = nColMax - 1 - pBox->nRedrawScroll;
+  }
+  // In line style the leftmost column may have lost the
+  // connection to the data point before it
+  bool bRedrawFirst = (!bRedrawAll) && (pBox->nRedrawScroll > 0) && (pBox->eStyle == GSLCX_GRAPH_STYLE_LINE);
 
-    // TODO: Make nCurX a scaled version of nPlotInd
-    // - Support different modes for mapping multiple data points
-    //   a single X coordinate and mapping a single data point
-    //   to multiple X coordinates
-    // - For now, just have a 1:1 correspondence between data
-    //   points and the X coordinate
-    nCurX = nPlotInd;
+  // Clear the background (inset from frame)
+  if (bRedrawAll) {
+    gslc_DrawFillRect(pGui,rInner,colFill);
+    nColStart = 0;
+  }
 
-    // TODO: Scale data value
+  for (nCol=0;nCol<nColMax;nCol++) {
 
-    // TODO: Consider supporting various color mapping modes
-    //colGraph = gslc_ColorBlend2(GSLC_COL_BLACK,GSLC_COL_WHITE,500,nDataVal*500/200);
-
-    // Determine the drawing coordinates
-    nPixX       = pElem->rElem.x + pBox->nMargin + nCurX;
-    nPixYBase   = pElem->rElem.y - pBox->nMargin + pElem->rElem.h-1;
+    if ((nCol < nColStart) && !((nCol == 0) && (bRedrawFirst))) {
+      continue;
+    }
 
-    // Calculate Y value
-    nPixYOffset = (nDataVal >= 0)? nDataVal : 0;
-    // Clip plot Y value
-    if (nPixYOffset > pBox->nWndHeight) { nPixYOffset = pBox->nWndHeight; }
+    // Clear the column if it isn't covered by the full clear
+    if (!bRedrawAll) {
+      gslc_tsRect rCol = { (int16_t)(pElem->rElem.x + pBox->nMargin + nCol), rInner.y, 1, rInner.h };
+      if (gslc_ClipRect(&rInner,&rCol)) {
+        gslc_DrawFillRect(pGui,rCol,colFill);
+      }
+    }
 
-    // Calculate final Y coordinate
-    nPixY       = nPixYBase - nPixYOffset;
+    // Calculate the range of data points in the column, counted
+    // backwards from the last visible data point
+    // - The rightmost column holds the data points up to the last
+    //   visible one, and all others hold nPlotDecim data points
+    uint16_t nColRight = nColMax - 1 - nCol;
+    uint16_t nBackStart = (nColRight == 0)? 0 : nColPosEnd + 1 + (nColRight-1)*pBox->nPlotDecim;
+    uint16_t nBackEnd = nColPosEnd + nColRight*pBox->nPlotDecim;
 
-    // Render the datapoints
-    if (pBox->eStyle == GSLCX_GRAPH_STYLE_DOT) {
-      gslc_DrawSetPixel(pGui,nPixX,nPixY,colGraph);
-    } else if (pBox->eStyle == GSLCX_GRAPH_STYLE_LINE) {
-    } else if (pBox->eStyle == GSLCX_GRAPH_STYLE_FILL) {
-      gslc_DrawLine(pGui,nPixX,nPixYBase,nPixX,nPixY,colGraph);
-    }
+    // Only connect to the previous data point if it is still in the buffer
+    bool bPrevEn = (nCol > 0) || ((uint32_t)nScrollBack + nBackEnd + 1 < pBox->nBufMax);
 
+    gslc_ElemXGraphDrawCol(pGui,pElem,nCol,nBufIndEnd,nBackStart,nBackEnd,bPrevEn);
   }
 
   // Clear the redraw flag
+  pBox->nRedrawScroll = 0;
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
 
   // Mark page as needing flip
@@ -57,6 +57,12 @@ typedef enum {
   GSLCX_GRAPH_STYLE_FILL,       ///< Filled
 } gslc_teXGraphStyle;
 
+/// Maximum number of data series in a graph (including the primary series)
+#define XGRAPH_SERIES_MAX   4
+
+/// Redraw all columns instead of scrolling the existing plot
+#define XGRAPH_REDRAW_ALL   -1
+
 // Extended element data structures
 // - These data structures are maintained in the gslc_tsElem
 //   structure via the pXData pointer
@@ -78,10 +84,19 @@ typedef struct {
   int16_t                   nPlotValMax;    ///< Visible window maximum value
   int16_t                   nPlotValMin;    ///< Visible window minimum value
   uint16_t                  nPlotIndMax;    ///< Number of data points to show in window
+  uint16_t                  nPlotDecim;     ///< Number of data points per pixel column
+
+  // Additional series
+  int16_t*                  apSeriesBuf[XGRAPH_SERIES_MAX-1]; ///< Data buffers for additional series (or NULL)
+  gslc_tsColor              acolSeries[XGRAPH_SERIES_MAX-1];  ///< Colors of additional series
 
   // Current status
   uint16_t                  nBufCnt;        ///< Number of points in buffer
   uint16_t                  nPlotIndStart;  ///< First row of current window
+  uint16_t                  nColPos;        ///< Position of the latest data point within its pixel column
+
+  // Redraw
+  int16_t                   nRedrawScroll;  ///< Columns scrolled since last redraw (or XGRAPH_REDRAW_ALL)
 
 } gslc_tsXGraph;
 
@@ -133,6 +148,39 @@ void gslc_ElemXGraphSetStyle(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,
 void gslc_ElemXGraphSetRange(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,
         int16_t nYMin,int16_t nYMax);
 
+///
+/// Set the number of data points shown across the graph
+/// - If this exceeds the width of the graph then each pixel column
+///   represents several data points, drawn as the span between
+///   their minimum and maximum values
+/// - The buffer should hold at least this many data points
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  nPlotIndMax: Number of data points to show (0 for one per pixel column)
+///
+/// \return none
+///
+void gslc_ElemXGraphSetRangeX(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint16_t nPlotIndMax);
+
+///
+/// Assign a data buffer to an additional series in the graph
+/// - The buffer is written in step with the primary series
+///   by gslc_ElemXGraphAddMulti()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  nSeries:     Series index (1..XGRAPH_SERIES_MAX-1)
+/// \param[in]  pBuf:        Ptr to data buffer (already allocated) with
+///                          the same size as the primary buffer, or NULL
+///                          to remove the series
+/// \param[in]  colSeries:   Color of the series
+///
+/// \return true if success, false otherwise
+///
+bool gslc_ElemXGraphSetSeries(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t nSeries,
+        int16_t* pBuf,gslc_tsColor colSeries);
+
 ///
 /// Draw a Graph element on the screen
 /// - Called from gslc_ElemDraw()
@@ -155,6 +203,18 @@ bool gslc_ElemXGraphDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw);
 ///
 void gslc_ElemXGraphAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nVal);
 
+/// Add a value to each series of the graph at the latest position
+/// - Series without a corresponding value are set to zero
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  anVal:       Array of data values, indexed by series
+/// \param[in]  nNumVal:     Number of values in anVal
+///
+/// \return none
+///
+void gslc_ElemXGraphAddMulti(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,const int16_t* anVal,uint8_t nNumVal);
+
 /// Reset the graphs values.
 ///
 /// \param[in]  pGui:        Pointer to GUI
@@ -1412,7 +1412,7 @@ void gslc_XKeyPadDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,gslc_tsXKeyPa
     nTxtLen = nDispPosCursor;
     gslc_StrCopy(pStrBuf,acDispStr,nTxtLen+1);
   
-    gslc_DrvGetTxtSize(pGui,pVirtualElem->pTxtFont,pStrBuf,pVirtualElem->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
+    gslc_TxtCacheGetSize(pGui,pVirtualElem->pTxtFont,pStrBuf,pVirtualElem->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
     nTxtPosX += nMarginX; // Account for margin once at start
   
     pVirtualElem->rElem = (gslc_tsRect){rElem.x+1+nTxtPosX,rElem.y+1,nTxtSzW,rElem.h-2};
@@ -1424,7 +1424,7 @@ void gslc_XKeyPadDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,gslc_tsXKeyPa
     nTxtLen = 1;
     gslc_StrCopy(pStrBuf,acDispStr+nDispPosCursor,nTxtLen+1);
   
-    gslc_DrvGetTxtSize(pGui,pVirtualElem->pTxtFont,pStrBuf,pVirtualElem->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
+    gslc_TxtCacheGetSize(pGui,pVirtualElem->pTxtFont,pStrBuf,pVirtualElem->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
   
     pVirtualElem->rElem = (gslc_tsRect){rElem.x+1+nTxtPosX,rElem.y+1,nTxtSzW,rElem.h-2};
     pVirtualElem->colElemText = cColFrame;
@@ -1435,7 +1435,7 @@ void gslc_XKeyPadDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,gslc_tsXKeyPa
     nTxtLen = strlen(acDispStr)-nDispPosCursor;
     gslc_StrCopy(pStrBuf,acDispStr+nDispPosCursor+1,nTxtLen+1);
   
-    gslc_DrvGetTxtSize(pGui,pVirtualElem->pTxtFont,pStrBuf,pVirtualElem->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
+    gslc_TxtCacheGetSize(pGui,pVirtualElem->pTxtFont,pStrBuf,pVirtualElem->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
   
     pVirtualElem->rElem = (gslc_tsRect){rElem.x+1+nTxtPosX,rElem.y+1,nTxtSzW,rElem.h-2};
     pVirtualElem->colElemText = cColTxt;
@@ -103,12 +103,59 @@ void debug_ElemXListboxDump(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef)
 }
 */
 
+// Rebuild the index of item positions from the item buffer
+// - The index is left invalid if it is too small for the list
+bool gslc_ElemXListboxIndexBuild(gslc_tsXListbox* pListbox)
+{
+  uint16_t   nBufPos;
+  int16_t    nItemInd = 0;
+
+  pListbox->bItemOfsValid = false;
+  if ((pListbox->pnItemOfs == NULL) || (pListbox->nItemCnt > (int16_t)pListbox->nItemOfsMax)) {
+    return false;
+  }
+  if (pListbox->nItemCnt > 0) {
+    pListbox->pnItemOfs[0] = 0;
+  }
+  for (nBufPos = 0; nBufPos < pListbox->nBufItemsPos; nBufPos++) {
+    if (pListbox->pBufItems[nBufPos] == 0) {
+      nItemInd++;
+      if (nItemInd >= pListbox->nItemCnt) {
+        break;
+      }
+      pListbox->pnItemOfs[nItemInd] = nBufPos + 1;
+    }
+  }
+  pListbox->bItemOfsValid = true;
+  return true;
+}
+
+// Locate an item within the item buffer
+// - Requesting the item following the last item (nItemCnt)
+//   returns the end of the buffer contents
 char* gslc_ElemXListboxGetItemAddr(gslc_tsXListbox* pListbox, int16_t nItemCurSel)
 {
   char*      pBuf = NULL;
   uint16_t   nBufPos = 0;
   int16_t    nItemInd = 0;
   bool       bFound = false;
+
+  if ((nItemCurSel < 0) || (nItemCurSel > pListbox->nItemCnt)) {
+    return NULL;
+  }
+  if (nItemCurSel == pListbox->nItemCnt) {
+    return (char*)&(pListbox->pBufItems[pListbox->nBufItemsPos]);
+  }
+
+  // Use the index if available
+  if ((!pListbox->bItemOfsValid) && (pListbox->pnItemOfs != NULL)) {
+    gslc_ElemXListboxIndexBuild(pListbox);
+  }
+  if (pListbox->bItemOfsValid) {
+    return (char*)&(pListbox->pBufItems[pListbox->pnItemOfs[nItemCurSel]]);
+  }
+
+  // Otherwise search the buffer
   while (1) {
     if (nItemInd == nItemCurSel) {
       bFound = true;
@@ -240,6 +287,7 @@ void gslc_ElemXListboxReset(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef)
 
   pListbox->nBufItemsPos = 0;
   pListbox->nItemCnt = 0;
+  pListbox->bItemOfsValid = (pListbox->pnItemOfs != NULL);
   pListbox->nItemCurSel = XLISTBOX_SEL_NONE;
   pListbox->bNeedRecalc = true;
   // Mark as needing full redraw
@@ -257,6 +305,11 @@ bool gslc_ElemXListboxAddItem(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, const
   uint16_t    nBufItemsPos = pListbox->nBufItemsPos;
   uint16_t    nBufItemsMax = pListbox->nBufItemsMax;
 
+  if (pListbox->pfuncXGetItem != NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: ElemXListboxAddItem() not supported in virtual mode\n", "");
+    return false;
+  }
+
   nStrItemLen = strlen(pStrItem);
 
   if (nStrItemLen == 0) {
@@ -281,6 +334,15 @@ bool gslc_ElemXListboxAddItem(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, const
   gslc_StrCopy(pBuf, pStrItem, nStrItemLen+1);
   pListbox->nBufItemsPos += (nStrItemLen+1); // +1 for terminator
 
+  // Update the index
+  if (pListbox->bItemOfsValid) {
+    if (pListbox->nItemCnt < (int16_t)pListbox->nItemOfsMax) {
+      pListbox->pnItemOfs[pListbox->nItemCnt] = nBufItemsPos;
+    } else {
+      pListbox->bItemOfsValid = false;
+    }
+  }
+
   pListbox->nItemCnt++;
 
   //GSLC_DEBUG2_PRINT("Xlistbox:Add\n", "");
@@ -305,6 +367,10 @@ bool gslc_ElemXListboxInsertItemAt(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, u
   uint16_t    nBufItemsPos = pListbox->nBufItemsPos;
   uint16_t    nBufItemsMax = pListbox->nBufItemsMax;
 
+  if (pListbox->pfuncXGetItem != NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: ElemXListboxInsertItemAt() not supported in virtual mode\n", "");
+    return false;
+  }
   if ((int16_t)nInsertPos > pListbox->nItemCnt) {
     GSLC_DEBUG2_PRINT("ERROR: ElemXListboxInsertItemAt() Current Count: %d Invalid Position %d\n", 
       pListbox->nItemCnt,nInsertPos);
@@ -338,20 +404,24 @@ bool gslc_ElemXListboxInsertItemAt(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, u
   }
  
   // Make a hole in the buffer to slot in the new item
-  char* pSrc = (char*)pListbox->pBufItems+nBufItemsPos-1;
-  char* pDest = pSrc+nStrItemLen+1;  
-  uint16_t nMoveLen = (int16_t)(pSrc - pBuf)+1;
-  uint8_t ch;
-  for (uint16_t nInd = 0; nInd < nMoveLen; nInd++) {
-    ch = *pSrc;
-    *pDest = ch;
-    pDest--;
-    pSrc--;
-  }
-  
+  char* pEndOfBuf = (char*)(pListbox->pBufItems+nBufItemsPos);
+  memmove(pBuf+nStrItemLen+1, pBuf, (size_t)(pEndOfBuf-pBuf));
+
   // Now slot in the new item
   memcpy(pBuf, pStrItem, nStrItemLen+1);
 
+  // Update the index: the following items move down in the buffer
+  if (pListbox->bItemOfsValid) {
+    if (pListbox->nItemCnt < (int16_t)pListbox->nItemOfsMax) {
+      for (int16_t nInd = pListbox->nItemCnt; nInd > (int16_t)nInsertPos; nInd--) {
+        pListbox->pnItemOfs[nInd] = pListbox->pnItemOfs[nInd-1] + nStrItemLen+1;
+      }
+      pListbox->pnItemOfs[nInsertPos] = (uint16_t)(pBuf - (char*)pListbox->pBufItems);
+    } else {
+      pListbox->bItemOfsValid = false;
+    }
+  }
+
   // update our buffer information
   pListbox->nBufItemsPos += nStrItemLen+1;
   pListbox->nItemCnt++;
@@ -377,31 +447,37 @@ bool gslc_ElemXListboxDeleteItemAt(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, u
   char*       pBuf = NULL;
   uint16_t    nBufItemsPos = pListbox->nBufItemsPos;
 
+  if (pListbox->pfuncXGetItem != NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: ElemXListboxDeleteItemAt() not supported in virtual mode\n", "");
+    return false;
+  }
+
 //  GSLC_DEBUG2_PRINT("Xlistbox:DeleteAt: %d\n", nDeletePos);
 //  debug_ElemXListboxDump(pGui, pElemRef);
 
+  // Only existing items can be deleted
+  if ((int16_t)nDeletePos >= pListbox->nItemCnt) {
+    return false;
+  }
   pBuf = gslc_ElemXListboxGetItemAddr(pListbox, nDeletePos);
   // If position is incorrect, bail out...
   if (pBuf == NULL) {
     return false;
   }
   nStrItemLen = strlen(pBuf);
-  
+
   // Pull items after this delete position up to delete this item
   char* pSrc  = (char*)pBuf+nStrItemLen+1;
-  char* pDest = (char*)pBuf;
   char* pEndOfBuf = (char*)(pListbox->pBufItems+nBufItemsPos);
-  uint16_t nMoveLen = (int16_t)(pEndOfBuf-pSrc)+1;
-  uint8_t ch;
-  if (nMoveLen > 1) {
-    for (uint16_t nInd = 0; nInd < nMoveLen; nInd++) {
-      ch = *pSrc;
-      *pDest = ch;
-      pDest++;
-      pSrc++;
+  memmove(pBuf, pSrc, (size_t)(pEndOfBuf-pSrc));
+
+  // Update the index: the following items move up in the buffer
+  if (pListbox->bItemOfsValid) {
+    for (int16_t nInd = nDeletePos; nInd < pListbox->nItemCnt-1; nInd++) {
+      pListbox->pnItemOfs[nInd] = pListbox->pnItemOfs[nInd+1] - (nStrItemLen+1);
     }
   }
-  
+
   // update our buffer information
   pListbox->nBufItemsPos -= nStrItemLen+1;
   pListbox->nItemCnt--;
@@ -432,26 +508,27 @@ bool gslc_ElemXListboxGetItem(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, int16_
     // ERROR
     return false;
   }
-  uint16_t   nBufPos = 0;
-  int16_t   nItemInd = 0;
-  uint8_t*   pBuf = NULL;
-  bool       bFound = false;
-  while (1) {
-    if (nItemInd == nItemCurSel) {
-      bFound = true;
-      break;
+  // In virtual mode, fetch the item from the application
+  if (pListbox->pfuncXGetItem != NULL) {
+    pStrItem[0] = 0;
+    if ((nItemCurSel < 0) || (nItemCurSel >= pListbox->nItemCnt)) {
+      return false;
     }
-    if (nBufPos >= pListbox->nBufItemsMax) {
-      break;
+    if (!(*pListbox->pfuncXGetItem)((void*)(pGui), (void*)(pElemRef), nItemCurSel, pStrItem, nStrItemLen)) {
+      pStrItem[0] = 0;
+      return false;
     }
-    if (pListbox->pBufItems[nBufPos] == 0) {
-      nItemInd++;
-    }
-    nBufPos++;
+    // Ensure the string is terminated
+    pStrItem[nStrItemLen-1] = 0;
+    return true;
   }
-  if (bFound) {
-    pBuf = &(pListbox->pBufItems[nBufPos]);
-    gslc_StrCopy(pStrItem, (char*)pBuf, nStrItemLen);
+
+  char* pBuf = NULL;
+  if (nItemCurSel < pListbox->nItemCnt) {
+    pBuf = gslc_ElemXListboxGetItemAddr(pListbox, nItemCurSel);
+  }
+  if (pBuf != NULL) {
+    gslc_StrCopy(pStrItem, pBuf, nStrItemLen);
     return true;
   } else {
     // If no item was found, return an empty string (NULL)
@@ -461,6 +538,75 @@ bool gslc_ElemXListboxGetItem(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, int16_
 }
 
 
+bool gslc_ElemXListboxSetItemIndex(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, uint16_t* pnItemOfs,
+  uint16_t nItemOfsMax)
+{
+  gslc_tsXListbox* pListbox = (gslc_tsXListbox*)gslc_GetXDataFromRef(pGui, pElemRef, GSLC_TYPEX_LISTBOX, __LINE__);
+  if (!pListbox) return false;
+
+  pListbox->pnItemOfs = pnItemOfs;
+  pListbox->nItemOfsMax = (pnItemOfs != NULL) ? nItemOfsMax : 0;
+  pListbox->bItemOfsValid = false;
+  if (pnItemOfs == NULL) {
+    return true;
+  }
+  if (!gslc_ElemXListboxIndexBuild(pListbox)) {
+    GSLC_DEBUG2_PRINT("ERROR: ElemXListboxSetItemIndex() index too small (%u/%d)\n",
+      nItemOfsMax, pListbox->nItemCnt);
+    return false;
+  }
+  return true;
+}
+
+void gslc_ElemXListboxSetGetItemFunc(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, GSLC_CB_XLISTBOX_GETITEM funcCb,
+  int16_t nItemCnt)
+{
+  gslc_tsXListbox* pListbox = (gslc_tsXListbox*)gslc_GetXDataFromRef(pGui, pElemRef, GSLC_TYPEX_LISTBOX, __LINE__);
+  if (!pListbox) return;
+
+  // Switching between the virtual mode and the item buffer
+  // empties the list
+  gslc_ElemXListboxReset(pGui, pElemRef);
+  pListbox->pfuncXGetItem = funcCb;
+  if (funcCb != NULL) {
+    gslc_ElemXListboxSetItemCnt(pGui, pElemRef, nItemCnt);
+  }
+}
+
+bool gslc_ElemXListboxSetItemCnt(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, int16_t nItemCnt)
+{
+  gslc_tsXListbox* pListbox = (gslc_tsXListbox*)gslc_GetXDataFromRef(pGui, pElemRef, GSLC_TYPEX_LISTBOX, __LINE__);
+  if (!pListbox) return false;
+
+  if (pListbox->pfuncXGetItem == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: ElemXListboxSetItemCnt() only supported in virtual mode\n", "");
+    return false;
+  }
+  if (nItemCnt < 0) {
+    nItemCnt = 0;
+  }
+  pListbox->nItemCnt = nItemCnt;
+
+  // Clear any selection that is no longer in the list
+  if (pListbox->nItemCurSel >= nItemCnt) {
+    pListbox->nItemCurSel = XLISTBOX_SEL_NONE;
+  }
+  if (pListbox->nItemSavedSel >= nItemCnt) {
+    pListbox->nItemSavedSel = XLISTBOX_SEL_NONE;
+  }
+  if (pListbox->nItemTop >= nItemCnt) {
+    gslc_ElemXListboxSetScrollPos(pGui, pElemRef, pListbox->nItemTop);
+  }
+
+  // Indicate sizing may need update
+  pListbox->bNeedRecalc = true;
+
+  // Mark as needing full redraw
+  gslc_ElemSetRedraw(pGui, pElemRef, GSLC_REDRAW_FULL);
+  return true;
+}
+
+
 int16_t gslc_ElemXListboxGetItemCnt(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef)
 {
   gslc_tsXListbox* pListbox = (gslc_tsXListbox*)gslc_GetXDataFromRef(pGui, pElemRef, GSLC_TYPEX_LISTBOX, __LINE__);
@@ -496,6 +642,10 @@ gslc_tsElemRef* gslc_ElemXListboxCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
   pXData->nBufItemsMax    = nBufItemsMax;
   pXData->nBufItemsPos    = 0;
   pXData->nItemCnt        = 0;
+  pXData->pnItemOfs       = NULL;
+  pXData->nItemOfsMax     = 0;
+  pXData->bItemOfsValid   = false;
+  pXData->pfuncXGetItem   = NULL;
   pXData->nItemCurSel     = nItemDefault;
   pXData->nItemCurSelLast = XLISTBOX_SEL_NONE;
   pXData->nItemSavedSel   = XLISTBOX_SEL_NONE;
@@ -634,6 +784,16 @@ bool gslc_ElemXListboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
   // Determine the list indices to display in the visible window due to scrolling
   int16_t nDispIndMax = (nRows * nCols);
 
+  // Locate the top item in the item buffer. The following items
+  // are then visited in sequence (unless in virtual mode, where
+  // the items are fetched from the application as needed)
+  bool    bVirtual = (pListbox->pfuncXGetItem != NULL);
+  char*   pItem = NULL;
+  char*   pItemNext = NULL;
+  if ((!bVirtual) && (nItemTop < nItemCnt)) {
+    pItemNext = gslc_ElemXListboxGetItemAddr(pListbox, nItemTop);
+  }
+
   for (int16_t nDispInd = 0; nDispInd < nDispIndMax; nDispInd++) {
 
     // Calculate the item index based on the display index
@@ -644,11 +804,14 @@ bool gslc_ElemXListboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
       break;
     }
 
-    // Fetch the list item
-    bool bOk = gslc_ElemXListboxGetItem(pGui, pElemRef, nItemInd, acStr, XLISTBOX_MAX_STR);
-    if (!bOk) {
-      // TODO: Erorr handling
-      break;
+    // Advance to the next stored list item
+    if (!bVirtual) {
+      pItem = pItemNext;
+      if (pItem == NULL) {
+        // TODO: Erorr handling
+        break;
+      }
+      pItemNext = pItem + strlen(pItem) + 1;
     }
 
     int16_t   nItemIndX, nItemIndY;
@@ -693,6 +856,13 @@ bool gslc_ElemXListboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
 
     // Draw the list item
     if (bDoRedraw) {
+      // Fetch the list item
+      if (bVirtual) {
+        gslc_ElemXListboxGetItem(pGui, pElemRef, nItemInd, acStr, XLISTBOX_MAX_STR);
+      } else {
+        gslc_StrCopy(acStr, pItem, XLISTBOX_MAX_STR);
+      }
+
       gslc_DrawFillRect(pGui, rItemRect, colFill);
 
       // Set the text flags to indicate that the user has separately
@@ -59,6 +59,12 @@ extern "C" {
 /// Callback function for Listbox feedback
 typedef bool (*GSLC_CB_XLISTBOX_SEL)(void* pvGui,void* pvElem,int16_t nSel);
 
+/// Callback function for fetching a Listbox item (virtual mode)
+/// - The callback copies the string for item nItem into pStrItem
+///   (up to nStrItemLen bytes including the terminator) and
+///   returns true if the item exists
+typedef bool (*GSLC_CB_XLISTBOX_GETITEM)(void* pvGui,void* pvElem,int16_t nItem,char* pStrItem,uint8_t nStrItemLen);
+
 // Extended element data structures
 // - These data structures are maintained in the gslc_tsElem
 //   structure via the pXData pointer
@@ -71,6 +77,9 @@ typedef struct {
   uint16_t        nBufItemsMax;   ///< Max size of buffer containing items
   uint16_t        nBufItemsPos;   ///< Current buffer position
   int16_t         nItemCnt;       ///< Number of items in the list
+  uint16_t*       pnItemOfs;      ///< Buffer offset of each item (or NULL if no index)
+  uint16_t        nItemOfsMax;    ///< Max number of items in the index (pnItemOfs)
+  bool            bItemOfsValid;  ///< Item index is current (rebuilt if false)
 
   // Style config
   int8_t          nCols;          ///< Number of columns
@@ -95,6 +104,7 @@ typedef struct {
 
   // Callbacks
   GSLC_CB_XLISTBOX_SEL pfuncXSel; ///< Callback func ptr for selection update
+  GSLC_CB_XLISTBOX_GETITEM pfuncXGetItem; ///< Callback func ptr for fetching items (or NULL if items are in pBufItems)
 
 } gslc_tsXListbox;
 
@@ -231,6 +241,52 @@ bool gslc_ElemXListboxGetItem(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, int16_
   char* pStrItem, uint8_t nStrItemLen);
 
 
+///
+/// Assign storage for an index of the listbox item positions
+/// - Without an index, locating an item requires a search of the
+///   item buffer from the start
+/// - If the listbox holds more than nItemOfsMax items, the search
+///   is used until enough items have been deleted
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  pElemRef:      Ptr to Element Reference to update
+/// \param[in]  pnItemOfs:     Pointer to array that will contain the item index (or NULL to disable)
+/// \param[in]  nItemOfsMax:   Max number of items in the index (pnItemOfs)
+///
+/// \return true if OK, false if fail
+///
+bool gslc_ElemXListboxSetItemIndex(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, uint16_t* pnItemOfs,
+  uint16_t nItemOfsMax);
+
+///
+/// Assign a callback function that provides the listbox items (virtual mode)
+/// - In this mode the items are not stored in the listbox buffer.
+///   Instead, the callback is called for each item that is to be
+///   displayed, so that large lists need not be copied into RAM.
+/// - The Add, Insert & Delete APIs are not available in this mode
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  pElemRef:      Ptr to Element Reference to update
+/// \param[in]  funcCb:        Function pointer to item fetch routine (or NULL to use the item buffer)
+/// \param[in]  nItemCnt:      Number of items in the list
+///
+/// \return none
+///
+void gslc_ElemXListboxSetGetItemFunc(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, GSLC_CB_XLISTBOX_GETITEM funcCb,
+  int16_t nItemCnt);
+
+///
+/// Update the number of items in a listbox in virtual mode
+/// - The current selection is cleared if it is no longer in the list
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  pElemRef:      Ptr to Element Reference to update
+/// \param[in]  nItemCnt:      Number of items in the list
+///
+/// \return true if OK, false if fail (eg. not in virtual mode)
+///
+bool gslc_ElemXListboxSetItemCnt(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, int16_t nItemCnt);
+
 ///
 /// Get the number of items in the listbox
 ///
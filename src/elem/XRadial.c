@@ -107,6 +107,7 @@ gslc_tsElemRef* gslc_ElemXRadialCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
   pXData->nIndicLen       = 10;     // Dummy default to be overridden
   pXData->nIndicTip       = 3;      // Dummy default to be overridden
   pXData->bIndicFill      = false;
+  pXData->sIndic.bValid   = false;
   sElem.pXData            = (void*)(pXData);
   sElem.pfuncXDraw        = &gslc_ElemXRadialDraw;
   sElem.pfuncXTouch       = NULL;           // No need to track touches
@@ -250,16 +251,19 @@ bool gslc_ElemXRadialDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
 }
 
 
-void gslc_ElemXRadialDrawRadialHelp(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nArrowLen,uint16_t nArrowSz,int16_t n64Ang,bool bFill,gslc_tsColor colFrame)
+void gslc_ElemXRadialDrawRadialHelp(gslc_tsGui* pGui,gslc_tsPolarIndic* pIndic,int16_t nX,int16_t nY,uint16_t nArrowLen,uint16_t nArrowSz,int16_t n64Ang,bool bFill,gslc_tsColor colFrame)
 {
-  int16_t   nTipX,nTipY;
-  int16_t   nBaseX1,nBaseY1,nBaseX2,nBaseY2;
-  int16_t   nTipBaseX,nTipBaseY;
-
-  gslc_PolarToXY(nArrowLen,n64Ang,&nTipX,&nTipY);
-  gslc_PolarToXY(nArrowLen-nArrowSz,n64Ang,&nTipBaseX,&nTipBaseY);
-  gslc_PolarToXY(nArrowSz,n64Ang-90*64,&nBaseX1,&nBaseY1);
-  gslc_PolarToXY(nArrowSz,n64Ang+90*64,&nBaseX2,&nBaseY2);
+  // Fetch the indicator vertices (reused if unchanged since the last draw)
+  gslc_PolarIndicCalc(pIndic,nArrowLen,nArrowSz,n64Ang);
+
+  int16_t   nTipX     = pIndic->sTip.x;
+  int16_t   nTipY     = pIndic->sTip.y;
+  int16_t   nBaseX1   = pIndic->sBase1.x;
+  int16_t   nBaseY1   = pIndic->sBase1.y;
+  int16_t   nBaseX2   = pIndic->sBase2.x;
+  int16_t   nBaseY2   = pIndic->sBase2.y;
+  int16_t   nTipBaseX = pIndic->sTipBase.x;
+  int16_t   nTipBaseY = pIndic->sTipBase.y;
 
   // FIXME: There appears to be a wrapping bug in the trigonometry
   //        calculations associated with the bottom-right corner
@@ -345,7 +349,7 @@ bool gslc_ElemXRadialDrawRadial(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_t
 
   // Clear old
   if (bValLastValid) {
-    gslc_ElemXRadialDrawRadialHelp(pGui,nElemMidX,nElemMidY,nArrowLen,nArrowSize,n64AngLast,bFill,pElem->colElemFill);
+    gslc_ElemXRadialDrawRadialHelp(pGui,&(pGauge->sIndic),nElemMidX,nElemMidY,nArrowLen,nArrowSize,n64AngLast,bFill,pElem->colElemFill);
   }
 
   // Draw frame
@@ -358,7 +362,7 @@ bool gslc_ElemXRadialDrawRadial(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_t
   }
 
   // Draw pointer
-  gslc_ElemXRadialDrawRadialHelp(pGui,nElemMidX,nElemMidY,nArrowLen,nArrowSize,n64Ang,bFill,pGauge->colGauge);
+  gslc_ElemXRadialDrawRadialHelp(pGui,&(pGauge->sIndic),nElemMidX,nElemMidY,nArrowLen,nArrowSize,n64Ang,bFill,pGauge->colGauge);
 
   return true;
 }
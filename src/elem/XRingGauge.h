@@ -92,6 +92,7 @@ typedef struct {
   int16_t           nVal;           ///< Current position value
   int16_t           nValLast;       ///< Previous position value
   char              acStrLast[XRING_STR_MAX];
+  gslc_tsPolarCache sPolarCache;    ///< Cached segment vertices
 
   // Callbacks
 
@@ -102,6 +102,9 @@ gslc_tsElemRef* gslc_ElemXTextboxCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
   pXData->nWndRowStart    = 0;
 
   pXData->nRedrawRow = XTEXTBOX_REDRAW_ALL;
+  pXData->nRedrawRowMask  = 0;
+  pXData->nClearRowMask   = 0;
+  pXData->nRedrawScroll   = 0;
 
   // Clear the buffer
   memset(pBuf,0,nBufRows*nBufCols*sizeof(char));
@@ -192,9 +195,31 @@ void gslc_ElemXTextboxReset(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
   // Set the redraw flag
   // - Only need incremental redraw
   pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL; // All-row update
+  pBox->nRedrawRowMask  = 0;
+  pBox->nClearRowMask   = 0;
+  pBox->nRedrawScroll   = 0;
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
 }
 
+// Mark a row of the visible window as needing redraw
+// - If bClear then the row background is also cleared
+// - Rows beyond the tracked range promote the redraw to all rows
+void gslc_ElemXTextboxWndRowMark(gslc_tsXTextbox* pBox,int16_t nWndRow,bool bClear)
+{
+  if (pBox->nRedrawRow == XTEXTBOX_REDRAW_ALL) {
+    // All-row redraw was pending, so no change
+    return;
+  }
+  if ((nWndRow < 0) || (nWndRow >= XTEXTBOX_REDRAW_ROWS_MAX)) {
+    pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
+    return;
+  }
+  pBox->nRedrawRowMask |= ((uint32_t)1 << nWndRow);
+  if (bClear) {
+    pBox->nClearRowMask |= ((uint32_t)1 << nWndRow);
+  }
+}
+
 // Advance the buffer writer to the next line
 // The window is also shifted if we are eating the first row
 void gslc_ElemXTextboxLineWrAdv(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
@@ -219,8 +244,21 @@ void gslc_ElemXTextboxLineWrAdv(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
   if (pBox->nBufPosY == pBox->nWndRowStart) {
     // Advance the window (with wrap if needed)
     pBox->nWndRowStart = (pBox->nWndRowStart + 1) % pBox->nBufRows;
-    // Ensure all rows get redrawn
-    pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
+    // The rows already drawn move up by one row, so only the
+    // newly exposed bottom row needs to be cleared and drawn.
+    // The redraw shifts the existing rows on the display.
+    if (pBox->nRedrawRow != XTEXTBOX_REDRAW_ALL) {
+      int16_t nMaxRow = (pBox->nBufRows < pBox->nWndRows)? pBox->nBufRows : pBox->nWndRows;
+      pBox->nRedrawScroll++;
+      if (pBox->nRedrawScroll >= nMaxRow) {
+        // Every row has scrolled, so nothing can be reused
+        pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
+      } else {
+        pBox->nRedrawRowMask >>= 1;
+        pBox->nClearRowMask >>= 1;
+        gslc_ElemXTextboxWndRowMark(pBox,nMaxRow-1,true);
+      }
+    }
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
   }
 }
@@ -297,23 +335,15 @@ void gslc_ElemXTextboxBufAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,unsigned
   } else {
 
     // Mark this specific row as needing redraw
-    if (pBox->nRedrawRow == XTEXTBOX_REDRAW_NONE) {
-      // No redraw was pending, so mark single row pending
-      pBox->nRedrawRow = pBox->nBufPosY;
+    // - Only if the row is within the visible window
+    uint16_t nWndRowStartScr = pBox->nWndRowStart;
+    if (pBox->bScrollEn) {
+      nWndRowStartScr = (pBox->nWndRowStart + pBox->nScrollPos) % pBox->nBufRows;
     }
-    else if (pBox->nRedrawRow == XTEXTBOX_REDRAW_ALL) {
-      // All-row redraw was pending, so no change
-    }
-    else {
-      // Single row redraw was pending
-      if (pBox->nRedrawRow != pBox->nBufPosY) {
-        // But the pending row differs from the current row,
-        // so promote redraw to all lines
-        pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
-      }
-      else {
-        // Pending row is the same, so no change
-      }
+    int16_t nMaxRow = (pBox->nBufRows < pBox->nWndRows)? pBox->nBufRows : pBox->nWndRows;
+    int16_t nWndRow = (pBox->nBufPosY + pBox->nBufRows - nWndRowStartScr) % pBox->nBufRows;
+    if (nWndRow < nMaxRow) {
+      gslc_ElemXTextboxWndRowMark(pBox,nWndRow,false);
     }
   } // chNew
 
@@ -468,12 +498,40 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
     }
   }
 
+  gslc_tsRect rInner = gslc_ExpandRect(pElem->rElem, -1, -1);
+  bool        bRedrawAll = (eRedraw == GSLC_REDRAW_FULL) || (pBox->nRedrawRow == XTEXTBOX_REDRAW_ALL);
+  uint8_t     nMaxRow = (pBox->nBufRows < pBox->nWndRows)? pBox->nBufRows : pBox->nWndRows;
+  uint8_t     nOutRow = 0;
+
+  // If the window has scrolled since the last redraw, shift the
+  // rows that are already on the display instead of redrawing them
+  // - Fall back to redrawing all rows if the driver can't copy
+  if ((!bRedrawAll) && (pBox->nRedrawScroll > 0)) {
+    int16_t     nShiftY = pBox->nRedrawScroll * pBox->nChSizeY;
+    gslc_tsRect rRows = { rInner.x, (int16_t)(pElem->rElem.y + pBox->nMarginY), rInner.w, (uint16_t)(nMaxRow * pBox->nChSizeY) };
+    bRedrawAll = true;
+    if ((gslc_ClipRect(&rInner,&rRows)) && ((int16_t)rRows.h > nShiftY)) {
+      gslc_tsRect rSrc = { rRows.x, (int16_t)(rRows.y + nShiftY), rRows.w, (uint16_t)(rRows.h - nShiftY) };
+      bRedrawAll = !gslc_DrawCopyRect(pGui,rSrc,rRows.x,rRows.y);
+    }
+  }
+
   // Clear the background (inset from frame)
-  // - Only do this if we need to redraw all rows
-  if ((eRedraw == GSLC_REDRAW_FULL) || (pBox->nRedrawRow == XTEXTBOX_REDRAW_ALL)) {
-    gslc_tsRect rInner = gslc_ExpandRect(pElem->rElem, -1, -1);
+  // - Clear the whole area if we need to redraw all rows,
+  //   otherwise only the rows that have been exposed by a scroll
+  if (bRedrawAll) {
     colBg = (bGlow) ? pElem->colElemFillGlow : pElem->colElemFill;
     gslc_DrawFillRect(pGui, rInner, colBg);
+  } else if (pBox->nClearRowMask != 0) {
+    colBg = (bGlow) ? pElem->colElemFillGlow : pElem->colElemFill;
+    for (nOutRow=0;(nOutRow<nMaxRow)&&(nOutRow<XTEXTBOX_REDRAW_ROWS_MAX);nOutRow++) {
+      if (pBox->nClearRowMask & ((uint32_t)1 << nOutRow)) {
+        gslc_tsRect rRow = { rInner.x, (int16_t)(pElem->rElem.y + pBox->nMarginY + nOutRow * pBox->nChSizeY), rInner.w, pBox->nChSizeY };
+        if (gslc_ClipRect(&rInner,&rRow)) {
+          gslc_DrawFillRect(pGui, rRow, colBg);
+        }
+      }
+    }
   }
 
   uint16_t          nBufPos = 0;
@@ -506,10 +564,6 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
 
   uint8_t nCurY = 0;
 
-  uint8_t nOutRow = 0;
-  uint8_t nMaxRow = 0;
-
-  nMaxRow = (pBox->nBufRows < pBox->nWndRows)? pBox->nBufRows : pBox->nWndRows;
   for (nOutRow=0;nOutRow<nMaxRow;nOutRow++) {
 
     bRedrawLine = true; // Default to drawing the row
@@ -519,14 +573,11 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
     int16_t nRowCur = nWndRowStartScr + nOutRow;
     nRowCur = nRowCur % pBox->nBufRows;
 
-    // If we are doing incremental redraw and only a single
-    // row has been marked as requiring redraw, then skip
-    // all other rows
-    if (eRedraw == GSLC_REDRAW_INC) {
-      if ((pBox->nRedrawRow >= 0) && (pBox->nRedrawRow != nRowCur)) {
-        // Single-row redraw, but we are not on that row, so skip
-        bRedrawLine = false;
-      }
+    // If we are doing incremental redraw then skip
+    // all rows that haven't been marked for redraw
+    if ((!bRedrawAll) && ((nOutRow >= XTEXTBOX_REDRAW_ROWS_MAX) ||
+        ((pBox->nRedrawRowMask & ((uint32_t)1 << nOutRow)) == 0))) {
+      bRedrawLine = false;
     }
 
     // NOTE: At the start of buffer fill where we have
@@ -541,9 +592,11 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
       nTxtPixX = pElem->rElem.x + pBox->nMarginX + 0 * pBox->nChSizeX;
       nTxtPixY = pElem->rElem.y + pBox->nMarginY + nCurY * pBox->nChSizeY;
 #if (DRV_OVERRIDE_TXT_ALIGN)
+      GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_TXT);
       gslc_DrvDrawTxtAlign(pGui,nTxtPixX,nTxtPixY,nTxtPixX,nTxtPixY,GSLC_ALIGN_TOP_LEFT,pElem->pTxtFont,
             (char*)&(pBox->pBuf[nBufPos]),pElem->eTxtFlags,colTxt,colBg);
 #else
+      GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_TXT);
       gslc_DrvDrawTxt(pGui, nTxtPixX, nTxtPixY, pElem->pTxtFont, (char*)&(pBox->pBuf[nBufPos]), pElem->eTxtFlags, colTxt, colBg);
 #endif
     }
@@ -566,13 +619,10 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
   uint8_t           nCurX = 0;
   uint8_t           nCurY = 0;
 
-  uint8_t nOutRow = 0;
   uint8_t nOutCol = 0;
   uint8_t nMaxCol = 0;
-  uint8_t nMaxRow = 0;
   bool    bRowDone = false;
   nMaxCol = (pBox->nBufCols < pBox->nWndCols)? pBox->nBufCols : pBox->nWndCols;
-  nMaxRow = (pBox->nBufRows < pBox->nWndRows)? pBox->nBufRows : pBox->nWndRows;
   for (nOutRow=0;nOutRow<nMaxRow;nOutRow++) {
 
     bRedrawLine = true; // Default to drawing the row
@@ -582,14 +632,11 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
     uint16_t nRowCur = nWndRowStartScr + nOutRow;
     nRowCur = nRowCur % pBox->nBufRows;
 
-    // If we are doing incremental redraw and only a single
-    // row has been marked as requiring redraw, then skip
-    // all other rows
-    if (eRedraw == GSLC_REDRAW_INC) {
-      if ((pBox->nRedrawRow >= 0) && (pBox->nRedrawRow != nRowCur)) {
-        // Single-row redraw, but we are not on that row, so skip
-        bRedrawLine = false;
-      }
+    // If we are doing incremental redraw then skip
+    // all rows that haven't been marked for redraw
+    if ((!bRedrawAll) && ((nOutRow >= XTEXTBOX_REDRAW_ROWS_MAX) ||
+        ((pBox->nRedrawRowMask & ((uint32_t)1 << nOutRow)) == 0))) {
+      bRedrawLine = false;
     }
 
     bRowDone = false;
@@ -633,9 +680,11 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
           nTxtPixX = pElem->rElem.x + pBox->nMarginX + nCurX * pBox->nChSizeX;
           nTxtPixY = pElem->rElem.y + pBox->nMarginY + nCurY * pBox->nChSizeY;
 #if (DRV_OVERRIDE_TXT_ALIGN)
+          GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_TXT);
           gslc_DrvDrawTxtAlign(pGui,nTxtPixX,nTxtPixY,nTxtPixX,nTxtPixY,GSLC_ALIGN_TOP_LEFT,pElem->pTxtFont,
             (char*)&acChToDraw,pElem->eTxtFlags,colTxt,colBg);
 #else
+          GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_TXT);
           gslc_DrvDrawTxt(pGui,nTxtPixX,nTxtPixY,pElem->pTxtFont,(char*)&acChToDraw,pElem->eTxtFlags,colTxt,colBg);
 #endif
           nCurX++;
@@ -660,6 +709,9 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
 
   // Clear the redraw flag
   pBox->nRedrawRow = XTEXTBOX_REDRAW_NONE;
+  pBox->nRedrawRowMask  = 0;
+  pBox->nClearRowMask   = 0;
+  pBox->nRedrawScroll   = 0;
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
    
   // Mark page as needing flip
@@ -57,6 +57,10 @@ extern "C" {
 #define XTEXTBOX_REDRAW_NONE   -1
 #define XTEXTBOX_REDRAW_ALL    -2
 
+/// Maximum number of visible rows tracked individually for redraw
+/// - Taller windows always redraw all rows
+#define XTEXTBOX_REDRAW_ROWS_MAX  32
+
 // Extended element data structures
 // - These data structures are maintained in the gslc_tsElem
 //   structure via the pXData pointer
@@ -86,7 +90,10 @@ typedef struct {
   uint8_t                     nBufPosY;     ///< Buffer Y position
   uint8_t                     nWndRowStart; ///< First row of current window
   // Redraw
-  int16_t                     nRedrawRow;   ///< Specific row to update in redraw (if not -1)
+  int16_t                     nRedrawRow;   ///< Redraw all rows (XTEXTBOX_REDRAW_ALL) or only marked rows
+  uint32_t                    nRedrawRowMask; ///< Visible rows requiring text redraw (bit per window row)
+  uint32_t                    nClearRowMask;  ///< Visible rows requiring background clear before redraw
+  uint8_t                     nRedrawScroll;  ///< Number of rows the window has scrolled since last redraw
 
 } gslc_tsXTextbox;
 
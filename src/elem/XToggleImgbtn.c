@@ -284,11 +284,14 @@ bool gslc_ElemXToggleImgbtnDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eR
   if (pToggleImgbtn->bOn) {
     // Glow image might be NULL
     if (pElem->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE) {
+      GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_IMAGE);
       bOk = gslc_DrvDrawImage(pGui,nInnerX,nInnerY,pElem->sImgRefGlow);
     } else {
+      GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_IMAGE);
       bOk = gslc_DrvDrawImage(pGui,nInnerX,nInnerY,pElem->sImgRefNorm);
     }
   } else {
+    GSLC_STATS_DRV(pGui,GSLC_STATS_DRV_IMAGE);
     bOk = gslc_DrvDrawImage(pGui,nInnerX,nInnerY,pElem->sImgRefNorm);
   }
 